@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <malloc.h>
 #include <string.h>
 #include <math.h>
 
@@ -671,10 +672,20 @@ static texture_t *load_texture(const char *filename)
         exit(-1);
     }
 
+    // twiddle into RAM in 32-byte chunks, then copy the whole texture into VRAM at once
+    uint16_t *twiddled = (uint16_t *)memalign(32, img.byte_count);
+    if (!twiddled)
+    {
+        printf("failed to allocate twiddle buffer for %s\n", filename);
+        exit(-1);
+    }
+
     tex->w = img.w;
     tex->h = img.h;
     tex->fmt = PVR_TXRFMT_RGB565;
-    pvr_txr_load_kimg(&img, tex->ptr, 0);
+    shz_twiddle16(twiddled, (const uint16_t *)img.data, img.w, img.h);
+    pvr_txr_load(twiddled, tex->ptr, img.byte_count);
+    free(twiddled);
     kos_img_free(&img, 0);
 
     // if you want grayscale textures, change that 0 into a 1 and rebuild
@@ -21,6 +21,10 @@
 void shz_xmtrx_load_apply_store_4x4_sh4(shz_mat4x4_t* out, const shz_mat4x4_t* mat1, const shz_mat4x4_t* mat2);
 void shz_xmtrx_load_apply_store_3x4_sh4(shz_mat3x4_t* out, const shz_mat3x4_t* mat1, const shz_mat3x4_t* mat2);
 void shz_xmtrx_load_apply_store_3x3_sh4(shz_mat3x3_t* out, const shz_mat3x3_t* mat1, const shz_mat3x3_t* mat2);
+void shz_xmtrx_transform_vec4_array_sh4(shz_vec4_t* dst, const shz_vec4_t* src, size_t count, size_t stride);
+void shz_xmtrx_transform_vec3_array_sh4(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride);
+void shz_xmtrx_transform_point3_array_sh4(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride);
+void shz_xmtrx_project_point3_array_sh4(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride, const shz_viewport_t* viewport);
 
 SHZ_INLINE float shz_xmtrx_read_sh4(shz_xmtrx_reg_t xf) SHZ_NOEXCEPT {
 #define FP_REG_BACK_TO_FRONT_(reg)    \
@@ -0,0 +1,41 @@
+//! \cond INTERNAL
+/*! \file
+    \brief Internal implementation of the Clipping API
+    \ingroup clip
+
+    This file contains the implementation of the inline functions declared
+    within the Clipping API.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+SHZ_INLINE uint8_t shz_clip_outcode(shz_vec4_t pos) SHZ_NOEXCEPT {
+#if SHZ_BACKEND == SHZ_X86
+    const __m128 v  = shz_vec4_m128_(pos);
+    const __m128 w  = shz_x86_splat_(v, 3);
+    const __m128 lt = _mm_cmplt_ps(v, _mm_sub_ps(_mm_setzero_ps(), w));
+    const __m128 gt = _mm_cmpgt_ps(v, w);
+
+    // Interleaving each axis' pair of comparisons lines their sign bits up with the outcode's.
+    return (uint8_t)(_mm_movemask_ps(_mm_unpacklo_ps(lt, gt)) |
+                     ((_mm_movemask_ps(_mm_unpackhi_ps(lt, gt)) & 0x3) << 4));
+#else
+    return (uint8_t)(((pos.x < -pos.w) << 0) | ((pos.x > pos.w) << 1) |
+                     ((pos.y < -pos.w) << 2) | ((pos.y > pos.w) << 3) |
+                     ((pos.z < -pos.w) << 4) | ((pos.z > pos.w) << 5));
+#endif
+}
+
+SHZ_INLINE size_t shz_clip_vertices_max(size_t triangles, uint8_t planes) SHZ_NOEXCEPT {
+    size_t clipped = 0;
+
+    // Each plane clipped against may add at most one vertex, and so one triangle, to the polygon.
+    for(planes &= SHZ_CLIP_ALL; planes; planes &= planes - 1)
+        ++clipped;
+
+    return triangles * 3 * (1 + clipped);
+}
+
+//! \endcond
@@ -0,0 +1,125 @@
+//! \cond INTERNAL
+/*! \file
+    \brief Internal implementation of the Color API
+    \ingroup color
+
+    This file contains the implementation of the inline functions declared
+    within the Color API.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+// Scales a channel to a rounded byte, saturating with plain comparisons, which never become calls to fminf() or fmaxf().
+SHZ_FORCE_INLINE uint32_t shz_color_channel_(float c) SHZ_NOEXCEPT {
+    c = c * 255.0f + 0.5f;
+    c = (c > 0.0f)? c : 0.0f;
+
+    return (uint32_t)((c < 255.0f)? c : 255.0f);
+}
+
+SHZ_FORCE_INLINE uint16_t shz_color_to1555_(uint32_t c) SHZ_NOEXCEPT {
+    return (uint16_t)(((c >> 16) & 0x8000) | ((c >> 9) & 0x7c00) | ((c >> 6) & 0x03e0) | ((c >> 3) & 0x001f));
+}
+
+SHZ_FORCE_INLINE uint16_t shz_color_to565_(uint32_t c) SHZ_NOEXCEPT {
+    return (uint16_t)(((c >> 8) & 0xf800) | ((c >> 5) & 0x07e0) | ((c >> 3) & 0x001f));
+}
+
+SHZ_FORCE_INLINE uint16_t shz_color_to4444_(uint32_t c) SHZ_NOEXCEPT {
+    return (uint16_t)(((c >> 16) & 0xf000) | ((c >> 12) & 0x0f00) | ((c >> 8) & 0x00f0) | ((c >> 4) & 0x000f));
+}
+
+// Widening replicates the top bits of each channel into its bottom bits, so that full intensity stays at 255.
+SHZ_FORCE_INLINE uint32_t shz_color_from1555_(uint32_t c) SHZ_NOEXCEPT {
+    const uint32_t rgb = ((c & 0x7c00) << 9) | ((c & 0x03e0) << 6) | ((c & 0x001f) << 3);
+
+    return ((c & 0x8000)? 0xff000000 : 0) | rgb | ((rgb >> 5) & 0x00070707);
+}
+
+SHZ_FORCE_INLINE uint32_t shz_color_from565_(uint32_t c) SHZ_NOEXCEPT {
+    const uint32_t rb = ((c & 0xf800) << 8) | ((c & 0x001f) << 3);
+    const uint32_t g  = (c & 0x07e0) << 5;
+
+    return 0xff000000 | rb | ((rb >> 5) & 0x00070007) | g | ((g >> 6) & 0x00000300);
+}
+
+SHZ_FORCE_INLINE uint32_t shz_color_from4444_(uint32_t c) SHZ_NOEXCEPT {
+    const uint32_t nibbles = ((c & 0xf000) << 12) | ((c & 0x0f00) << 8) | ((c & 0x00f0) << 4) | (c & 0x000f);
+
+    return nibbles * 0x11;
+}
+
+SHZ_INLINE uint32_t shz_color_pack(shz_vec4_t rgba) SHZ_NOEXCEPT {
+    return (shz_color_channel_(rgba.w) << 24) |
+           (shz_color_channel_(rgba.x) << 16) |
+           (shz_color_channel_(rgba.y) <<  8) |
+           (shz_color_channel_(rgba.z) <<  0);
+}
+
+SHZ_INLINE shz_vec4_t shz_color_unpack(uint32_t argb) SHZ_NOEXCEPT {
+    return shz_vec4_scale(shz_vec4_init((float)((argb >> 16) & 0xff),
+                                        (float)((argb >>  8) & 0xff),
+                                        (float)((argb >>  0) & 0xff),
+                                        (float)((argb >> 24) & 0xff)),
+                          1.0f / 255.0f);
+}
+
+SHZ_INLINE uint16_t shz_color_to16(uint32_t argb, shz_color_format_t format) SHZ_NOEXCEPT {
+    switch(format) {
+    case SHZ_COLOR_ARGB1555: return shz_color_to1555_(argb);
+    case SHZ_COLOR_RGB565:   return shz_color_to565_(argb);
+    default:                 return shz_color_to4444_(argb);
+    }
+}
+
+SHZ_INLINE uint32_t shz_color_from16(uint16_t color, shz_color_format_t format) SHZ_NOEXCEPT {
+    switch(format) {
+    case SHZ_COLOR_ARGB1555: return shz_color_from1555_(color);
+    case SHZ_COLOR_RGB565:   return shz_color_from565_(color);
+    default:                 return shz_color_from4444_(color);
+    }
+}
+
+// Interpolates with \p tb out of 256, in 8.8 fixed-point, two channels at a time.
+SHZ_FORCE_INLINE uint32_t shz_color_lerp_fixed_(uint32_t a, uint32_t b, uint32_t tb) SHZ_NOEXCEPT {
+    const uint32_t ta = 256 - tb;
+    const uint32_t rb = (((a & 0x00ff00ff) * ta + (b & 0x00ff00ff) * tb) >> 8) & 0x00ff00ff;
+    const uint32_t ag = (((a >> 8) & 0x00ff00ff) * ta + ((b >> 8) & 0x00ff00ff) * tb) & 0xff00ff00;
+
+    return ag | rb;
+}
+
+// Weight of \p t out of 256, for shz_color_lerp_fixed_().
+SHZ_FORCE_INLINE uint32_t shz_color_weight_(float t) SHZ_NOEXCEPT {
+    return (uint32_t)(shz_saturatef(t) * 256.0f);
+}
+
+SHZ_INLINE uint32_t shz_color_lerp(uint32_t a, uint32_t b, float t) SHZ_NOEXCEPT {
+    return shz_color_lerp_fixed_(a, b, shz_color_weight_(t));
+}
+
+SHZ_INLINE uint32_t shz_color_modulate(uint32_t a, uint32_t b) SHZ_NOEXCEPT {
+    uint32_t result = 0;
+
+    // Exactly rounds x * y / 255 for each channel.
+    for(unsigned shift = 0; shift < 32; shift += 8) {
+        const uint32_t p = ((a >> shift) & 0xff) * ((b >> shift) & 0xff) + 128;
+
+        result |= ((p + (p >> 8)) >> 8) << shift;
+    }
+
+    return result;
+}
+
+SHZ_INLINE uint32_t shz_color_add(uint32_t a, uint32_t b) SHZ_NOEXCEPT {
+    // Sums the low 7 bits of each channel, then recovers which channels carried out of their top bit.
+    const uint32_t low   = (a & 0x7f7f7f7f) + (b & 0x7f7f7f7f);
+    const uint32_t sum   = low ^ ((a ^ b) & 0x80808080);
+    const uint32_t carry = ((a & b) | ((a | b) & ~sum)) & 0x80808080;
+
+    return sum | ((carry >> 7) * 0xff);
+}
+
+//! \endcond
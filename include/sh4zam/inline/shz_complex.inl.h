@@ -292,4 +292,12 @@ SHZ_FORCE_INLINE void shz_fft(shz_complex_t* s, size_t bytes) SHZ_NOEXCEPT {
 #else
     shz_fft_sw(s, bytes);
 #endif
-}
\ No newline at end of file
+}
+
+SHZ_INLINE size_t shz_fir_latency(const shz_fir_t* fir) SHZ_NOEXCEPT {
+    return (fir->method == SHZ_FIR_METHOD_FFT)? fir->block_size : 0;
+}
+
+SHZ_INLINE size_t shz_stft_frames_pending(const shz_stft_t* stft, size_t count) SHZ_NOEXCEPT {
+    return (count < stft->until)? 0 : 1 + (count - stft->until) / stft->hop;
+}
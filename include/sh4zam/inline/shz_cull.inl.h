@@ -0,0 +1,50 @@
+//! \cond INTERNAL
+/*! \file
+    \brief Internal implementation of the Culling API
+    \ingroup cull
+
+    This file contains the implementation of the inline functions declared
+    within the Culling API, along with the plane tests shared with the
+    batched routines.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+// Returns whether a sphere, whose center has a W of 1, lies entirely behind the given plane.
+SHZ_FORCE_INLINE bool shz_frustum_plane_rejects_sphere_(shz_vec4_t plane, shz_vec4_t center, float radius) SHZ_NOEXCEPT {
+    return shz_vec4_dot(plane, center) < -radius;
+}
+
+// Returns whether a box, whose center has a W of 1, lies entirely behind the given plane.
+SHZ_FORCE_INLINE bool shz_frustum_plane_rejects_aabb_(shz_vec4_t plane, shz_vec4_t center, shz_vec3_t extents) SHZ_NOEXCEPT {
+    return shz_vec4_dot(plane, center) < -shz_vec3_dot(shz_vec3_abs(plane.xyz), extents);
+}
+
+SHZ_INLINE shz_aabb_t shz_aabb_init_min_max(shz_vec3_t min, shz_vec3_t max) SHZ_NOEXCEPT {
+    return (shz_aabb_t) { shz_vec3_scale(shz_vec3_add(min, max), 0.5f),
+                          shz_vec3_scale(shz_vec3_sub(max, min), 0.5f) };
+}
+
+SHZ_INLINE bool shz_frustum_test_sphere(const shz_frustum_t* frustum, shz_sphere_t sphere) SHZ_NOEXCEPT {
+    const shz_vec4_t center = shz_vec3_vec4(sphere.center, 1.0f);
+
+    for(unsigned p = 0; p < SHZ_FRUSTUM_PLANE_COUNT; ++p)
+        if(shz_frustum_plane_rejects_sphere_(frustum->planes[p], center, sphere.radius))
+            return false;
+
+    return true;
+}
+
+SHZ_INLINE bool shz_frustum_test_aabb(const shz_frustum_t* frustum, shz_aabb_t aabb) SHZ_NOEXCEPT {
+    const shz_vec4_t center = shz_vec3_vec4(aabb.center, 1.0f);
+
+    for(unsigned p = 0; p < SHZ_FRUSTUM_PLANE_COUNT; ++p)
+        if(shz_frustum_plane_rejects_aabb_(frustum->planes[p], center, aabb.extents))
+            return false;
+
+    return true;
+}
+
+//! \endcond
@@ -0,0 +1,147 @@
+//! \cond INTERNAL
+/*! \file
+    \brief Internal implementation of Dual Quaternion API
+    \ingroup dualquat
+
+    This file contains the implementation of the inline functions declared
+    within the Dual Quaternion API, which are composed entirely from the
+    quaternion routines, so they inherit each back-end's accelerated
+    multiplication and rotation.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+SHZ_FORCE_INLINE shz_dualquat_t shz_dualquat_init(shz_quat_t real, shz_quat_t dual) SHZ_NOEXCEPT {
+    return SHZ_INIT(shz_dualquat_t, .real = real, .dual = dual);
+}
+
+SHZ_FORCE_INLINE shz_dualquat_t shz_dualquat_identity(void) SHZ_NOEXCEPT {
+    return shz_dualquat_init(shz_quat_identity(), shz_quat_init(0.0f, 0.0f, 0.0f, 0.0f));
+}
+
+SHZ_FORCE_INLINE bool shz_dualquat_equal(shz_dualquat_t a, shz_dualquat_t b) SHZ_NOEXCEPT {
+    return shz_quat_equal(a.real, b.real) && shz_quat_equal(a.dual, b.dual);
+}
+
+SHZ_INLINE shz_dualquat_t shz_dualquat_from_rotation_translation(shz_quat_t rotation, shz_vec3_t translation) SHZ_NOEXCEPT {
+    // dual = 0.5 * (0, t) * r
+    return shz_dualquat_init(rotation,
+                             shz_quat_mult(shz_quat_init(0.0f,
+                                                         0.5f * translation.x,
+                                                         0.5f * translation.y,
+                                                         0.5f * translation.z),
+                                           rotation));
+}
+
+SHZ_FORCE_INLINE shz_dualquat_t shz_dualquat_from_quat(shz_quat_t rotation) SHZ_NOEXCEPT {
+    return shz_dualquat_init(rotation, shz_quat_init(0.0f, 0.0f, 0.0f, 0.0f));
+}
+
+SHZ_FORCE_INLINE shz_dualquat_t shz_dualquat_from_translation(shz_vec3_t translation) SHZ_NOEXCEPT {
+    return shz_dualquat_init(shz_quat_identity(),
+                             shz_quat_init(0.0f,
+                                           0.5f * translation.x,
+                                           0.5f * translation.y,
+                                           0.5f * translation.z));
+}
+
+SHZ_INLINE shz_dualquat_t shz_dualquat_from_mat4x4(const shz_mat4x4_t* mat) SHZ_NOEXCEPT {
+    return shz_dualquat_from_rotation_translation(shz_mat4x4_to_quat(mat), mat->pos.xyz);
+}
+
+SHZ_FORCE_INLINE shz_quat_t shz_dualquat_rotation(shz_dualquat_t dq) SHZ_NOEXCEPT {
+    return dq.real;
+}
+
+SHZ_INLINE shz_vec3_t shz_dualquat_translation(shz_dualquat_t dq) SHZ_NOEXCEPT {
+    // Vector part of 2 * dual * conj(real), expanded to skip computing its scalar part.
+    const shz_vec3_t t = shz_vec3_add(shz_vec3_sub(shz_vec3_scale(dq.dual.axis, dq.real.w),
+                                                   shz_vec3_scale(dq.real.axis, dq.dual.w)),
+                                      shz_vec3_cross(dq.real.axis, dq.dual.axis));
+
+    return shz_vec3_scale(t, 2.0f);
+}
+
+SHZ_FORCE_INLINE float shz_dualquat_dot(shz_dualquat_t a, shz_dualquat_t b) SHZ_NOEXCEPT {
+    return shz_quat_dot(a.real, b.real);
+}
+
+SHZ_INLINE void shz_dualquat_to_mat3x4(shz_dualquat_t dq, shz_mat3x4_t* mat) SHZ_NOEXCEPT {
+    const shz_quat_t q = dq.real;
+
+    mat->elem2D[0][0] = 1.0f - 2.0f * (q.y * q.y + q.z * q.z);
+    mat->elem2D[0][1] = 2.0f * (q.x * q.y + q.w * q.z);
+    mat->elem2D[0][2] = 2.0f * (q.x * q.z - q.w * q.y);
+
+    mat->elem2D[1][0] = 2.0f * (q.x * q.y - q.w * q.z);
+    mat->elem2D[1][1] = 1.0f - 2.0f * (q.x * q.x + q.z * q.z);
+    mat->elem2D[1][2] = 2.0f * (q.y * q.z + q.w * q.x);
+
+    mat->elem2D[2][0] = 2.0f * (q.x * q.z + q.w * q.y);
+    mat->elem2D[2][1] = 2.0f * (q.y * q.z - q.w * q.x);
+    mat->elem2D[2][2] = 1.0f - 2.0f * (q.x * q.x + q.y * q.y);
+
+    mat->pos = shz_dualquat_translation(dq);
+}
+
+SHZ_INLINE void shz_dualquat_to_mat4x4(shz_dualquat_t dq, shz_mat4x4_t* mat) SHZ_NOEXCEPT {
+    shz_mat4x4_init_rotation_quat(mat, dq.real);
+    mat->pos.xyz = shz_dualquat_translation(dq);
+}
+
+SHZ_INLINE shz_dualquat_t shz_dualquat_normalize(shz_dualquat_t dq) SHZ_NOEXCEPT {
+    const float      inv  = shz_quat_magnitude_inv(dq.real);
+    const shz_quat_t real = shz_quat_scale(dq.real, inv);
+    const shz_quat_t dual = shz_quat_scale(dq.dual, inv);
+
+    return shz_dualquat_init(real, shz_quat_sub(dual, shz_quat_scale(real, shz_quat_dot(real, dual))));
+}
+
+SHZ_FORCE_INLINE shz_dualquat_t shz_dualquat_conjugate(shz_dualquat_t dq) SHZ_NOEXCEPT {
+    return shz_dualquat_init(shz_quat_conjugate(dq.real), shz_quat_conjugate(dq.dual));
+}
+
+SHZ_INLINE shz_dualquat_t shz_dualquat_inv(shz_dualquat_t dq) SHZ_NOEXCEPT {
+    // (r + εd)^-1 = r^-1 - ε r^-1 d r^-1
+    const shz_quat_t real = shz_quat_inv(dq.real);
+
+    return shz_dualquat_init(real, shz_quat_neg(shz_quat_mult(shz_quat_mult(real, dq.dual), real)));
+}
+
+SHZ_FORCE_INLINE shz_dualquat_t shz_dualquat_neg(shz_dualquat_t dq) SHZ_NOEXCEPT {
+    return shz_dualquat_init(shz_quat_neg(dq.real), shz_quat_neg(dq.dual));
+}
+
+SHZ_FORCE_INLINE shz_dualquat_t shz_dualquat_add(shz_dualquat_t a, shz_dualquat_t b) SHZ_NOEXCEPT {
+    return shz_dualquat_init(shz_quat_add(a.real, b.real), shz_quat_add(a.dual, b.dual));
+}
+
+SHZ_FORCE_INLINE shz_dualquat_t shz_dualquat_scale(shz_dualquat_t dq, float f) SHZ_NOEXCEPT {
+    return shz_dualquat_init(shz_quat_scale(dq.real, f), shz_quat_scale(dq.dual, f));
+}
+
+SHZ_INLINE shz_dualquat_t shz_dualquat_mult(shz_dualquat_t a, shz_dualquat_t b) SHZ_NOEXCEPT {
+    return shz_dualquat_init(shz_quat_mult(a.real, b.real),
+                             shz_quat_add(shz_quat_mult(a.real, b.dual),
+                                          shz_quat_mult(a.dual, b.real)));
+}
+
+SHZ_INLINE shz_dualquat_t shz_dualquat_nlerp(shz_dualquat_t a, shz_dualquat_t b, float t) SHZ_NOEXCEPT {
+    // Take the shortest path, since both signs represent the same transform.
+    const float wb = (shz_dualquat_dot(a, b) < 0.0f)? -t : t;
+
+    return shz_dualquat_normalize(shz_dualquat_add(shz_dualquat_scale(a, 1.0f - t),
+                                                   shz_dualquat_scale(b, wb)));
+}
+
+SHZ_FORCE_INLINE shz_vec3_t shz_dualquat_transform_vec3(shz_dualquat_t dq, shz_vec3_t v) SHZ_NOEXCEPT {
+    return shz_quat_transform_vec3(dq.real, v);
+}
+
+SHZ_INLINE shz_vec3_t shz_dualquat_transform_point3(shz_dualquat_t dq, shz_vec3_t p) SHZ_NOEXCEPT {
+    return shz_vec3_add(shz_quat_transform_vec3(dq.real, p), shz_dualquat_translation(dq));
+}
+
+//! \endcond
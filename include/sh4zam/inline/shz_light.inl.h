@@ -0,0 +1,66 @@
+//! \cond INTERNAL
+/*! \file
+    \brief Internal implementation of the Lighting API
+    \ingroup light
+
+    This file contains the implementation of the inline functions declared
+    within the Lighting API.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+SHZ_INLINE shz_light_t shz_light_init_directional(shz_vec3_t direction, shz_vec3_t color) SHZ_NOEXCEPT {
+    return SHZ_INIT(shz_light_t, .type        = SHZ_LIGHT_DIRECTIONAL,
+                                 .color       = color,
+                                 .position    = shz_vec3_fill(0.0f),
+                                 .direction   = direction,
+                                 .attenuation = shz_vec3_fill(0.0f),
+                                 .cos_inner   = 0.0f,
+                                 .cos_outer   = 0.0f);
+}
+
+SHZ_INLINE shz_light_t shz_light_init_point(shz_vec3_t position, shz_vec3_t color, shz_vec3_t attenuation) SHZ_NOEXCEPT {
+    return SHZ_INIT(shz_light_t, .type        = SHZ_LIGHT_POINT,
+                                 .color       = color,
+                                 .position    = position,
+                                 .direction   = shz_vec3_fill(0.0f),
+                                 .attenuation = attenuation,
+                                 .cos_inner   = 0.0f,
+                                 .cos_outer   = 0.0f);
+}
+
+SHZ_INLINE shz_light_t shz_light_init_spot(shz_vec3_t position,
+                                           shz_vec3_t direction,
+                                           shz_vec3_t color,
+                                           shz_vec3_t attenuation,
+                                           float      inner,
+                                           float      outer) SHZ_NOEXCEPT
+{
+    return SHZ_INIT(shz_light_t, .type        = SHZ_LIGHT_SPOT,
+                                 .color       = color,
+                                 .position    = position,
+                                 .direction   = direction,
+                                 .attenuation = attenuation,
+                                 .cos_inner   = shz_cosf(inner),
+                                 .cos_outer   = shz_cosf(outer));
+}
+
+// Exponential of a non-positive power, accurate to well within a single 8-bit step.
+SHZ_FORCE_INLINE float shz_light_exp_(float p) SHZ_NOEXCEPT {
+    return shz_saturatef(shz_expf_tier(p, SHZ_PRECISION_BALANCED));
+}
+
+SHZ_INLINE float shz_fog_factor(const shz_fog_t* fog, float depth) SHZ_NOEXCEPT {
+    switch(fog->mode) {
+    case SHZ_FOG_LINEAR:
+        return shz_saturatef(shz_divf(fog->end - depth, fog->end - fog->start));
+    case SHZ_FOG_EXP:
+        return shz_light_exp_(-fog->density * shz_fmaxf(depth, 0.0f));
+    default:
+        return 1.0f;
+    }
+}
+
+//! \endcond
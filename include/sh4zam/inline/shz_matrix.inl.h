@@ -15,6 +15,8 @@
 
 #if SHZ_BACKEND == SHZ_SH4
 #   include "sh4/shz_matrix_sh4.inl.h"
+#elif SHZ_BACKEND == SHZ_X86
+#   include "x86/shz_matrix_x86.inl.h"
 #else
 #   include "sw/shz_matrix_sw.inl.h"
 #endif
@@ -524,6 +526,8 @@ SHZ_INLINE shz_vec2_t shz_mat4x4_transform_point2_transpose(const shz_mat4x4_t*
 SHZ_INLINE shz_vec3_t shz_mat4x4_transform_vec3(const shz_mat4x4_t* mat, shz_vec3_t v) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     return shz_mat4x4_transform_vec3_sh4(mat, v);
+#elif SHZ_BACKEND == SHZ_X86
+    return shz_mat4x4_transform_vec3_x86(mat, v);
 #else
     return shz_mat4x4_transform_vec3_sw(mat, v);
 #endif
@@ -532,6 +536,8 @@ SHZ_INLINE shz_vec3_t shz_mat4x4_transform_vec3(const shz_mat4x4_t* mat, shz_vec
 SHZ_INLINE shz_vec4_t shz_mat4x4_transform_vec4(const shz_mat4x4_t* mat, shz_vec4_t v) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     return shz_mat4x4_transform_vec4_sh4(mat, v);
+#elif SHZ_BACKEND == SHZ_X86
+    return shz_mat4x4_transform_vec4_x86(mat, v);
 #else
     return shz_mat4x4_transform_vec4_sw(mat, v);
 #endif
@@ -540,6 +546,8 @@ SHZ_INLINE shz_vec4_t shz_mat4x4_transform_vec4(const shz_mat4x4_t* mat, shz_vec
 SHZ_INLINE shz_vec4_t shz_mat4x4_transform_vec4_transpose(const shz_mat4x4_t* mat, shz_vec4_t v) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     return shz_mat4x4_transform_vec4_transpose_sh4(mat, v);
+#elif SHZ_BACKEND == SHZ_X86
+    return shz_mat4x4_transform_vec4_transpose_x86(mat, v);
 #else
     return shz_mat4x4_transform_vec4_transpose_sw(mat, v);
 #endif
@@ -548,6 +556,8 @@ SHZ_INLINE shz_vec4_t shz_mat4x4_transform_vec4_transpose(const shz_mat4x4_t* ma
 SHZ_INLINE shz_vec3_t shz_mat4x4_transform_vec3_transpose(const shz_mat4x4_t* mat, shz_vec3_t v) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     return shz_mat4x4_transform_vec3_transpose_sh4(mat, v);
+#elif SHZ_BACKEND == SHZ_X86
+    return shz_mat4x4_transform_vec3_transpose_x86(mat, v);
 #else
     return shz_mat4x4_transform_vec3_transpose_sw(mat, v);
 #endif
@@ -626,20 +636,20 @@ SHZ_INLINE float shz_mat4x4_determinant(const shz_mat4x4_t* mat) SHZ_NOEXCEPT {
 	const float (*m)[4] = mat->elem2D;
 
 #if 0 // Cache the subfactors
-    float s0 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
-    float s1 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
-    float s2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+    float s0 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+    float s1 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+    float s2 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
 
     float s3 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
     float s4 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
     float s5 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
 #else // FIPR da subfactors
-    shz_vec2_t s01 = shz_vec2_dot2(shz_vec2_init(m[2][1], -m[3][1]),
+    shz_vec2_t s12 = shz_vec2_dot2(shz_vec2_init(m[2][1], -m[3][1]),
                                    shz_vec2_init(m[3][3],  m[2][3]),
                                    shz_vec2_init(m[3][2],  m[2][2]));
-    float s0 = s01.x;
-    float s1 = s01.y;
-    float s2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+    float s0 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+    float s1 = s12.x;
+    float s2 = s12.y;
 
     shz_vec3_t s345 = shz_vec2_dot3(shz_vec2_init(m[2][0], -m[3][0]),
                                     shz_vec2_init(m[3][3],  m[2][3]),
@@ -662,6 +672,8 @@ SHZ_INLINE float shz_mat4x4_determinant(const shz_mat4x4_t* mat) SHZ_NOEXCEPT {
 SHZ_INLINE void shz_mat4x4_copy(shz_mat4x4_t* dst, const shz_mat4x4_t* src) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     shz_mat4x4_copy_sh4(dst, src);
+#elif SHZ_BACKEND == SHZ_X86
+    shz_mat4x4_copy_x86(dst, src);
 #else
     shz_mat4x4_copy_sw(dst, src);
 #endif
@@ -670,6 +682,8 @@ SHZ_INLINE void shz_mat4x4_copy(shz_mat4x4_t* dst, const shz_mat4x4_t* src) SHZ_
 SHZ_INLINE void shz_mat4x4_swap(shz_mat4x4_t* matA, shz_mat4x4_t* matB) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     shz_mat4x4_swap_sh4(matA, matB);
+#elif SHZ_BACKEND == SHZ_X86
+    shz_mat4x4_swap_x86(matA, matB);
 #else
     shz_mat4x4_swap_sw(matA, matB);
 #endif
@@ -683,6 +697,8 @@ SHZ_INLINE void shz_mat4x4_copy_unaligned(shz_mat4x4_t* dst, const float src[16]
 SHZ_INLINE shz_vec3_t shz_mat3x3_transform_vec3(const shz_mat3x3_t* mat, shz_vec3_t v) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     return shz_mat3x3_transform_vec3_sh4(mat, v);
+#elif SHZ_BACKEND == SHZ_X86
+    return shz_mat3x3_transform_vec3_x86(mat, v);
 #else
     return shz_mat3x3_transform_vec3_sw(mat, v);
 #endif
@@ -15,6 +15,8 @@
 
 #if SHZ_BACKEND == SHZ_SH4
 #   include "sh4/shz_quat_sh4.inl.h"
+#elif SHZ_BACKEND == SHZ_X86
+#   include "x86/shz_quat_x86.inl.h"
 #else
 #   include "sw/shz_quat_sw.inl.h"
 #endif
@@ -253,6 +255,8 @@ SHZ_INLINE shz_quat_t shz_quat_rotate_towards(shz_quat_t from, shz_quat_t to, fl
 SHZ_INLINE shz_quat_t shz_quat_mult(shz_quat_t q1, shz_quat_t q2) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     return shz_quat_mult_sh4(q1, q2);
+#elif SHZ_BACKEND == SHZ_X86
+    return shz_quat_mult_x86(q1, q2);
 #else
     return shz_quat_mult_sw(q1, q2);
 #endif
@@ -265,6 +269,8 @@ SHZ_INLINE shz_quat_t shz_quat_div(shz_quat_t q, shz_quat_t p) SHZ_NOEXCEPT {
 SHZ_INLINE shz_vec3_t shz_quat_transform_vec3(shz_quat_t q, shz_vec3_t v) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     return shz_quat_transform_vec3_sh4(q, v);
+#elif SHZ_BACKEND == SHZ_X86
+    return shz_quat_transform_vec3_x86(q, v);
 #else
     return shz_quat_transform_vec3_sw(q, v);
 #endif
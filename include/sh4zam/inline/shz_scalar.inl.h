@@ -136,11 +136,8 @@ SHZ_FORCE_INLINE float shz_cbrt_newton1(float x, float z) SHZ_NOEXCEPT {
     return z - (num * rden * rden);
 }
 
-SHZ_FORCE_INLINE float shz_cbrtf(float x) SHZ_NOEXCEPT {
-#ifdef SHZ_GNUC
-    if(__builtin_constant_p(x))
-        return __builtin_cbrtf(x);
-#endif
+// Tiered cbrtf(): FAST and BALANCED refine the magic guess 2 or 3 times, PRECISE finishes with a true division.
+SHZ_FORCE_INLINE float shz_cbrtf_tier(float x, int tier) SHZ_NOEXCEPT {
     if(x == 0.0f)
         return 0.0f;
 
@@ -153,9 +150,22 @@ SHZ_FORCE_INLINE float shz_cbrtf(float x) SHZ_NOEXCEPT {
     z = shz_cbrt_newton1(x, z);
     z = shz_cbrt_newton1(x, z);
 
+    if(tier == SHZ_PRECISION_BALANCED)
+        z = shz_cbrt_newton1(x, z);
+    else if(tier == SHZ_PRECISION_PRECISE)
+        z -= (z * z * z - x) / (3.0f * z * z);
+
     return z;
 }
 
+SHZ_FORCE_INLINE float shz_cbrtf(float x) SHZ_NOEXCEPT {
+#ifdef SHZ_GNUC
+    if(__builtin_constant_p(x))
+        return __builtin_cbrtf(x);
+#endif
+    return shz_cbrtf_tier(x, SHZ_PRECISION);
+}
+
 SHZ_FORCE_INLINE float shz_remainderf(float num, float denom) SHZ_NOEXCEPT {
 #ifdef SHZ_GNUC
     if(__builtin_constant_p(num) && __builtin_constant_p(denom))
@@ -417,19 +427,154 @@ SHZ_FORCE_INLINE float shz_mag_sqr4f(float x, float y, float z, float w) SHZ_NOE
 #endif
 }
 
-SHZ_FORCE_INLINE float shz_log2f(float x) SHZ_NOEXCEPT {
-#ifdef SHZ_GNUC
-    if(__builtin_constant_p(x))
-        return __builtin_log2f(x);
-#endif
-    const union {
+/* Tiered implementations of the transcendental functions, which take the
+   precision tier as an argument, so that it is folded away when constant.
+   BALANCED and PRECISE split their argument into an exponent and a mantissa
+   (or fraction), then evaluate minimax polynomials over the reduced range. */
+
+SHZ_FORCE_INLINE float shz_log2f_tier(float x, int tier) SHZ_NOEXCEPT {
+    union {
         float    f;
         uint32_t i;
     } vx = { x };
 
-    const float y = (float)(vx.i) * 1.1920928955078125e-7f;
+    if(tier == SHZ_PRECISION_FAST) {
+        const float y = (float)(vx.i) * 1.1920928955078125e-7f;
+
+        return y - 126.94269504f;
+    }
+
+    // x = 2^e * m, where m is within [sqrt(0.5), sqrt(2)).
+    const int32_t e = (int32_t)(vx.i - 0x3f3504f3u) >> 23;
+    vx.i -= (uint32_t)e << 23;
+
+    const float f = vx.f - 1.0f;
+    float p;
+
+    if(tier == SHZ_PRECISION_BALANCED) {
+        p = shz_fmaf(f, 2.611699265e-01f, -3.924614504e-01f);
+        p = shz_fmaf(f, p,  4.846482835e-01f);
+        p = shz_fmaf(f, p, -7.204624302e-01f);
+        p = shz_fmaf(f, p,  1.442655846e+00f);
+    } else {
+        p = shz_fmaf(f, 1.292641900e-01f, -2.089337273e-01f);
+        p = shz_fmaf(f, p,  2.152122513e-01f);
+        p = shz_fmaf(f, p, -2.386756939e-01f);
+        p = shz_fmaf(f, p,  2.879390962e-01f);
+        p = shz_fmaf(f, p, -3.607162632e-01f);
+        p = shz_fmaf(f, p,  4.809102797e-01f);
+        p = shz_fmaf(f, p, -7.213471993e-01f);
+        p = shz_fmaf(f, p,  1.442695005e+00f);
+    }
+
+    return shz_fmaf(f, p, (float)e);
+}
+
+// Returns 2^n for an integral n within [-126, 127], by building its exponent directly.
+SHZ_FORCE_INLINE float shz_pow2f_int(float n) SHZ_NOEXCEPT {
+    const union {
+        uint32_t i;
+        float    f;
+    } v = {
+        (uint32_t)((int32_t)n + 127) << 23
+    };
+
+    return v.f;
+}
+
+// https://github.com/appleseedhq/appleseed/blob/master/src/appleseed/foundation/math/fastmath.h
+SHZ_FORCE_INLINE float shz_pow2f_tier(float p, int tier) SHZ_NOEXCEPT {
+    // Underflow of exponential is common practice in numerical routines, so handle it here, along with overflow.
+    const float clipp = p < -126.0f ? -126.0f : (p > 128.0f ? 128.0f : p);
+
+    if(tier == SHZ_PRECISION_FAST) {
+        const union {
+            uint32_t i;
+            float    f;
+        } v = {
+            (uint32_t)((1 << 23) * (clipp + 126.94269504f))
+        };
+
+        return v.f;
+    }
+
+    // 2^p = 2^n * 2^f, where n is the nearest integer, and f is within [-0.5, 0.5].
+    const float n = shz_floorf((clipp < 127.0f ? clipp : 127.0f) + 0.5f);
+    const float f = clipp - n;
+    float r;
+
+    if(tier == SHZ_PRECISION_BALANCED) {
+        r = shz_fmaf(f, 5.517166722e-02f, 2.426111221e-01f);
+        r = shz_fmaf(f, r, 6.932609858e-01f);
+        r = shz_fmaf(f, r, 9.999280736e-01f);
+    } else {
+        r = shz_fmaf(f, 1.534580624e-04f, 1.339993097e-03f);
+        r = shz_fmaf(f, r, 9.618488977e-03f);
+        r = shz_fmaf(f, r, 5.550328778e-02f);
+        r = shz_fmaf(f, r, 2.402264689e-01f);
+        r = shz_fmaf(f, r, 6.931472057e-01f);
+        r = shz_fmaf(f, r, 1.000000001e+00f);
+    }
 
-    return y - 126.94269504f;
+    return r * shz_pow2f_int(n);
+}
+
+SHZ_FORCE_INLINE float shz_log10f_tier(float x, int tier) SHZ_NOEXCEPT {
+    return shz_log2f_tier(x, tier) * 0.3010299956639812f;
+}
+
+SHZ_FORCE_INLINE float shz_logf_tier(float x, int tier) SHZ_NOEXCEPT {
+    return 0.69314718f * shz_log2f_tier(x, tier);
+}
+
+SHZ_FORCE_INLINE float shz_expf_tier(float p, int tier) SHZ_NOEXCEPT {
+    if(tier == SHZ_PRECISION_PRECISE) {
+        // Cody-Waite reduction by whole multiples of ln(2), so rounding log2(e) * p doesn't scale the error.
+        // Anything past ln(FLT_MAX) overflows, while p is clamped below to -126 * ln(2), leaving n within [-126, 128].
+        if(p > 88.7228317f)
+            return INFINITY;
+
+        p = p < -87.33654475f ? -87.33654475f : p;
+
+        const float n = shz_floorf(1.442695040f * p + 0.5f);
+        const float h = shz_floorf(n * 0.5f);
+        const float r = (p - n * 6.93145752e-1f) - n * 1.42860677e-6f;
+
+        // 2^n is applied in two halves, since 2^128 is not representable on its own.
+        return shz_pow2f_tier(1.442695040f * r, tier) * shz_pow2f_int(h) * shz_pow2f_int(n - h);
+    }
+
+    return shz_pow2f_tier(1.442695040f * p, tier);
+}
+
+SHZ_FORCE_INLINE float shz_pow10f_tier(float p, int tier) SHZ_NOEXCEPT {
+    if(tier == SHZ_PRECISION_PRECISE) {
+        // Same as expf(), except by whole multiples of log10(2), overflowing past log10(FLT_MAX).
+        if(p > 38.5318375f)
+            return INFINITY;
+
+        p = p < -37.92977945f ? -37.92977945f : p;
+
+        const float n = shz_floorf(3.321928095f * p + 0.5f);
+        const float h = shz_floorf(n * 0.5f);
+        const float r = (p - n * 3.01025390625e-1f) - n * 4.605038983e-6f;
+
+        return shz_pow2f_tier(3.321928095f * r, tier) * shz_pow2f_int(h) * shz_pow2f_int(n - h);
+    }
+
+    return shz_expf_tier(2.302585092994046f * p, tier);
+}
+
+SHZ_FORCE_INLINE float shz_powf_tier(float x, float p, int tier) SHZ_NOEXCEPT {
+    return shz_pow2f_tier(p * shz_log2f_tier(x, tier), tier);
+}
+
+SHZ_FORCE_INLINE float shz_log2f(float x) SHZ_NOEXCEPT {
+#ifdef SHZ_GNUC
+    if(__builtin_constant_p(x))
+        return __builtin_log2f(x);
+#endif
+    return shz_log2f_tier(x, SHZ_PRECISION);
 }
 
 SHZ_FORCE_INLINE float shz_log10f(float x) SHZ_NOEXCEPT {
@@ -437,7 +582,7 @@ SHZ_FORCE_INLINE float shz_log10f(float x) SHZ_NOEXCEPT {
     if(__builtin_constant_p(x))
         return __builtin_log10f(x);
 #endif
-    return shz_log2f(x) * 0.3010299956639812f;
+    return shz_log10f_tier(x, SHZ_PRECISION);
 }
 
 SHZ_FORCE_INLINE float shz_logf(float x) SHZ_NOEXCEPT {
@@ -445,26 +590,15 @@ SHZ_FORCE_INLINE float shz_logf(float x) SHZ_NOEXCEPT {
     if(__builtin_constant_p(x))
         return __builtin_logf(x);
 #endif
-    return 0.69314718f * shz_log2f(x);
+    return shz_logf_tier(x, SHZ_PRECISION);
 }
 
-// https://github.com/appleseedhq/appleseed/blob/master/src/appleseed/foundation/math/fastmath.h
 SHZ_FORCE_INLINE float shz_pow2f(float p) SHZ_NOEXCEPT {
 #ifdef SHZ_GNUC
     if(__builtin_constant_p(p))
         return __builtin_powf(2.0f, p);
 #endif
-    // Underflow of exponential is common practice in numerical routines, so handle it here.
-    const float clipp = p < -126.0f ? -126.0f : p;
-
-    const union {
-        uint32_t i;
-        float    f;
-    } v = {
-        (uint32_t)((1 << 23) * (clipp + 126.94269504f))
-    };
-
-    return v.f;
+    return shz_pow2f_tier(p, SHZ_PRECISION);
 }
 
 SHZ_FORCE_INLINE float shz_pow10f(float p) SHZ_NOEXCEPT {
@@ -472,7 +606,7 @@ SHZ_FORCE_INLINE float shz_pow10f(float p) SHZ_NOEXCEPT {
     if(__builtin_constant_p(p))
         return __builtin_powf(10.0f, p);
 #endif
-    return shz_expf(2.302585092994046f * p);
+    return shz_pow10f_tier(p, SHZ_PRECISION);
 }
 
 SHZ_FORCE_INLINE float shz_powf(float x, float p) SHZ_NOEXCEPT {
@@ -480,7 +614,7 @@ SHZ_FORCE_INLINE float shz_powf(float x, float p) SHZ_NOEXCEPT {
     if(__builtin_constant_p(x) && __builtin_constant_p(p))
         return __builtin_powf(x, p);
 #endif
-    return shz_pow2f(p * shz_log2f(x));
+    return shz_powf_tier(x, p, SHZ_PRECISION);
 }
 
 SHZ_FORCE_INLINE float shz_expf(float p) SHZ_NOEXCEPT {
@@ -488,7 +622,7 @@ SHZ_FORCE_INLINE float shz_expf(float p) SHZ_NOEXCEPT {
     if(__builtin_constant_p(p))
         return __builtin_expf(p);
 #endif
-    return shz_pow2f(1.442695040f * p);
+    return shz_expf_tier(p, SHZ_PRECISION);
 }
 
 SHZ_FORCE_INLINE float shz_randf(int* seed) SHZ_NOEXCEPT {
@@ -0,0 +1,142 @@
+//! \cond INTERNAL
+/*! \file
+    \brief Internal implementation of the Transform API
+    \ingroup transform
+
+    This file contains the implementation of the inline functions declared
+    within the Transform API, which dispatch upon the kind of each operand.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+SHZ_FORCE_INLINE void shz_transform_init_identity(shz_transform_t* xf) SHZ_NOEXCEPT {
+    xf->matrix.col[0] = shz_vec4_init(1.0f, 0.0f, 0.0f, 0.0f);
+    xf->matrix.col[1] = shz_vec4_init(0.0f, 1.0f, 0.0f, 0.0f);
+    xf->matrix.col[2] = shz_vec4_init(0.0f, 0.0f, 1.0f, 0.0f);
+    xf->matrix.col[3] = shz_vec4_init(0.0f, 0.0f, 0.0f, 1.0f);
+    xf->kind          = SHZ_TRANSFORM_IDENTITY;
+}
+
+SHZ_FORCE_INLINE void shz_transform_init_translation(shz_transform_t* xf, float x, float y, float z) SHZ_NOEXCEPT {
+    shz_transform_init_identity(xf);
+    xf->matrix.pos = shz_vec4_init(x, y, z, 1.0f);
+    xf->kind       = SHZ_TRANSFORM_TRANSLATION;
+}
+
+SHZ_FORCE_INLINE void shz_transform_init_scale(shz_transform_t* xf, float x, float y, float z) SHZ_NOEXCEPT {
+    xf->matrix.col[0] = shz_vec4_init(x,    0.0f, 0.0f, 0.0f);
+    xf->matrix.col[1] = shz_vec4_init(0.0f, y,    0.0f, 0.0f);
+    xf->matrix.col[2] = shz_vec4_init(0.0f, 0.0f, z,    0.0f);
+    xf->matrix.col[3] = shz_vec4_init(0.0f, 0.0f, 0.0f, 1.0f);
+    xf->kind          = SHZ_TRANSFORM_DIAGONAL;
+}
+
+SHZ_FORCE_INLINE void shz_transform_init_rotation_quat(shz_transform_t* xf, shz_quat_t q) SHZ_NOEXCEPT {
+    shz_mat4x4_init_rotation_quat(&xf->matrix, q);
+    xf->kind = SHZ_TRANSFORM_RIGID;
+}
+
+SHZ_FORCE_INLINE void shz_transform_init_rigid(shz_transform_t* xf, shz_quat_t q, shz_vec3_t t) SHZ_NOEXCEPT {
+    shz_mat4x4_init_rotation_quat(&xf->matrix, q);
+    xf->matrix.pos = shz_vec3_vec4(t, 1.0f);
+    xf->kind       = SHZ_TRANSFORM_RIGID;
+}
+
+SHZ_INLINE void shz_transform_init_perspective(shz_transform_t* xf, float fov, float aspect, float znear) SHZ_NOEXCEPT {
+    const shz_sincos_t sc  = shz_sincosf(fov * 0.5f);
+    const float        cot = shz_divf(sc.cos, sc.sin);
+
+    xf->matrix.col[0] = shz_vec4_init(shz_divf(cot, aspect), 0.0f, 0.0f,  0.0f);
+    xf->matrix.col[1] = shz_vec4_init(0.0f,                  cot,  0.0f,  0.0f);
+    xf->matrix.col[2] = shz_vec4_init(0.0f,                  0.0f, 0.0f, -1.0f);
+    xf->matrix.col[3] = shz_vec4_init(0.0f,                  0.0f, znear, 0.0f);
+    xf->kind          = SHZ_TRANSFORM_PROJECTIVE;
+}
+
+SHZ_INLINE shz_transform_kind_t shz_transform_kind_mult(shz_transform_kind_t lhs, shz_transform_kind_t rhs) SHZ_NOEXCEPT {
+    if(lhs == SHZ_TRANSFORM_IDENTITY || lhs == rhs)
+        return rhs;
+
+    if(rhs == SHZ_TRANSFORM_IDENTITY)
+        return lhs;
+
+    if(lhs == SHZ_TRANSFORM_PROJECTIVE || rhs == SHZ_TRANSFORM_PROJECTIVE)
+        return SHZ_TRANSFORM_PROJECTIVE;
+
+    // Translations and rotations compose into rigid transforms, while anything scaled is merely affine.
+    if((lhs == SHZ_TRANSFORM_TRANSLATION || lhs == SHZ_TRANSFORM_RIGID) &&
+       (rhs == SHZ_TRANSFORM_TRANSLATION || rhs == SHZ_TRANSFORM_RIGID))
+        return SHZ_TRANSFORM_RIGID;
+
+    return SHZ_TRANSFORM_AFFINE;
+}
+
+SHZ_INLINE float shz_transform_determinant(const shz_transform_t* xf) SHZ_NOEXCEPT {
+    switch(xf->kind) {
+    case SHZ_TRANSFORM_IDENTITY:
+    case SHZ_TRANSFORM_TRANSLATION:
+    case SHZ_TRANSFORM_RIGID:
+        return 1.0f;
+    case SHZ_TRANSFORM_DIAGONAL:
+        return xf->matrix.elem2D[0][0] * xf->matrix.elem2D[1][1] * xf->matrix.elem2D[2][2];
+    case SHZ_TRANSFORM_AFFINE:
+        return shz_mat4x4_3x3_determinant(&xf->matrix);
+    default:
+        return shz_mat4x4_determinant(&xf->matrix);
+    }
+}
+
+SHZ_INLINE shz_vec3_t shz_transform_point3(const shz_transform_t* xf, shz_vec3_t pt) SHZ_NOEXCEPT {
+    switch(xf->kind) {
+    case SHZ_TRANSFORM_IDENTITY:
+        return pt;
+    case SHZ_TRANSFORM_TRANSLATION:
+        return shz_vec3_add(pt, xf->matrix.pos.xyz);
+    case SHZ_TRANSFORM_DIAGONAL:
+        return shz_vec3_mul(pt, shz_vec3_init(xf->matrix.elem2D[0][0],
+                                              xf->matrix.elem2D[1][1],
+                                              xf->matrix.elem2D[2][2]));
+    case SHZ_TRANSFORM_RIGID:
+    case SHZ_TRANSFORM_AFFINE:
+        return shz_vec3_add(shz_mat4x4_transform_vec3(&xf->matrix, pt), xf->matrix.pos.xyz);
+    default:
+        return shz_mat4x4_transform_point3(&xf->matrix, pt);
+    }
+}
+
+SHZ_INLINE shz_vec3_t shz_transform_vec3(const shz_transform_t* xf, shz_vec3_t v) SHZ_NOEXCEPT {
+    switch(xf->kind) {
+    case SHZ_TRANSFORM_IDENTITY:
+    case SHZ_TRANSFORM_TRANSLATION:
+        return v;
+    case SHZ_TRANSFORM_DIAGONAL:
+        return shz_vec3_mul(v, shz_vec3_init(xf->matrix.elem2D[0][0],
+                                             xf->matrix.elem2D[1][1],
+                                             xf->matrix.elem2D[2][2]));
+    default:
+        return shz_mat4x4_transform_vec3(&xf->matrix, v);
+    }
+}
+
+SHZ_INLINE shz_vec4_t shz_transform_vec4(const shz_transform_t* xf, shz_vec4_t v) SHZ_NOEXCEPT {
+    switch(xf->kind) {
+    case SHZ_TRANSFORM_IDENTITY:
+        return v;
+    case SHZ_TRANSFORM_TRANSLATION:
+        return shz_vec4_add(v, shz_vec4_init(xf->matrix.pos.x * v.w,
+                                             xf->matrix.pos.y * v.w,
+                                             xf->matrix.pos.z * v.w,
+                                             0.0f));
+    case SHZ_TRANSFORM_DIAGONAL:
+        return shz_vec4_mul(v, shz_vec4_init(xf->matrix.elem2D[0][0],
+                                             xf->matrix.elem2D[1][1],
+                                             xf->matrix.elem2D[2][2],
+                                             1.0f));
+    default:
+        return shz_mat4x4_transform_vec4(&xf->matrix, v);
+    }
+}
+
+//! \endcond
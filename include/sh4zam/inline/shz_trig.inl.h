@@ -146,15 +146,61 @@ SHZ_FORCE_INLINE float shz_cotf_deg(float degrees) SHZ_NOEXCEPT {
     return shz_sincos_cotf(shz_sincosf_deg(degrees));
 }
 
+/* Tiered implementations of the inverse trig functions, which take the
+   precision tier as an argument, so that it is folded away when constant.
+   Arctangents share a minimax polynomial over [-1, 1] whose degree depends
+   on the tier, while the PRECISE arcsine and arccosine follow Cephes. */
+
+SHZ_FORCE_INLINE float shz_atanf_unit_tier(float x, int tier) SHZ_NOEXCEPT {
+    const float z = x * x;
+    float p;
+
+    if(tier == SHZ_PRECISION_FAST) {
+        const float n1 = 0.97239411f;
+        const float n2 = -0.19194795f;
+
+        p = shz_fmaf(n2, z, n1);
+    } else if(tier == SHZ_PRECISION_BALANCED) {
+        p = shz_fmaf(z, 2.084510438e-02f, -8.515632913e-02f);
+        p = shz_fmaf(z, p,  1.801592787e-01f);
+        p = shz_fmaf(z, p, -3.303047812e-01f);
+        p = shz_fmaf(z, p,  9.998663292e-01f);
+    } else {
+        p = shz_fmaf(z, 2.462421523e-03f, -1.442620368e-02f);
+        p = shz_fmaf(z, p,  3.982596923e-02f);
+        p = shz_fmaf(z, p, -7.239147555e-02f);
+        p = shz_fmaf(z, p,  1.050129799e-01f);
+        p = shz_fmaf(z, p, -1.416196400e-01f);
+        p = shz_fmaf(z, p,  1.998602918e-01f);
+        p = shz_fmaf(z, p, -3.333260624e-01f);
+        p = shz_fmaf(z, p,  9.999998884e-01f);
+    }
+
+    return p * x;
+}
+
 SHZ_FORCE_INLINE float shz_atanf_unit(float x) SHZ_NOEXCEPT {
-    const float n1 = 0.97239411f;
-    const float n2 = -0.19194795f;
+    return shz_atanf_unit_tier(x, SHZ_PRECISION);
+}
+
+SHZ_FORCE_INLINE float shz_atanf_q1_tier(float x, int tier) SHZ_NOEXCEPT {
+    if(tier == SHZ_PRECISION_PRECISE)
+        return 1.57079633f - shz_atanf_unit_tier(1.0f / shz_fabsf(x), tier);
 
-    return shz_fmaf(n2, x * x, n1) * x;
+    return SHZ_F_PI_2 - shz_atanf_unit_tier(shz_invf_fsrra(x), tier);
 }
 
 SHZ_INLINE float shz_atanf_q1(float x) SHZ_NOEXCEPT {
-    return SHZ_F_PI_2 - shz_atanf_unit(shz_invf_fsrra(x));
+    return shz_atanf_q1_tier(x, SHZ_PRECISION);
+}
+
+SHZ_FORCE_INLINE float shz_atanf_tier(float x, int tier) SHZ_NOEXCEPT {
+    if(x > 1.0f)
+	    return shz_atanf_q1_tier(x, tier);
+    else if(x < -1.0f)
+        return -shz_atanf_q1_tier(x, tier);
+    else
+        return shz_atanf_unit_tier(x, tier);
 }
 
 SHZ_INLINE float shz_atanf(float x) SHZ_NOEXCEPT {
@@ -162,12 +208,51 @@ SHZ_INLINE float shz_atanf(float x) SHZ_NOEXCEPT {
     if(__builtin_constant_p(x))
         return __builtin_atanf(x);
 #endif
-    if(x > 1.0f)
-	    return shz_atanf_q1(x);
-    else if(x < -1.0f)
-        return -shz_atanf_q1(x);
-    else
-        return shz_atanf_unit(x);
+    return shz_atanf_tier(x, SHZ_PRECISION);
+}
+
+SHZ_FORCE_INLINE float shz_atan2f_tier(float y, float x, int tier) SHZ_NOEXCEPT {
+    if(tier == SHZ_PRECISION_FAST) {
+        float angle = SHZ_F_PI_2;
+        float r = x;
+        float abs_sum = shz_fabsf(y);
+
+        if(x <= 0.0f) {
+            if(SHZ_UNLIKELY(x == 0.0f && y == 0.0f))
+                return 0.0f;
+
+            angle += SHZ_F_PI_4;
+            r += abs_sum;
+            abs_sum -= x;
+        } else {
+            angle -= SHZ_F_PI_4;
+            r -= abs_sum;
+            abs_sum += x;
+        }
+
+        r *= shz_invf_fsrra(abs_sum);
+        angle += shz_fmaf(0.1963f, r * r, -0.9817f) * r;
+
+        return shz_copysignf(angle, y);
+    }
+
+    const float abs_x = shz_fabsf(x);
+    const float abs_y = shz_fabsf(y);
+    const float num   = shz_fminf(abs_x, abs_y);
+    const float denom = shz_fmaxf(abs_x, abs_y);
+
+    if(SHZ_UNLIKELY(denom == 0.0f))
+        return 0.0f;
+
+    const float ratio = (tier == SHZ_PRECISION_PRECISE)? num / denom : shz_divf_fsrra(num, denom);
+    float angle = shz_atanf_unit_tier(ratio, tier);
+
+    if(abs_y > abs_x)
+        angle = 1.57079633f - angle;
+    if(x < 0.0f)
+        angle = 3.14159265f - angle;
+
+    return shz_copysignf(angle, y);
 }
 
 SHZ_INLINE float shz_atan2f(float y, float x) SHZ_NOEXCEPT {
@@ -175,36 +260,57 @@ SHZ_INLINE float shz_atan2f(float y, float x) SHZ_NOEXCEPT {
     if(__builtin_constant_p(y) && __builtin_constant_p(x))
         return __builtin_atan2f(y, x);
 #endif
-    float angle = SHZ_F_PI_2;
-    float r = x;
-    float abs_sum = shz_fabsf(y);
+    return shz_atan2f_tier(y, x, SHZ_PRECISION);
+}
 
-    if(x <= 0.0f) {
-        if(SHZ_UNLIKELY(x == 0.0f && y == 0.0f))
-            return 0.0f;
+// Cephes asinf() polynomial over [0, 0.5], evaluated with z = x^2.
+SHZ_FORCE_INLINE float shz_asinf_poly(float x, float z) SHZ_NOEXCEPT {
+    float p = shz_fmaf(z, 4.2163199048e-2f, 2.4181311049e-2f);
+    p = shz_fmaf(z, p, 4.5470025998e-2f);
+    p = shz_fmaf(z, p, 7.4953002686e-2f);
+    p = shz_fmaf(z, p, 1.6666752422e-1f);
 
-        angle += SHZ_F_PI_4;
-        r += abs_sum;
-        abs_sum -= x;
+    return shz_fmaf(p * z, x, x);
+}
+
+SHZ_FORCE_INLINE float shz_asinf_tier(float x, int tier) SHZ_NOEXCEPT {
+    if(tier != SHZ_PRECISION_PRECISE)
+        return shz_atanf_tier(x * shz_inv_sqrtf_fsrra(1.0f - (x * x)), tier);
+
+    const float a = shz_fabsf(x);
+    float angle;
+
+    if(a > 0.5f) {
+        const float z = 0.5f * (1.0f - a);
+        angle = 1.57079633f - 2.0f * shz_asinf_poly(sqrtf(z), z);
     } else {
-        angle -= SHZ_F_PI_4;
-        r -= abs_sum;
-        abs_sum += x;
+        angle = shz_asinf_poly(a, a * a);
     }
 
-    r *= shz_invf_fsrra(abs_sum);
-    angle += shz_fmaf(0.1963f, r * r, -0.9817f) * r;
-
-    return shz_copysignf(angle, y);
+    return shz_copysignf(angle, x);
 }
 
-
 SHZ_INLINE float shz_asinf(float x) SHZ_NOEXCEPT {
 #ifdef SHZ_GNUC
     if(__builtin_constant_p(x))
         return __builtin_asinf(x);
 #endif
-    return shz_atanf(x * shz_inv_sqrtf_fsrra(1.0f - (x * x)));
+    return shz_asinf_tier(x, SHZ_PRECISION);
+}
+
+SHZ_FORCE_INLINE float shz_acosf_tier(float x, int tier) SHZ_NOEXCEPT {
+    if(tier != SHZ_PRECISION_PRECISE)
+        return SHZ_F_PI_2 - shz_asinf_tier(x, tier);
+
+    if(x < -0.5f) {
+        const float z = 0.5f * (1.0f + x);
+        return 3.14159265f - 2.0f * shz_asinf_poly(sqrtf(z), z);
+    } else if(x > 0.5f) {
+        const float z = 0.5f * (1.0f - x);
+        return 2.0f * shz_asinf_poly(sqrtf(z), z);
+    } else {
+        return 1.57079633f - shz_asinf_poly(x, x * x);
+    }
 }
 
 SHZ_INLINE float shz_acosf(float x) SHZ_NOEXCEPT {
@@ -212,7 +318,7 @@ SHZ_INLINE float shz_acosf(float x) SHZ_NOEXCEPT {
     if(__builtin_constant_p(x))
         return __builtin_acosf(x);
 #endif
-    return SHZ_F_PI_2 - shz_asinf(x);
+    return shz_acosf_tier(x, SHZ_PRECISION);
 }
 
 SHZ_INLINE float shz_asecf(float x) SHZ_NOEXCEPT {
@@ -239,12 +345,53 @@ SHZ_INLINE float shz_acotf(float x) SHZ_NOEXCEPT {
     return shz_atanf(shz_invf(x));
 }
 
+/* Tiered implementations of the hyperbolic functions, which inherit the
+   accuracy of the tiered exponential and logarithm they are built on. The
+   PRECISE tier additionally switches to Cephes polynomials near zero, where
+   subtracting exponentials would cancel. */
+
+SHZ_FORCE_INLINE float shz_sinhf_tier(float x, int tier) SHZ_NOEXCEPT {
+    if(tier == SHZ_PRECISION_PRECISE && shz_fabsf(x) <= 1.0f) {
+        const float z = x * x;
+        float p = shz_fmaf(z, 2.03721912945e-4f, 8.33028376239e-3f);
+        p = shz_fmaf(z, p, 1.66667160211e-1f);
+
+        return shz_fmaf(p * z, x, x);
+    }
+
+    return (shz_expf_tier(x, tier) - shz_expf_tier(-x, tier)) * 0.5f;
+}
+
+SHZ_FORCE_INLINE float shz_coshf_tier(float x, int tier) SHZ_NOEXCEPT {
+    return (shz_expf_tier(x, tier) + shz_expf_tier(-x, tier)) * 0.5f;
+}
+
+SHZ_FORCE_INLINE float shz_tanhf_tier(float x, int tier) SHZ_NOEXCEPT {
+    if(tier == SHZ_PRECISION_PRECISE) {
+        if(shz_fabsf(x) < 0.625f) {
+            const float z = x * x;
+            float p = shz_fmaf(z, -5.70498872745e-3f, 2.06390887954e-2f);
+            p = shz_fmaf(z, p, -5.37397155531e-2f);
+            p = shz_fmaf(z, p,  1.33314422036e-1f);
+            p = shz_fmaf(z, p, -3.33332819422e-1f);
+
+            return shz_fmaf(p * z, x, x);
+        }
+
+        return 1.0f - 2.0f / (shz_expf_tier(2.0f * x, tier) + 1.0f);
+    }
+
+    float ex = shz_expf_tier(x, tier);     // e^x
+    float enx = shz_expf_tier(-x, tier);   // e^-x
+    return shz_divf_fsrra(ex - enx, ex + enx);
+}
+
 SHZ_FORCE_INLINE float shz_sinhf(float x) SHZ_NOEXCEPT {
 #ifdef SHZ_GNUC
     if(__builtin_constant_p(x))
         return __builtin_sinhf(x);
 #endif
-    return (shz_expf(x) - shz_expf(-x)) * 0.5f;
+    return shz_sinhf_tier(x, SHZ_PRECISION);
 }
 
 SHZ_FORCE_INLINE float shz_coshf(float x) SHZ_NOEXCEPT {
@@ -252,7 +399,7 @@ SHZ_FORCE_INLINE float shz_coshf(float x) SHZ_NOEXCEPT {
     if(__builtin_constant_p(x))
         return __builtin_coshf(x);
 #endif
-    return (shz_expf(x) + shz_expf(-x)) * 0.5f;
+    return shz_coshf_tier(x, SHZ_PRECISION);
 }
 
 SHZ_FORCE_INLINE float shz_tanhf(float x) SHZ_NOEXCEPT {
@@ -260,9 +407,7 @@ SHZ_FORCE_INLINE float shz_tanhf(float x) SHZ_NOEXCEPT {
     if(__builtin_constant_p(x))
         return __builtin_tanhf(x);
 #endif
-    float ex = shz_expf(x);     // e^x
-    float enx = shz_expf(-x);   // e^-x
-    return shz_divf_fsrra(ex - enx, ex + enx);
+    return shz_tanhf_tier(x, SHZ_PRECISION);
 }
 
 SHZ_FORCE_INLINE float shz_cschf(float x) SHZ_NOEXCEPT {
@@ -295,12 +440,68 @@ SHZ_FORCE_INLINE float shz_cothf(float x) SHZ_NOEXCEPT {
     return shz_divf(cosh_val, sinh_val);
 }
 
+SHZ_FORCE_INLINE float shz_asinhf_tier(float x, int tier) SHZ_NOEXCEPT {
+    if(tier == SHZ_PRECISION_PRECISE) {
+        const float a = shz_fabsf(x);
+
+        if(a < 0.5f) {
+            const float z = a * a;
+            float p = shz_fmaf(z, 2.0122003309e-2f, -4.2699340972e-2f);
+            p = shz_fmaf(z, p,  7.4847586088e-2f);
+            p = shz_fmaf(z, p, -1.6666288134e-1f);
+
+            return shz_fmaf(p * z, x, x);
+        }
+
+        return shz_copysignf(shz_logf_tier(a + sqrtf(a * a + 1.0f), tier), x);
+    }
+
+    return shz_logf_tier(x + shz_sqrtf_fsrra(x * x + 1.0f), tier);
+}
+
+SHZ_FORCE_INLINE float shz_acoshf_tier(float x, int tier) SHZ_NOEXCEPT {
+    if(tier == SHZ_PRECISION_PRECISE) {
+        const float z = x - 1.0f;
+
+        if(z < 0.5f) {
+            float p = shz_fmaf(z, 1.7596881071e-3f, -7.5272886713e-3f);
+            p = shz_fmaf(z, p,  2.6454905019e-2f);
+            p = shz_fmaf(z, p, -1.1784741703e-1f);
+            p = shz_fmaf(z, p,  1.4142135263e0f);
+
+            return p * sqrtf(z);
+        }
+
+        return shz_logf_tier(x + sqrtf(x * x - 1.0f), tier);
+    }
+
+    return shz_logf_tier(x + shz_sqrtf(x * x - 1.0f), tier);
+}
+
+SHZ_FORCE_INLINE float shz_atanhf_tier(float x, int tier) SHZ_NOEXCEPT {
+    if(tier == SHZ_PRECISION_PRECISE) {
+        if(shz_fabsf(x) < 0.5f) {
+            const float z = x * x;
+            float p = shz_fmaf(z, 1.81740078349e-1f, 8.24370301058e-2f);
+            p = shz_fmaf(z, p, 1.46691431730e-1f);
+            p = shz_fmaf(z, p, 1.99782164500e-1f);
+            p = shz_fmaf(z, p, 3.33337300303e-1f);
+
+            return shz_fmaf(p * z, x, x);
+        }
+
+        return 0.5f * shz_logf_tier((1.0f + x) / (1.0f - x), tier);
+    }
+
+    return 0.5f * shz_logf_tier(shz_divf(1.0f + x, 1.0f - x), tier);
+}
+
 SHZ_FORCE_INLINE float shz_asinhf(float x) SHZ_NOEXCEPT {
 #ifdef SHZ_GNUC
     if(__builtin_constant_p(x))
         return __builtin_asinhf(x);
 #endif
-    return shz_logf(x + shz_sqrtf_fsrra(x * x + 1.0f));
+    return shz_asinhf_tier(x, SHZ_PRECISION);
 }
 
 SHZ_FORCE_INLINE float shz_acoshf(float x) SHZ_NOEXCEPT {
@@ -308,7 +509,7 @@ SHZ_FORCE_INLINE float shz_acoshf(float x) SHZ_NOEXCEPT {
     if(__builtin_constant_p(x))
         return __builtin_acoshf(x);
 #endif
-    return shz_logf(x + shz_sqrtf(x * x - 1.0f));
+    return shz_acoshf_tier(x, SHZ_PRECISION);
 }
 
 SHZ_FORCE_INLINE float shz_atanhf(float x) SHZ_NOEXCEPT {
@@ -316,7 +517,7 @@ SHZ_FORCE_INLINE float shz_atanhf(float x) SHZ_NOEXCEPT {
     if(__builtin_constant_p(x))
         return __builtin_atanhf(x);
 #endif
-    return 0.5f * shz_logf(shz_divf(1.0f + x, 1.0f - x));
+    return shz_atanhf_tier(x, SHZ_PRECISION);
 }
 
 SHZ_FORCE_INLINE float shz_acschf(float x) SHZ_NOEXCEPT {
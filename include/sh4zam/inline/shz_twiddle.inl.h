@@ -0,0 +1,55 @@
+//! \cond INTERNAL
+/*! \file
+    \brief Internal implementation of the Twiddle API
+    \ingroup twiddle
+
+    This file contains the implementation of the inline functions declared
+    within the Twiddle API.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+SHZ_INLINE uint32_t shz_morton_spread(uint32_t v) SHZ_NOEXCEPT {
+    // Halves the distance between groups of bits at each step, rather than moving one bit at a time.
+    v &= 0x0000ffff;
+    v  = (v | (v << 8)) & 0x00ff00ff;
+    v  = (v | (v << 4)) & 0x0f0f0f0f;
+    v  = (v | (v << 2)) & 0x33333333;
+    v  = (v | (v << 1)) & 0x55555555;
+
+    return v;
+}
+
+SHZ_INLINE uint32_t shz_morton_compact(uint32_t v) SHZ_NOEXCEPT {
+    v &= 0x55555555;
+    v  = (v | (v >> 1)) & 0x33333333;
+    v  = (v | (v >> 2)) & 0x0f0f0f0f;
+    v  = (v | (v >> 4)) & 0x00ff00ff;
+    v  = (v | (v >> 8)) & 0x0000ffff;
+
+    return v;
+}
+
+SHZ_INLINE uint32_t shz_morton_encode(uint32_t x, uint32_t y) SHZ_NOEXCEPT {
+    return (shz_morton_spread(x) << 1) | shz_morton_spread(y);
+}
+
+SHZ_INLINE uint32_t shz_morton_decode_x(uint32_t code) SHZ_NOEXCEPT {
+    return shz_morton_compact(code >> 1);
+}
+
+SHZ_INLINE uint32_t shz_morton_decode_y(uint32_t code) SHZ_NOEXCEPT {
+    return shz_morton_compact(code);
+}
+
+SHZ_INLINE uint32_t shz_twiddle_index(uint32_t x, uint32_t y, uint32_t width, uint32_t height) SHZ_NOEXCEPT {
+    const uint32_t size = (width < height)? width : height;
+    const uint32_t mask = size - 1;
+
+    // Only the longer dimension has bits above the square, which select the block.
+    return shz_morton_encode(x & mask, y & mask) + ((x | y) & ~mask) * size;
+}
+
+//! \endcond
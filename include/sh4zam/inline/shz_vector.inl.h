@@ -19,6 +19,8 @@
 
 #if SHZ_BACKEND == SHZ_SH4
 #   include "sh4/shz_vector_sh4.inl.h"
+#elif SHZ_BACKEND == SHZ_X86
+#   include "x86/shz_vector_x86.inl.h"
 #else
 #   include "sw/shz_vector_sw.inl.h"
 #endif
@@ -485,6 +487,8 @@ SHZ_INLINE shz_vec4_t shz_vec4_refract(shz_vec4_t incidence, shz_vec4_t normal,
 SHZ_INLINE float shz_vec3_triple(shz_vec3_t a, shz_vec3_t b, shz_vec3_t c) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     return shz_vec3_triple_sh4(a, b, c);
+#elif SHZ_BACKEND == SHZ_X86
+    return shz_vec3_triple_x86(a, b, c);
 #else
     return shz_vec3_triple_sw(a, b, c);
 #endif
@@ -597,6 +601,8 @@ SHZ_FORCE_INLINE shz_vec3_t shz_vec2_dot3(shz_vec2_t l, shz_vec2_t r1, shz_vec2_
 SHZ_FORCE_INLINE shz_vec2_t shz_vec3_dot2(shz_vec3_t l, shz_vec3_t r1, shz_vec3_t r2) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     return shz_vec3_dot2_sh4(l, r1, r2);
+#elif SHZ_BACKEND == SHZ_X86
+    return shz_vec3_dot2_x86(l, r1, r2);
 #else
     return shz_vec3_dot2_sw(l, r1, r2);
 #endif
@@ -605,6 +611,8 @@ SHZ_FORCE_INLINE shz_vec2_t shz_vec3_dot2(shz_vec3_t l, shz_vec3_t r1, shz_vec3_
 SHZ_FORCE_INLINE shz_vec3_t shz_vec3_dot3(shz_vec3_t l, shz_vec3_t r1, shz_vec3_t r2, shz_vec3_t r3) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     return shz_vec3_dot3_sh4(l, r1, r2, r3);
+#elif SHZ_BACKEND == SHZ_X86
+    return shz_vec3_dot3_x86(l, r1, r2, r3);
 #else
     return shz_vec3_dot3_sw(l, r1, r2, r3);
 #endif
@@ -613,6 +621,8 @@ SHZ_FORCE_INLINE shz_vec3_t shz_vec3_dot3(shz_vec3_t l, shz_vec3_t r1, shz_vec3_
 SHZ_FORCE_INLINE shz_vec2_t shz_vec4_dot2(shz_vec4_t l, shz_vec4_t r1, shz_vec4_t r2) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     return shz_vec4_dot2_sh4(l, r1, r2);
+#elif SHZ_BACKEND == SHZ_X86
+    return shz_vec4_dot2_x86(l, r1, r2);
 #else
     return shz_vec4_dot2_sw(l, r1, r2);
 #endif
@@ -621,6 +631,8 @@ SHZ_FORCE_INLINE shz_vec2_t shz_vec4_dot2(shz_vec4_t l, shz_vec4_t r1, shz_vec4_
 SHZ_FORCE_INLINE shz_vec3_t shz_vec4_dot3(shz_vec4_t l, shz_vec4_t r1, shz_vec4_t r2, shz_vec4_t r3) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     return shz_vec4_dot3_sh4(l, r1, r2, r3);
+#elif SHZ_BACKEND == SHZ_X86
+    return shz_vec4_dot3_x86(l, r1, r2, r3);
 #else
     return shz_vec4_dot3_sw(l, r1, r2, r3);
 #endif
@@ -830,5 +842,9 @@ SHZ_FORCE_INLINE shz_vec4_t shz_vec4_maxv(shz_vec4_t a, shz_vec4_t b) SHZ_NOEXCE
     return shz_vec3_vec4(shz_vec3_maxv(a.xyz, b.xyz), shz_fmaxf(a.w, b.w));
 }
 
+SHZ_FORCE_INLINE shz_vec3_soa_t shz_vec3_soa_init(float* x, float* y, float* z, size_t count) SHZ_NOEXCEPT {
+    return SHZ_INIT(shz_vec3_soa_t, x, y, z, count);
+}
+
  //! \endcond
  
\ No newline at end of file
@@ -12,8 +12,12 @@
  *  \copyright MIT License
  */
 
+#include <stddef.h>
+
 #if SHZ_BACKEND == SHZ_SH4
 #   include "sh4/shz_xmtrx_sh4.inl.h"
+#elif SHZ_BACKEND == SHZ_X86
+#   include "x86/shz_xmtrx_x86.inl.h"
 #else
 #   include "sw/shz_xmtrx_sw.inl.h"
 #endif
@@ -85,6 +89,8 @@ SHZ_FORCE_INLINE void shz_xmtrx_swap_cols(unsigned int index1, unsigned int inde
 SHZ_FORCE_INLINE void shz_xmtrx_load_4x4(const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     shz_xmtrx_load_4x4_sh4(matrix);
+#elif SHZ_BACKEND == SHZ_X86
+    shz_xmtrx_load_4x4_x86(matrix);
 #else
     shz_xmtrx_load_4x4_sw(matrix);
 #endif
@@ -205,6 +211,8 @@ SHZ_FORCE_INLINE void shz_xmtrx_load_2x2(const shz_mat2x2_t* matrix) SHZ_NOEXCEP
 SHZ_FORCE_INLINE void shz_xmtrx_store_4x4(shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     shz_xmtrx_store_4x4_sh4(matrix);
+#elif SHZ_BACKEND == SHZ_X86
+    shz_xmtrx_store_4x4_x86(matrix);
 #else
     shz_xmtrx_store_4x4_sw(matrix);
 #endif
@@ -458,6 +466,8 @@ SHZ_FORCE_INLINE void shz_xmtrx_init_rotation_yxz(float yAngle, float xAngle, fl
 SHZ_FORCE_INLINE void shz_xmtrx_apply_4x4(const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     shz_xmtrx_apply_4x4_sh4(matrix);
+#elif SHZ_BACKEND == SHZ_X86
+    shz_xmtrx_apply_4x4_x86(matrix);
 #else
     shz_xmtrx_apply_4x4_sw(matrix);
 #endif
@@ -815,6 +825,8 @@ SHZ_FORCE_INLINE void shz_xmtrx_load_apply_4x4(const shz_mat4x4_t* matrix1,
                                                const shz_mat4x4_t* matrix2) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     shz_xmtrx_load_apply_4x4_sh4(matrix1, matrix2);
+#elif SHZ_BACKEND == SHZ_X86
+    shz_xmtrx_load_apply_4x4_x86(matrix1, matrix2);
 #else
     shz_xmtrx_load_apply_4x4_sw(matrix1, matrix2);
 #endif
@@ -830,6 +842,8 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_store_4x4(shz_mat4x4_t* out,
                                                 const shz_mat4x4_t* in) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     shz_xmtrx_apply_store_4x4_sh4(out, in);
+#elif SHZ_BACKEND == SHZ_X86
+    shz_xmtrx_apply_store_4x4_x86(out, in);
 #else
     shz_xmtrx_apply_store_4x4_sw(out, in);
 #endif
@@ -946,6 +960,8 @@ float shz_xmtrx_determinant(void) SHZ_NOEXCEPT;
 SHZ_FORCE_INLINE shz_vec4_t shz_xmtrx_transform_vec4(shz_vec4_t vec) SHZ_NOEXCEPT {
 #if SHZ_BACKEND == SHZ_SH4
     return shz_xmtrx_transform_vec4_sh4(vec);
+#elif SHZ_BACKEND == SHZ_X86
+    return shz_xmtrx_transform_vec4_x86(vec);
 #else
     return shz_xmtrx_transform_vec4_sw(vec);
 #endif
@@ -967,6 +983,141 @@ SHZ_FORCE_INLINE shz_vec3_t shz_xmtrx_transform_point3(shz_vec3_t pt) SHZ_NOEXCE
     return shz_xmtrx_transform_vec4(shz_vec3_vec4(pt, 1.0f)).xyz;
 }
 
+/* ========== Batched Transformations ========== */
+
+SHZ_INLINE void shz_xmtrx_transform_vec4_array(shz_vec4_t* dst, const shz_vec4_t* src, size_t count, size_t stride) SHZ_NOEXCEPT {
+    if(!stride)
+        stride = sizeof(shz_vec4_t);
+#if SHZ_BACKEND == SHZ_SH4
+    shz_xmtrx_transform_vec4_array_sh4(dst, src, count, stride);
+#else
+    shz_xmtrx_transform_vec4_array_sw(dst, src, count, stride);
+#endif
+}
+
+SHZ_INLINE void shz_xmtrx_transform_vec3_array(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride) SHZ_NOEXCEPT {
+    if(!stride)
+        stride = sizeof(shz_vec3_t);
+#if SHZ_BACKEND == SHZ_SH4
+    shz_xmtrx_transform_vec3_array_sh4(dst, src, count, stride);
+#else
+    shz_xmtrx_transform_vec3_array_sw(dst, src, count, stride);
+#endif
+}
+
+SHZ_INLINE void shz_xmtrx_transform_point3_array(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride) SHZ_NOEXCEPT {
+    if(!stride)
+        stride = sizeof(shz_vec3_t);
+#if SHZ_BACKEND == SHZ_SH4
+    shz_xmtrx_transform_point3_array_sh4(dst, src, count, stride);
+#else
+    shz_xmtrx_transform_point3_array_sw(dst, src, count, stride);
+#endif
+}
+
+SHZ_INLINE shz_viewport_t shz_viewport_init(float x, float y, float width, float height) SHZ_NOEXCEPT {
+    return (shz_viewport_t) { shz_vec2_init(width * 0.5f, height * -0.5f),
+                              shz_vec2_init(x + width * 0.5f, y + height * 0.5f) };
+}
+
+SHZ_INLINE void shz_xmtrx_project_point3_array(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride, const shz_viewport_t* viewport) SHZ_NOEXCEPT {
+    if(!stride)
+        stride = sizeof(shz_vec3_t);
+#if SHZ_BACKEND == SHZ_SH4
+    shz_xmtrx_project_point3_array_sh4(dst, src, count, stride, viewport);
+#else
+    shz_xmtrx_project_point3_array_sw(dst, src, count, stride, viewport);
+#endif
+}
+
+/* ========== Explicit Context ========== */
+
+SHZ_FORCE_INLINE shz_xmtrx_ctx_t* shz_xmtrx_ctx_acquire(void) SHZ_NOEXCEPT {
+#if SHZ_BACKEND == SHZ_SH4
+    return NULL; // XMTRX is a register bank, there's no state to resolve.
+#else
+    return shz_xmtrx_ctx_acquire_sw();
+#endif
+}
+
+SHZ_FORCE_INLINE void shz_xmtrx_ctx_load_4x4(shz_xmtrx_ctx_t* ctx, const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+#if SHZ_BACKEND == SHZ_SH4
+    (void)ctx;
+    shz_xmtrx_load_4x4_sh4(matrix);
+#elif SHZ_BACKEND == SHZ_X86
+    shz_xmtrx_ctx_load_4x4_x86(ctx, matrix);
+#else
+    shz_xmtrx_ctx_load_4x4_sw(ctx, matrix);
+#endif
+}
+
+SHZ_FORCE_INLINE void shz_xmtrx_ctx_store_4x4(shz_xmtrx_ctx_t* ctx, shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+#if SHZ_BACKEND == SHZ_SH4
+    (void)ctx;
+    shz_xmtrx_store_4x4_sh4(matrix);
+#elif SHZ_BACKEND == SHZ_X86
+    shz_xmtrx_ctx_store_4x4_x86(ctx, matrix);
+#else
+    shz_xmtrx_ctx_store_4x4_sw(ctx, matrix);
+#endif
+}
+
+SHZ_FORCE_INLINE void shz_xmtrx_ctx_apply_4x4(shz_xmtrx_ctx_t* ctx, const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+#if SHZ_BACKEND == SHZ_SH4
+    (void)ctx;
+    shz_xmtrx_apply_4x4_sh4(matrix);
+#elif SHZ_BACKEND == SHZ_X86
+    shz_xmtrx_ctx_apply_4x4_x86(ctx, matrix);
+#else
+    shz_xmtrx_ctx_apply_4x4_sw(ctx, matrix);
+#endif
+}
+
+SHZ_FORCE_INLINE void shz_xmtrx_ctx_load_apply_4x4(shz_xmtrx_ctx_t* ctx,
+                                                   const shz_mat4x4_t* matrix1,
+                                                   const shz_mat4x4_t* matrix2) SHZ_NOEXCEPT {
+#if SHZ_BACKEND == SHZ_SH4
+    (void)ctx;
+    shz_xmtrx_load_apply_4x4_sh4(matrix1, matrix2);
+#elif SHZ_BACKEND == SHZ_X86
+    shz_xmtrx_ctx_load_apply_4x4_x86(ctx, matrix1, matrix2);
+#else
+    shz_xmtrx_ctx_load_apply_4x4_sw(ctx, matrix1, matrix2);
+#endif
+}
+
+SHZ_FORCE_INLINE void shz_xmtrx_ctx_apply_store_4x4(shz_xmtrx_ctx_t* ctx,
+                                                    shz_mat4x4_t* out,
+                                                    const shz_mat4x4_t* in) SHZ_NOEXCEPT {
+#if SHZ_BACKEND == SHZ_SH4
+    (void)ctx;
+    shz_xmtrx_apply_store_4x4_sh4(out, in);
+#elif SHZ_BACKEND == SHZ_X86
+    shz_xmtrx_ctx_apply_store_4x4_x86(ctx, out, in);
+#else
+    shz_xmtrx_ctx_apply_store_4x4_sw(ctx, out, in);
+#endif
+}
+
+SHZ_FORCE_INLINE shz_vec4_t shz_xmtrx_ctx_transform_vec4(shz_xmtrx_ctx_t* ctx, shz_vec4_t vec) SHZ_NOEXCEPT {
+#if SHZ_BACKEND == SHZ_SH4
+    (void)ctx;
+    return shz_xmtrx_transform_vec4_sh4(vec);
+#elif SHZ_BACKEND == SHZ_X86
+    return shz_xmtrx_ctx_transform_vec4_x86(ctx, vec);
+#else
+    return shz_xmtrx_ctx_transform_vec4_sw(ctx, vec);
+#endif
+}
+
+SHZ_FORCE_INLINE shz_vec3_t shz_xmtrx_ctx_transform_vec3(shz_xmtrx_ctx_t* ctx, shz_vec3_t vec) SHZ_NOEXCEPT {
+    return shz_xmtrx_ctx_transform_vec4(ctx, shz_vec3_vec4(vec, 0.0f)).xyz;
+}
+
+SHZ_FORCE_INLINE shz_vec3_t shz_xmtrx_ctx_transform_point3(shz_xmtrx_ctx_t* ctx, shz_vec3_t pt) SHZ_NOEXCEPT {
+    return shz_xmtrx_ctx_transform_vec4(ctx, shz_vec3_vec4(pt, 1.0f)).xyz;
+}
+
 /* ========== Init Compositions ========== */
 
 SHZ_FORCE_INLINE void shz_xmtrx_init_lookat(shz_vec3_t eye, shz_vec3_t center, shz_vec3_t up) SHZ_NOEXCEPT {
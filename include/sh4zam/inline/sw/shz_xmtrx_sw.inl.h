@@ -54,12 +54,16 @@ shz_xmtrx__t* shz_xmtrx_state_(void);
 void shz_xmtrx_load_apply_store_4x4_sw(shz_mat4x4_t* out, const shz_mat4x4_t* mat1, const shz_mat4x4_t* mat2);
 void shz_xmtrx_load_apply_store_3x4_sw(shz_mat3x4_t* out, const shz_mat3x4_t* mat1, const shz_mat3x4_t* mat2);
 void shz_xmtrx_load_apply_store_3x3_sw(shz_mat3x3_t* out, const shz_mat3x3_t* mat1, const shz_mat3x3_t* mat2);
+void shz_xmtrx_transform_vec4_array_sw(shz_vec4_t* dst, const shz_vec4_t* src, size_t count, size_t stride);
+void shz_xmtrx_transform_vec3_array_sw(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride);
+void shz_xmtrx_transform_point3_array_sw(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride);
+void shz_xmtrx_project_point3_array_sw(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride, const shz_viewport_t* viewport);
 
 /* ========== Internal Helpers ========== */
 
 /* result = state * vec (simulates ftrv instruction) */
-static inline shz_vec4_t shz_xmtrx_ftrv_(shz_vec4_t v) {
-    const shz_vec4_t* SHZ_RESTRICT c = shz_xmtrx_state_()->col;
+static inline shz_vec4_t shz_xmtrx_ftrv_(const shz_xmtrx__t* state, shz_vec4_t v) {
+    const shz_vec4_t* SHZ_RESTRICT c = state->col;
     return shz_vec4_init(
         c[0].x * v.x + c[1].x * v.y + c[2].x * v.z + c[3].x * v.w,
         c[0].y * v.x + c[1].y * v.y + c[2].y * v.z + c[3].y * v.w,
@@ -69,24 +73,22 @@ static inline shz_vec4_t shz_xmtrx_ftrv_(shz_vec4_t v) {
 }
 
 /* state = state * B (forward multiply: transform each column of B by state) */
-static inline void shz_xmtrx_mul4x4_cols_(const shz_vec4_t* b) {
-    shz_xmtrx__t* xmtrx_state_ = shz_xmtrx_state_();
-    shz_vec4_t r0 = shz_xmtrx_ftrv_(b[0]);
-    shz_vec4_t r1 = shz_xmtrx_ftrv_(b[1]);
-    shz_vec4_t r2 = shz_xmtrx_ftrv_(b[2]);
-    shz_vec4_t r3 = shz_xmtrx_ftrv_(b[3]);
+static inline void shz_xmtrx_mul4x4_cols_(shz_xmtrx__t* xmtrx_state_, const shz_vec4_t* b) {
+    shz_vec4_t r0 = shz_xmtrx_ftrv_(xmtrx_state_, b[0]);
+    shz_vec4_t r1 = shz_xmtrx_ftrv_(xmtrx_state_, b[1]);
+    shz_vec4_t r2 = shz_xmtrx_ftrv_(xmtrx_state_, b[2]);
+    shz_vec4_t r3 = shz_xmtrx_ftrv_(xmtrx_state_, b[3]);
     xmtrx_state_->col[0] = r0;
     xmtrx_state_->col[1] = r1;
     xmtrx_state_->col[2] = r2;
     xmtrx_state_->col[3] = r3;
 }
 
-static inline void shz_xmtrx_mul4x4_colsf_(const float b[16]) {
-    shz_xmtrx__t* xmtrx_state_ = shz_xmtrx_state_();
-    shz_vec4_t r0 = shz_xmtrx_ftrv_(shz_vec4_init(b[ 0], b[ 1], b[ 2], b[ 3]));
-    shz_vec4_t r1 = shz_xmtrx_ftrv_(shz_vec4_init(b[ 4], b[ 5], b[ 6], b[ 7]));
-    shz_vec4_t r2 = shz_xmtrx_ftrv_(shz_vec4_init(b[ 8], b[ 9], b[10], b[11]));
-    shz_vec4_t r3 = shz_xmtrx_ftrv_(shz_vec4_init(b[12], b[13], b[14], b[15]));
+static inline void shz_xmtrx_mul4x4_colsf_(shz_xmtrx__t* xmtrx_state_, const float b[16]) {
+    shz_vec4_t r0 = shz_xmtrx_ftrv_(xmtrx_state_, shz_vec4_init(b[ 0], b[ 1], b[ 2], b[ 3]));
+    shz_vec4_t r1 = shz_xmtrx_ftrv_(xmtrx_state_, shz_vec4_init(b[ 4], b[ 5], b[ 6], b[ 7]));
+    shz_vec4_t r2 = shz_xmtrx_ftrv_(xmtrx_state_, shz_vec4_init(b[ 8], b[ 9], b[10], b[11]));
+    shz_vec4_t r3 = shz_xmtrx_ftrv_(xmtrx_state_, shz_vec4_init(b[12], b[13], b[14], b[15]));
     xmtrx_state_->col[0] = r0;
     xmtrx_state_->col[1] = r1;
     xmtrx_state_->col[2] = r2;
@@ -94,8 +96,7 @@ static inline void shz_xmtrx_mul4x4_colsf_(const float b[16]) {
 }
 
 /* state = A * state (reverse multiply: load A, transform each column of old state) */
-static inline void shz_xmtrx_rmul4x4_cols_(const shz_vec4_t* a) {
-    shz_xmtrx__t* xmtrx_state_ = shz_xmtrx_state_();
+static inline void shz_xmtrx_rmul4x4_cols_(shz_xmtrx__t* xmtrx_state_, const shz_vec4_t* a) {
     shz_vec4_t old[4];
     old[0] = xmtrx_state_->col[0];
     old[1] = xmtrx_state_->col[1];
@@ -107,16 +108,25 @@ static inline void shz_xmtrx_rmul4x4_cols_(const shz_vec4_t* a) {
     xmtrx_state_->col[2] = a[2];
     xmtrx_state_->col[3] = a[3];
 
-    shz_vec4_t r0 = shz_xmtrx_ftrv_(old[0]);
-    shz_vec4_t r1 = shz_xmtrx_ftrv_(old[1]);
-    shz_vec4_t r2 = shz_xmtrx_ftrv_(old[2]);
-    shz_vec4_t r3 = shz_xmtrx_ftrv_(old[3]);
+    shz_vec4_t r0 = shz_xmtrx_ftrv_(xmtrx_state_, old[0]);
+    shz_vec4_t r1 = shz_xmtrx_ftrv_(xmtrx_state_, old[1]);
+    shz_vec4_t r2 = shz_xmtrx_ftrv_(xmtrx_state_, old[2]);
+    shz_vec4_t r3 = shz_xmtrx_ftrv_(xmtrx_state_, old[3]);
     xmtrx_state_->col[0] = r0;
     xmtrx_state_->col[1] = r1;
     xmtrx_state_->col[2] = r2;
     xmtrx_state_->col[3] = r3;
 }
 
+/* ========== Context ========== */
+
+/* The context handle is simply the calling thread's XMTRX state. */
+#define SHZ_XMTRX_CTX_(ctx) ((shz_xmtrx__t*)(ctx))
+
+SHZ_FORCE_INLINE shz_xmtrx_ctx_t* shz_xmtrx_ctx_acquire_sw(void) SHZ_NOEXCEPT {
+    return (shz_xmtrx_ctx_t*)shz_xmtrx_state_();
+}
+
 /* ========== Accessors ========== */
 
 SHZ_FORCE_INLINE float shz_xmtrx_read_sw(shz_xmtrx_reg_t xf) SHZ_NOEXCEPT {
@@ -173,8 +183,8 @@ SHZ_FORCE_INLINE void shz_xmtrx_swap_cols_sw(unsigned int index1, unsigned int i
 
 /* ========== Loading ========== */
 
-SHZ_FORCE_INLINE void shz_xmtrx_load_4x4_sw(const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
-    shz_xmtrx__t* xmtrx_state_ = shz_xmtrx_state_();
+SHZ_FORCE_INLINE void shz_xmtrx_ctx_load_4x4_sw(shz_xmtrx_ctx_t* ctx, const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+    shz_xmtrx__t* xmtrx_state_ = SHZ_XMTRX_CTX_(ctx);
     const shz_vec4_t* cols = SHZ_XMTRX_COLS_(matrix);
     xmtrx_state_->col[0] = cols[0];
     xmtrx_state_->col[1] = cols[1];
@@ -182,6 +192,10 @@ SHZ_FORCE_INLINE void shz_xmtrx_load_4x4_sw(const shz_mat4x4_t* matrix) SHZ_NOEX
     xmtrx_state_->col[3] = cols[3];
 }
 
+SHZ_FORCE_INLINE void shz_xmtrx_load_4x4_sw(const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+    shz_xmtrx_ctx_load_4x4_sw(shz_xmtrx_ctx_acquire_sw(), matrix);
+}
+
 SHZ_FORCE_INLINE void shz_xmtrx_load_wxyz_4x4_sw(const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
     shz_xmtrx__t* xmtrx_state_ = shz_xmtrx_state_();
     const shz_vec4_t* cols = SHZ_XMTRX_COLS_(matrix);
@@ -291,8 +305,8 @@ SHZ_FORCE_INLINE void shz_xmtrx_load_2x2_sw(const shz_mat2x2_t* matrix) SHZ_NOEX
 
 /* ========== Storing ========== */
 
-SHZ_FORCE_INLINE void shz_xmtrx_store_4x4_sw(shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
-    shz_xmtrx__t* xmtrx_state_ = shz_xmtrx_state_();
+SHZ_FORCE_INLINE void shz_xmtrx_ctx_store_4x4_sw(shz_xmtrx_ctx_t* ctx, shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+    const shz_xmtrx__t* xmtrx_state_ = SHZ_XMTRX_CTX_(ctx);
     shz_vec4_t* cols = SHZ_XMTRX_MCOLS_(matrix);
     cols[0] = xmtrx_state_->col[0];
     cols[1] = xmtrx_state_->col[1];
@@ -300,6 +314,10 @@ SHZ_FORCE_INLINE void shz_xmtrx_store_4x4_sw(shz_mat4x4_t* matrix) SHZ_NOEXCEPT
     cols[3] = xmtrx_state_->col[3];
 }
 
+SHZ_FORCE_INLINE void shz_xmtrx_store_4x4_sw(shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+    shz_xmtrx_ctx_store_4x4_sw(shz_xmtrx_ctx_acquire_sw(), matrix);
+}
+
 SHZ_FORCE_INLINE void shz_xmtrx_store_unaligned_4x4_sw(float matrix[16]) SHZ_NOEXCEPT {
     memcpy(matrix, shz_xmtrx_state_(), 16 * sizeof(float));
 }
@@ -520,12 +538,16 @@ SHZ_FORCE_INLINE void shz_xmtrx_init_screen_sw(float width, float height) SHZ_NO
 
 /* ========== Apply Operations ========== */
 
+SHZ_FORCE_INLINE void shz_xmtrx_ctx_apply_4x4_sw(shz_xmtrx_ctx_t* ctx, const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+    shz_xmtrx_mul4x4_cols_(SHZ_XMTRX_CTX_(ctx), SHZ_XMTRX_COLS_(matrix));
+}
+
 SHZ_FORCE_INLINE void shz_xmtrx_apply_4x4_sw(const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
-    shz_xmtrx_mul4x4_cols_(SHZ_XMTRX_COLS_(matrix));
+    shz_xmtrx_ctx_apply_4x4_sw(shz_xmtrx_ctx_acquire_sw(), matrix);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_aligned4_4x4_sw(const float matrix[16]) SHZ_NOEXCEPT {
-    shz_xmtrx_mul4x4_colsf_(matrix);
+    shz_xmtrx_mul4x4_colsf_(shz_xmtrx_state_(), matrix);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_transpose_4x4_sw(const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
@@ -535,11 +557,11 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_transpose_4x4_sw(const shz_mat4x4_t* matri
     transposed[1] = shz_vec4_init(c[0].y, c[1].y, c[2].y, c[3].y);
     transposed[2] = shz_vec4_init(c[0].z, c[1].z, c[2].z, c[3].z);
     transposed[3] = shz_vec4_init(c[0].w, c[1].w, c[2].w, c[3].w);
-    shz_xmtrx_mul4x4_cols_(transposed);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), transposed);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_reverse_4x4_sw(const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
-    shz_xmtrx_rmul4x4_cols_(SHZ_XMTRX_COLS_(matrix));
+    shz_xmtrx_rmul4x4_cols_(shz_xmtrx_state_(), SHZ_XMTRX_COLS_(matrix));
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_reverse_aligned4_4x4_sw(const float matrix[16]) SHZ_NOEXCEPT {
@@ -553,7 +575,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_reverse_transpose_4x4_sw(const shz_mat4x4_
     transposed[1] = shz_vec4_init(c[0].y, c[1].y, c[2].y, c[3].y);
     transposed[2] = shz_vec4_init(c[0].z, c[1].z, c[2].z, c[3].z);
     transposed[3] = shz_vec4_init(c[0].w, c[1].w, c[2].w, c[3].w);
-    shz_xmtrx_rmul4x4_cols_(transposed);
+    shz_xmtrx_rmul4x4_cols_(shz_xmtrx_state_(), transposed);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_reverse_transpose_aligned4_4x4_sw(const float matrix[16]) SHZ_NOEXCEPT {
@@ -567,7 +589,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_3x4_sw(const shz_mat3x4_t* mat) SHZ_NOEXCE
     m[1] = shz_vec4_init(c[1].x, c[1].y, c[1].z, 0.0f);
     m[2] = shz_vec4_init(c[2].x, c[2].y, c[2].z, 0.0f);
     m[3] = shz_vec4_init(c[3].x, c[3].y, c[3].z, 1.0f);
-    shz_xmtrx_mul4x4_cols_(m);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), m);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_3x3_sw(const shz_mat3x3_t* matrix) SHZ_NOEXCEPT {
@@ -577,7 +599,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_3x3_sw(const shz_mat3x3_t* matrix) SHZ_NOE
     m[1] = shz_vec4_init(c[1].x, c[1].y, c[1].z, 0.0f);
     m[2] = shz_vec4_init(c[2].x, c[2].y, c[2].z, 0.0f);
     m[3] = shz_xmtrx_state_()->col[3];
-    shz_xmtrx_mul4x4_cols_(m);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), m);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_transpose_3x3_sw(const shz_mat3x3_t* matrix) SHZ_NOEXCEPT {
@@ -587,7 +609,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_transpose_3x3_sw(const shz_mat3x3_t* matri
     m[1] = shz_vec4_init(c[0].y, c[1].y, c[2].y, 0.0f);
     m[2] = shz_vec4_init(c[0].z, c[1].z, c[2].z, 0.0f);
     m[3] = shz_xmtrx_state_()->col[3];
-    shz_xmtrx_mul4x4_cols_(m);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), m);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_2x2_sw(const shz_mat2x2_t* matrix) SHZ_NOEXCEPT {
@@ -599,8 +621,8 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_2x2_sw(const shz_mat2x2_t* matrix) SHZ_NOE
     m[2] = xmtrx_state_->col[2];
     m[3] = xmtrx_state_->col[3];
 
-    shz_vec4_t r0 = shz_xmtrx_ftrv_(m[0]);
-    shz_vec4_t r1 = shz_xmtrx_ftrv_(m[1]);
+    shz_vec4_t r0 = shz_xmtrx_ftrv_(xmtrx_state_, m[0]);
+    shz_vec4_t r1 = shz_xmtrx_ftrv_(xmtrx_state_, m[1]);
     xmtrx_state_->col[0] = r0;
     xmtrx_state_->col[1] = r1;
 }
@@ -649,7 +671,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_rotation_x_sw(float x) SHZ_NOEXCEPT {
     rot[1] = shz_vec4_init(0.0f, c,    s,    0.0f);
     rot[2] = shz_vec4_init(0.0f, -s,   c,    0.0f);
     rot[3] = shz_xmtrx_state_()->col[3];
-    shz_xmtrx_mul4x4_cols_(rot);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), rot);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_rotation_y_sw(float y) SHZ_NOEXCEPT {
@@ -660,7 +682,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_rotation_y_sw(float y) SHZ_NOEXCEPT {
     rot[1] = shz_vec4_init(0.0f, 1.0f, 0.0f, 0.0f);
     rot[2] = shz_vec4_init(s,    0.0f, c,    0.0f);
     rot[3] = shz_xmtrx_state_()->col[3];
-    shz_xmtrx_mul4x4_cols_(rot);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), rot);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_rotation_z_sw(float z) SHZ_NOEXCEPT {
@@ -671,7 +693,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_rotation_z_sw(float z) SHZ_NOEXCEPT {
     rot[1] = shz_vec4_init(-s,   c,    0.0f, 0.0f);
     rot[2] = shz_vec4_init(0.0f, 0.0f, 1.0f, 0.0f);
     rot[3] = shz_xmtrx_state_()->col[3];
-    shz_xmtrx_mul4x4_cols_(rot);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), rot);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_rotation_sw(float angle, float x, float y, float z) SHZ_NOEXCEPT {
@@ -695,7 +717,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_rotation_sw(float angle, float x, float y,
     rot[1] = shz_vec4_init(xyt - zs,  y * y * t + c,  yzt + xs,  0.0f);
     rot[2] = shz_vec4_init(xzt + ys,  yzt - xs,  z * z * t + c,  0.0f);
     rot[3] = shz_xmtrx_state_()->col[3];
-    shz_xmtrx_mul4x4_cols_(rot);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), rot);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_rotation_quat_sw(shz_quat_t q) SHZ_NOEXCEPT {
@@ -708,7 +730,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_rotation_quat_sw(shz_quat_t q) SHZ_NOEXCEP
     rot[1] = shz_vec4_init(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f);
     rot[2] = shz_vec4_init(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f);
     rot[3] = shz_xmtrx_state_()->col[3];
-    shz_xmtrx_mul4x4_cols_(rot);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), rot);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_symmetric_skew_sw(float x, float y, float z) SHZ_NOEXCEPT {
@@ -717,7 +739,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_symmetric_skew_sw(float x, float y, float
     m[1] = shz_vec4_init(z,    0.0f, -x,   0.0f);
     m[2] = shz_vec4_init(-y,    x,   0.0f, 0.0f);
     m[3] = shz_xmtrx_state_()->col[3];
-    shz_xmtrx_mul4x4_cols_(m);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), m);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_lookat_sw(shz_vec3_t eye,
@@ -755,7 +777,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_lookat_sw(shz_vec3_t eye,
     look[1] = shz_vec4_init(s.y, u.y, f.y, 0.0f);
     look[2] = shz_vec4_init(s.z, u.z, f.z, 0.0f);
     look[3] = shz_vec4_init(tx,  ty,  tz,  1.0f);
-    shz_xmtrx_mul4x4_cols_(look);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), look);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_ortho_sw(float left, float right, float bottom, float top, float znear, float zfar) SHZ_NOEXCEPT {
@@ -768,7 +790,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_ortho_sw(float left, float right, float bo
     m[1] = shz_vec4_init(0.0f,    sc.y,    0.0f,    0.0f);
     m[2] = shz_vec4_init(0.0f,    0.0f,    sc.z,    0.0f);
     m[3] = shz_vec4_init(trans.x, trans.y, trans.z, 1.0f);
-    shz_xmtrx_mul4x4_cols_(m);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), m);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_frustum_sw(float left, float right, float bottom, float top, float znear, float zfar) SHZ_NOEXCEPT {
@@ -784,7 +806,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_frustum_sw(float left, float right, float
     m[1] = shz_vec4_init(0.0f, b,    0.0f, 0.0f);
     m[2] = shz_vec4_init(c,    d,    e,    -1.0f);
     m[3] = shz_vec4_init(0.0f, 0.0f, ff,   0.0f);
-    shz_xmtrx_mul4x4_cols_(m);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), m);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_perspective_sw(float fov, float aspect, float znear) SHZ_NOEXCEPT {
@@ -799,7 +821,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_perspective_sw(float fov, float aspect, fl
     m[1] = shz_vec4_init(0.0f,  cot,  0.0f,  0.0f);
     m[2] = shz_vec4_init(0.0f,  0.0f, 0.0f,  -1.0f);
     m[3] = shz_vec4_init(0.0f,  0.0f, znear, 0.0f);
-    shz_xmtrx_mul4x4_cols_(m);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), m);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_screen_sw(float width, float height) SHZ_NOEXCEPT {
@@ -811,7 +833,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_screen_sw(float width, float height) SHZ_N
     m[1] = shz_vec4_init(0.0f, -hh,  0.0f, 0.0f);
     m[2] = shz_vec4_init(0.0f, 0.0f, 1.0f, 0.0f);
     m[3] = shz_vec4_init(hw,   hh,   0.0f, 1.0f);
-    shz_xmtrx_mul4x4_cols_(m);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), m);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_permutation_wxyz_sw(void) SHZ_NOEXCEPT {
@@ -820,7 +842,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_permutation_wxyz_sw(void) SHZ_NOEXCEPT {
     m[1] = shz_vec4_init(0.0f, 0.0f, 1.0f, 0.0f);
     m[2] = shz_vec4_init(0.0f, 0.0f, 0.0f, 1.0f);
     m[3] = shz_vec4_init(1.0f, 0.0f, 0.0f, 0.0f);
-    shz_xmtrx_mul4x4_cols_(m);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), m);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_permutation_yzwx_sw(void) SHZ_NOEXCEPT {
@@ -829,7 +851,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_permutation_yzwx_sw(void) SHZ_NOEXCEPT {
     m[1] = shz_vec4_init(1.0f, 0.0f, 0.0f, 0.0f);
     m[2] = shz_vec4_init(0.0f, 1.0f, 0.0f, 0.0f);
     m[3] = shz_vec4_init(0.0f, 0.0f, 1.0f, 0.0f);
-    shz_xmtrx_mul4x4_cols_(m);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), m);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_permutation_wzyx_sw(void) SHZ_NOEXCEPT {
@@ -838,7 +860,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_permutation_wzyx_sw(void) SHZ_NOEXCEPT {
     m[1] = shz_vec4_init(0.0f, 0.0f, 1.0f, 0.0f);
     m[2] = shz_vec4_init(0.0f, 1.0f, 0.0f, 0.0f);
     m[3] = shz_vec4_init(1.0f, 0.0f, 0.0f, 0.0f);
-    shz_xmtrx_mul4x4_cols_(m);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), m);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_self_sw(void) SHZ_NOEXCEPT {
@@ -848,7 +870,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_apply_self_sw(void) SHZ_NOEXCEPT {
     copy[1] = xmtrx_state_->col[1];
     copy[2] = xmtrx_state_->col[2];
     copy[3] = xmtrx_state_->col[3];
-    shz_xmtrx_mul4x4_cols_(copy);
+    shz_xmtrx_mul4x4_cols_(xmtrx_state_, copy);
 }
 
 /* ========== GL-style API ========== */
@@ -859,7 +881,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_translate_sw(float x, float y, float z) SHZ_NOEX
     t[1] = shz_vec4_init(0.0f, 1.0f, 0.0f, 0.0f);
     t[2] = shz_vec4_init(0.0f, 0.0f, 1.0f, 0.0f);
     t[3] = shz_vec4_init(x,    y,    z,    1.0f);
-    shz_xmtrx_mul4x4_cols_(t);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), t);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_scale_sw(float x, float y, float z) SHZ_NOEXCEPT {
@@ -868,7 +890,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_scale_sw(float x, float y, float z) SHZ_NOEXCEPT
     s[1] = shz_vec4_init(0.0f, y,    0.0f, 0.0f);
     s[2] = shz_vec4_init(0.0f, 0.0f, z,    0.0f);
     s[3] = shz_vec4_init(0.0f, 0.0f, 0.0f, 1.0f);
-    shz_xmtrx_mul4x4_cols_(s);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), s);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_rotate_x_sw(float radians) SHZ_NOEXCEPT {
@@ -879,7 +901,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_rotate_x_sw(float radians) SHZ_NOEXCEPT {
     rot[1] = shz_vec4_init(0.0f, c,    s,    0.0f);
     rot[2] = shz_vec4_init(0.0f, -s,   c,    0.0f);
     rot[3] = shz_vec4_init(0.0f, 0.0f, 0.0f, 1.0f);
-    shz_xmtrx_mul4x4_cols_(rot);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), rot);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_rotate_y_sw(float radians) SHZ_NOEXCEPT {
@@ -890,7 +912,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_rotate_y_sw(float radians) SHZ_NOEXCEPT {
     rot[1] = shz_vec4_init(0.0f, 1.0f, 0.0f, 0.0f);
     rot[2] = shz_vec4_init(s,    0.0f, c,    0.0f);
     rot[3] = shz_vec4_init(0.0f, 0.0f, 0.0f, 1.0f);
-    shz_xmtrx_mul4x4_cols_(rot);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), rot);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_rotate_z_sw(float radians) SHZ_NOEXCEPT {
@@ -901,7 +923,7 @@ SHZ_FORCE_INLINE void shz_xmtrx_rotate_z_sw(float radians) SHZ_NOEXCEPT {
     rot[1] = shz_vec4_init(-s,   c,    0.0f, 0.0f);
     rot[2] = shz_vec4_init(0.0f, 0.0f, 1.0f, 0.0f);
     rot[3] = shz_vec4_init(0.0f, 0.0f, 0.0f, 1.0f);
-    shz_xmtrx_mul4x4_cols_(rot);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), rot);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_rotate_sw(float angle, float x, float y, float z) SHZ_NOEXCEPT {
@@ -925,15 +947,21 @@ SHZ_FORCE_INLINE void shz_xmtrx_rotate_sw(float angle, float x, float y, float z
     rot[1] = shz_vec4_init(xyt - zs,  y * y * t + c,  yzt + xs,  0.0f);
     rot[2] = shz_vec4_init(xzt + ys,  yzt - xs,  z * z * t + c,  0.0f);
     rot[3] = shz_vec4_init(0.0f, 0.0f, 0.0f, 1.0f);
-    shz_xmtrx_mul4x4_cols_(rot);
+    shz_xmtrx_mul4x4_cols_(shz_xmtrx_state_(), rot);
 }
 
 /* ========== Compound Operations ========== */
 
+SHZ_FORCE_INLINE void shz_xmtrx_ctx_load_apply_4x4_sw(shz_xmtrx_ctx_t* ctx,
+                                                      const shz_mat4x4_t* matrix1,
+                                                      const shz_mat4x4_t* matrix2) SHZ_NOEXCEPT {
+    shz_xmtrx_ctx_load_4x4_sw(ctx, matrix1);
+    shz_xmtrx_ctx_apply_4x4_sw(ctx, matrix2);
+}
+
 SHZ_FORCE_INLINE void shz_xmtrx_load_apply_4x4_sw(const shz_mat4x4_t* matrix1,
                                                   const shz_mat4x4_t* matrix2) SHZ_NOEXCEPT {
-    shz_xmtrx_load_4x4_sw(matrix1);
-    shz_xmtrx_apply_4x4_sw(matrix2);
+    shz_xmtrx_ctx_load_apply_4x4_sw(shz_xmtrx_ctx_acquire_sw(), matrix1, matrix2);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_load_apply_unaligned_4x4_sw(const float matrix1[16],
@@ -942,15 +970,26 @@ SHZ_FORCE_INLINE void shz_xmtrx_load_apply_unaligned_4x4_sw(const float matrix1[
     shz_xmtrx_apply_unaligned_4x4(matrix2);
 }
 
+SHZ_INLINE void shz_xmtrx_ctx_apply_store_4x4_sw(shz_xmtrx_ctx_t* ctx,
+                                                 shz_mat4x4_t* out,
+                                                 const shz_mat4x4_t* in) SHZ_NOEXCEPT {
+    const shz_xmtrx__t* xmtrx_state_ = SHZ_XMTRX_CTX_(ctx);
+    const shz_vec4_t*   i            = SHZ_XMTRX_COLS_(in);
+          shz_vec4_t*   o            = SHZ_XMTRX_MCOLS_(out);
+
+    shz_vec4_t r0 = shz_xmtrx_ftrv_(xmtrx_state_, i[0]);
+    shz_vec4_t r1 = shz_xmtrx_ftrv_(xmtrx_state_, i[1]);
+    shz_vec4_t r2 = shz_xmtrx_ftrv_(xmtrx_state_, i[2]);
+    shz_vec4_t r3 = shz_xmtrx_ftrv_(xmtrx_state_, i[3]);
+    o[0] = r0;
+    o[1] = r1;
+    o[2] = r2;
+    o[3] = r3;
+}
+
 SHZ_INLINE void shz_xmtrx_apply_store_4x4_sw(shz_mat4x4_t* out,
                                              const shz_mat4x4_t* in) SHZ_NOEXCEPT {
-          struct shz_xmtrx_* o = (      struct shz_xmtrx_*)out;
-    const struct shz_xmtrx_* i = (const struct shz_xmtrx_*)in;
-
-    o->col[0] = shz_xmtrx_ftrv_(i->col[0]);
-    o->col[1] = shz_xmtrx_ftrv_(i->col[1]);
-    o->col[2] = shz_xmtrx_ftrv_(i->col[2]);
-    o->col[3] = shz_xmtrx_ftrv_(i->col[3]);
+    shz_xmtrx_ctx_apply_store_4x4_sw(shz_xmtrx_ctx_acquire_sw(), out, in);
 }
 
 SHZ_FORCE_INLINE void shz_xmtrx_apply_store_aligned4_4x4_sw(float out[16], const float in[16]) SHZ_NOEXCEPT {
@@ -1023,11 +1062,16 @@ SHZ_FORCE_INLINE void shz_xmtrx_abs_sw(void) SHZ_NOEXCEPT {
 
 /* ========== Transformations ========== */
 
+SHZ_FORCE_INLINE shz_vec4_t shz_xmtrx_ctx_transform_vec4_sw(shz_xmtrx_ctx_t* ctx, shz_vec4_t vec) SHZ_NOEXCEPT {
+    return shz_xmtrx_ftrv_(SHZ_XMTRX_CTX_(ctx), vec);
+}
+
 SHZ_FORCE_INLINE shz_vec4_t shz_xmtrx_transform_vec4_sw(shz_vec4_t vec) SHZ_NOEXCEPT {
-    return shz_xmtrx_ftrv_(vec);
+    return shz_xmtrx_ctx_transform_vec4_sw(shz_xmtrx_ctx_acquire_sw(), vec);
 }
 
 /* Clean up cast helper macros */
+#undef SHZ_XMTRX_CTX_
 #undef SHZ_XMTRX_COLS_
 #undef SHZ_XMTRX_ELEMS_
 #undef SHZ_XMTRX_V3S_
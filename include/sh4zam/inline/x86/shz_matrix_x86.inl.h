@@ -0,0 +1,96 @@
+//! \cond INTERNAL
+/*! \file
+ *  \brief   x86 SSE/AVX Matrix API Implementation.
+ *  \ingroup matrix
+ *
+ *  This file contains the x86-64 SIMD implementation of the Matrix API,
+ *  built on SSE4.1 intrinsics, using AVX for wide copies when available.
+ *  Anything not explicitly accelerated here falls back to the generic SW
+ *  back-end.
+ *
+ *  \author 2026 Falco Girgis
+ *
+ *  \copyright MIT License
+ */
+
+#ifndef SHZ_MATRIX_X86_INL_H
+#define SHZ_MATRIX_X86_INL_H
+
+#include "../sw/shz_matrix_sw.inl.h"
+
+/* Linear combination of the 4 columns pointed to by c, weighted by the lanes of v. */
+SHZ_FORCE_INLINE __m128 shz_x86_mat4x4_mul_(const float* c, __m128 v) SHZ_NOEXCEPT {
+    __m128 r = _mm_mul_ps(_mm_loadu_ps(&c[0]), shz_x86_splat_(v, 0));
+    r = shz_x86_madd_(_mm_loadu_ps(&c[4]),  shz_x86_splat_(v, 1), r);
+    r = shz_x86_madd_(_mm_loadu_ps(&c[8]),  shz_x86_splat_(v, 2), r);
+    r = shz_x86_madd_(_mm_loadu_ps(&c[12]), shz_x86_splat_(v, 3), r);
+    return r;
+}
+
+SHZ_INLINE shz_vec3_t shz_mat4x4_transform_vec3_x86(const shz_mat4x4_t* mat, shz_vec3_t v) SHZ_NOEXCEPT {
+    __m128 mv = shz_vec3_m128_(v);
+    __m128 r  = _mm_mul_ps(_mm_loadu_ps(mat->col[0].e), shz_x86_splat_(mv, 0));
+    r = shz_x86_madd_(_mm_loadu_ps(mat->col[1].e), shz_x86_splat_(mv, 1), r);
+    r = shz_x86_madd_(_mm_loadu_ps(mat->col[2].e), shz_x86_splat_(mv, 2), r);
+
+    return shz_m128_vec3_(r);
+}
+
+SHZ_INLINE shz_vec4_t shz_mat4x4_transform_vec4_x86(const shz_mat4x4_t* mat, shz_vec4_t in) SHZ_NOEXCEPT {
+    return shz_m128_vec4_(shz_x86_mat4x4_mul_(mat->elem, shz_vec4_m128_(in)));
+}
+
+SHZ_INLINE shz_vec4_t shz_mat4x4_transform_vec4_transpose_x86(const shz_mat4x4_t* mat, shz_vec4_t in) SHZ_NOEXCEPT {
+    return shz_m128_vec4_(shz_x86_dot4x4_(shz_vec4_m128_(in),
+                                          _mm_loadu_ps(mat->col[0].e),
+                                          _mm_loadu_ps(mat->col[1].e),
+                                          _mm_loadu_ps(mat->col[2].e),
+                                          _mm_loadu_ps(mat->col[3].e)));
+}
+
+SHZ_INLINE shz_vec3_t shz_mat4x4_transform_vec3_transpose_x86(const shz_mat4x4_t* m, shz_vec3_t v) SHZ_NOEXCEPT {
+    return shz_m128_vec3_(shz_x86_dot4x4_(shz_vec3_m128_(v),
+                                          _mm_loadu_ps(m->col[0].e),
+                                          _mm_loadu_ps(m->col[1].e),
+                                          _mm_loadu_ps(m->col[2].e),
+                                          _mm_setzero_ps()));
+}
+
+SHZ_INLINE void shz_mat4x4_copy_x86(shz_mat4x4_t* dst, const shz_mat4x4_t* src) SHZ_NOEXCEPT {
+    shz_x86_copy16_(dst->elem, src->elem);
+}
+
+SHZ_INLINE void shz_mat4x4_swap_x86(shz_mat4x4_t* matA, shz_mat4x4_t* matB) SHZ_NOEXCEPT {
+#ifdef __AVX__
+    __m256 a0 = _mm256_loadu_ps(&matA->elem[0]);
+    __m256 a1 = _mm256_loadu_ps(&matA->elem[8]);
+    __m256 b0 = _mm256_loadu_ps(&matB->elem[0]);
+    __m256 b1 = _mm256_loadu_ps(&matB->elem[8]);
+
+    _mm256_storeu_ps(&matA->elem[0], b0);
+    _mm256_storeu_ps(&matA->elem[8], b1);
+    _mm256_storeu_ps(&matB->elem[0], a0);
+    _mm256_storeu_ps(&matB->elem[8], a1);
+#else
+    for(unsigned c = 0; c < 16; c += 4) {
+        __m128 a = _mm_loadu_ps(&matA->elem[c]);
+        __m128 b = _mm_loadu_ps(&matB->elem[c]);
+
+        _mm_storeu_ps(&matA->elem[c], b);
+        _mm_storeu_ps(&matB->elem[c], a);
+    }
+#endif
+}
+
+SHZ_INLINE shz_vec3_t shz_mat3x3_transform_vec3_x86(const shz_mat3x3_t* mat, shz_vec3_t v) SHZ_NOEXCEPT {
+    __m128 mv = shz_vec3_m128_(v);
+    __m128 r  = _mm_mul_ps(shz_vec3_m128_(mat->col[0]), shz_x86_splat_(mv, 0));
+    r = shz_x86_madd_(shz_vec3_m128_(mat->col[1]), shz_x86_splat_(mv, 1), r);
+    r = shz_x86_madd_(shz_vec3_m128_(mat->col[2]), shz_x86_splat_(mv, 2), r);
+
+    return shz_m128_vec3_(r);
+}
+
+//! \endcond
+
+#endif
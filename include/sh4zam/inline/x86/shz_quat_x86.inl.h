@@ -0,0 +1,70 @@
+//! \cond INTERNAL
+/*! \file
+    \brief x86 SSE/AVX implementation of Quaternion API
+    \ingroup quat
+
+    This file contains the x86-64 SIMD implementation routines for
+    quaternion math, built on SSE4.1 intrinsics. Anything not
+    explicitly accelerated here falls back to the generic SW back-end.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+#ifndef SHZ_QUAT_X86_INL_H
+#define SHZ_QUAT_X86_INL_H
+
+#include "../sw/shz_quat_sw.inl.h"
+
+SHZ_FORCE_INLINE __m128 shz_quat_m128_(shz_quat_t q) SHZ_NOEXCEPT {
+    return _mm_loadu_ps(q.e);
+}
+
+SHZ_FORCE_INLINE shz_quat_t shz_m128_quat_(__m128 m) SHZ_NOEXCEPT {
+    shz_quat_t q;
+    _mm_storeu_ps(q.e, m);
+    return q;
+}
+
+/* Lanes are in <W, X, Y, Z> order, so each term is a signed swizzle of q2. */
+SHZ_INLINE shz_quat_t shz_quat_mult_x86(shz_quat_t q1, shz_quat_t q2) SHZ_NOEXCEPT {
+    const __m128 sign_x = _mm_setr_ps(-0.0f,  0.0f, -0.0f,  0.0f);
+    const __m128 sign_y = _mm_setr_ps(-0.0f,  0.0f,  0.0f, -0.0f);
+    const __m128 sign_z = _mm_setr_ps(-0.0f, -0.0f,  0.0f,  0.0f);
+
+    __m128 a = shz_quat_m128_(q1);
+    __m128 b = shz_quat_m128_(q2);
+
+    /* Two independent accumulation chains, to keep the dependency chain short. */
+    __m128 r0 = _mm_mul_ps(shz_x86_splat_(a, 0), b);
+    __m128 r1 = _mm_mul_ps(shz_x86_splat_(a, 1),
+                           _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), sign_x));
+    r0 = shz_x86_madd_(shz_x86_splat_(a, 2),
+                       _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2)), sign_y), r0);
+    r1 = shz_x86_madd_(shz_x86_splat_(a, 3),
+                       _mm_xor_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)), sign_z), r1);
+
+    __m128 r = _mm_add_ps(r0, r1);
+
+    return shz_m128_quat_(r);
+}
+
+/* v' = 2(u . v)u + (w^2 - u . u)v + 2w(u x v) */
+SHZ_INLINE shz_vec3_t shz_quat_transform_vec3_x86(shz_quat_t q, shz_vec3_t v) SHZ_NOEXCEPT {
+    __m128 u  = shz_vec3_m128_(q.axis);
+    __m128 mv = shz_vec3_m128_(v);
+    __m128 w  = _mm_set1_ps(q.w);
+
+    __m128 uv = _mm_dp_ps(u, mv, 0x7f);
+    __m128 uu = _mm_dp_ps(u, u,  0x7f);
+
+    __m128 r = _mm_mul_ps(_mm_add_ps(uv, uv), u);
+    r = shz_x86_madd_(_mm_sub_ps(_mm_mul_ps(w, w), uu), mv, r);
+    r = shz_x86_madd_(_mm_add_ps(w, w), shz_x86_cross_(u, mv), r);
+
+    return shz_m128_vec3_(r);
+}
+
+//! \endcond
+
+#endif
@@ -0,0 +1,155 @@
+//! \cond INTERNAL
+/*! \file
+    \brief x86 SSE/AVX implementation of Vector API
+    \ingroup vector
+
+    This file contains the x86-64 SIMD implementation routines for
+    vector math, built on SSE4.1 intrinsics, optionally using FMA3
+    instructions when available. Anything not explicitly accelerated
+    here falls back to the generic SW back-end.
+
+    It also provides the internal helpers shared by the rest of the
+    x86 back-end for moving between SH4ZAM types and SSE registers.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+#ifndef SHZ_VECTOR_X86_INL_H
+#define SHZ_VECTOR_X86_INL_H
+
+#if !defined(SHZ_MSVC) && !defined(__SSE4_1__)
+#   error "The SHZ_X86 back-end requires SSE4.1 support (-msse4.1)!"
+#endif
+
+#include <immintrin.h>
+
+#include "../sw/shz_vector_sw.inl.h"
+
+#if defined(__FMA__) || (defined(SHZ_MSVC) && defined(__AVX2__))
+#   define SHZ_X86_FMA  1   // FMA3 instructions are available.
+#endif
+
+/* ========== Internal Helpers ========== */
+
+SHZ_FORCE_INLINE __m128 shz_x86_madd_(__m128 a, __m128 b, __m128 c) SHZ_NOEXCEPT {
+#ifdef SHZ_X86_FMA
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+SHZ_FORCE_INLINE __m128 shz_x86_splat_(__m128 v, int lane) SHZ_NOEXCEPT {
+    switch(lane) {
+    case 0:  return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+    case 1:  return _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+    case 2:  return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+    default: return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+}
+
+SHZ_FORCE_INLINE __m128 shz_vec4_m128_(shz_vec4_t v) SHZ_NOEXCEPT {
+    return _mm_loadu_ps(v.e);
+}
+
+SHZ_FORCE_INLINE __m128 shz_vec3_m128_(shz_vec3_t v) SHZ_NOEXCEPT {
+    return _mm_setr_ps(v.x, v.y, v.z, 0.0f);
+}
+
+SHZ_FORCE_INLINE shz_vec4_t shz_m128_vec4_(__m128 m) SHZ_NOEXCEPT {
+    shz_vec4_t v;
+    _mm_storeu_ps(v.e, m);
+    return v;
+}
+
+SHZ_FORCE_INLINE shz_vec3_t shz_m128_vec3_(__m128 m) SHZ_NOEXCEPT {
+    return shz_m128_vec4_(m).xyz;
+}
+
+SHZ_FORCE_INLINE shz_vec2_t shz_m128_vec2_(__m128 m) SHZ_NOEXCEPT {
+    return shz_m128_vec4_(m).xy;
+}
+
+/* <x, y, z, w> => <y, z, x, w> */
+SHZ_FORCE_INLINE __m128 shz_x86_yzx_(__m128 v) SHZ_NOEXCEPT {
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 2, 1));
+}
+
+/* a x b for <x, y, z, w> lanes, where the resulting W lane is always zero. */
+SHZ_FORCE_INLINE __m128 shz_x86_cross_(__m128 a, __m128 b) SHZ_NOEXCEPT {
+    __m128 c = _mm_sub_ps(_mm_mul_ps(a, shz_x86_yzx_(b)),
+                          _mm_mul_ps(shz_x86_yzx_(a), b));
+    return shz_x86_yzx_(c);
+}
+
+/* Sums the products of l with r1, r2, r3, r4, returning one dot product per lane. */
+SHZ_FORCE_INLINE __m128 shz_x86_dot4x4_(__m128 l, __m128 r1, __m128 r2, __m128 r3, __m128 r4) SHZ_NOEXCEPT {
+    return _mm_hadd_ps(_mm_hadd_ps(_mm_mul_ps(l, r1), _mm_mul_ps(l, r2)),
+                       _mm_hadd_ps(_mm_mul_ps(l, r3), _mm_mul_ps(l, r4)));
+}
+
+/* Copies 16 floats between unaligned buffers, using AVX when available. */
+SHZ_FORCE_INLINE void shz_x86_copy16_(float* dst, const float* src) SHZ_NOEXCEPT {
+#ifdef __AVX__
+    __m256 lo = _mm256_loadu_ps(&src[0]);
+    __m256 hi = _mm256_loadu_ps(&src[8]);
+
+    _mm256_storeu_ps(&dst[0], lo);
+    _mm256_storeu_ps(&dst[8], hi);
+#else
+    __m128 c0 = _mm_loadu_ps(&src[ 0]);
+    __m128 c1 = _mm_loadu_ps(&src[ 4]);
+    __m128 c2 = _mm_loadu_ps(&src[ 8]);
+    __m128 c3 = _mm_loadu_ps(&src[12]);
+
+    _mm_storeu_ps(&dst[ 0], c0);
+    _mm_storeu_ps(&dst[ 4], c1);
+    _mm_storeu_ps(&dst[ 8], c2);
+    _mm_storeu_ps(&dst[12], c3);
+#endif
+}
+
+/* ========== Vector Routines ========== */
+
+SHZ_INLINE float shz_vec3_triple_x86(shz_vec3_t a, shz_vec3_t b, shz_vec3_t c) SHZ_NOEXCEPT {
+    return _mm_cvtss_f32(_mm_dp_ps(shz_vec3_m128_(a),
+                                   shz_x86_cross_(shz_vec3_m128_(b), shz_vec3_m128_(c)),
+                                   0x71));
+}
+
+SHZ_FORCE_INLINE shz_vec2_t shz_vec3_dot2_x86(shz_vec3_t l, shz_vec3_t r1, shz_vec3_t r2) SHZ_NOEXCEPT {
+    __m128 ml = shz_vec3_m128_(l);
+
+    return shz_m128_vec2_(_mm_or_ps(_mm_dp_ps(ml, shz_vec3_m128_(r1), 0x71),
+                                    _mm_dp_ps(ml, shz_vec3_m128_(r2), 0x72)));
+}
+
+SHZ_FORCE_INLINE shz_vec3_t shz_vec3_dot3_x86(shz_vec3_t l, shz_vec3_t r1, shz_vec3_t r2, shz_vec3_t r3) SHZ_NOEXCEPT {
+    __m128 ml = shz_vec3_m128_(l);
+
+    return shz_m128_vec3_(shz_x86_dot4x4_(ml, shz_vec3_m128_(r1),
+                                              shz_vec3_m128_(r2),
+                                              shz_vec3_m128_(r3),
+                                              _mm_setzero_ps()));
+}
+
+SHZ_FORCE_INLINE shz_vec2_t shz_vec4_dot2_x86(shz_vec4_t l, shz_vec4_t r1, shz_vec4_t r2) SHZ_NOEXCEPT {
+    __m128 ml = shz_vec4_m128_(l);
+
+    return shz_m128_vec2_(_mm_or_ps(_mm_dp_ps(ml, shz_vec4_m128_(r1), 0xf1),
+                                    _mm_dp_ps(ml, shz_vec4_m128_(r2), 0xf2)));
+}
+
+SHZ_FORCE_INLINE shz_vec3_t shz_vec4_dot3_x86(shz_vec4_t l, shz_vec4_t r1, shz_vec4_t r2, shz_vec4_t r3) SHZ_NOEXCEPT {
+    __m128 ml = shz_vec4_m128_(l);
+
+    return shz_m128_vec3_(shz_x86_dot4x4_(ml, shz_vec4_m128_(r1),
+                                              shz_vec4_m128_(r2),
+                                              shz_vec4_m128_(r3),
+                                              _mm_setzero_ps()));
+}
+
+//! \endcond
+
+#endif
@@ -0,0 +1,106 @@
+//! \cond INTERNAL
+/*! \file
+    \brief x86 SSE/AVX implementation of the XMTRX API.
+    \ingroup xmtrx
+
+    This file contains the x86-64 SIMD implementation routines for
+    the XMTRX (active matrix) API. The simulated XMTRX state is shared
+    with the SW back-end, which provides every operation not explicitly
+    accelerated here.
+
+    The hot paths (loading, storing, applying, and transforming) emulate
+    FTRV with SSE4.1 broadcasts and (fused) multiply-adds.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+#ifndef SHZ_XMTRX_X86_INL_H
+#define SHZ_XMTRX_X86_INL_H
+
+#include "../sw/shz_xmtrx_sw.inl.h"
+
+/* Emulates FTRV: returns state * v. */
+SHZ_FORCE_INLINE __m128 shz_xmtrx_ftrv_x86_(const shz_xmtrx__t* state, __m128 v) SHZ_NOEXCEPT {
+    __m128 r = _mm_mul_ps(_mm_loadu_ps(state->col[0].e), shz_x86_splat_(v, 0));
+    r = shz_x86_madd_(_mm_loadu_ps(state->col[1].e), shz_x86_splat_(v, 1), r);
+    r = shz_x86_madd_(_mm_loadu_ps(state->col[2].e), shz_x86_splat_(v, 2), r);
+    r = shz_x86_madd_(_mm_loadu_ps(state->col[3].e), shz_x86_splat_(v, 3), r);
+    return r;
+}
+
+/* dst = state * src, for 4 columns. dst may alias src or the state. */
+SHZ_FORCE_INLINE void shz_xmtrx_mul4x4_x86_(const shz_xmtrx__t* state, float* dst, const float* src) SHZ_NOEXCEPT {
+    __m128 r0 = shz_xmtrx_ftrv_x86_(state, _mm_loadu_ps(&src[ 0]));
+    __m128 r1 = shz_xmtrx_ftrv_x86_(state, _mm_loadu_ps(&src[ 4]));
+    __m128 r2 = shz_xmtrx_ftrv_x86_(state, _mm_loadu_ps(&src[ 8]));
+    __m128 r3 = shz_xmtrx_ftrv_x86_(state, _mm_loadu_ps(&src[12]));
+
+    _mm_storeu_ps(&dst[ 0], r0);
+    _mm_storeu_ps(&dst[ 4], r1);
+    _mm_storeu_ps(&dst[ 8], r2);
+    _mm_storeu_ps(&dst[12], r3);
+}
+
+SHZ_FORCE_INLINE void shz_xmtrx_ctx_load_4x4_x86(shz_xmtrx_ctx_t* ctx, const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+    shz_x86_copy16_(((shz_xmtrx__t*)ctx)->elem, (const float*)matrix);
+}
+
+SHZ_FORCE_INLINE void shz_xmtrx_load_4x4_x86(const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+    shz_xmtrx_ctx_load_4x4_x86(shz_xmtrx_ctx_acquire_sw(), matrix);
+}
+
+SHZ_FORCE_INLINE void shz_xmtrx_ctx_store_4x4_x86(shz_xmtrx_ctx_t* ctx, shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+    shz_x86_copy16_((float*)matrix, ((const shz_xmtrx__t*)ctx)->elem);
+}
+
+SHZ_FORCE_INLINE void shz_xmtrx_store_4x4_x86(shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+    shz_xmtrx_ctx_store_4x4_x86(shz_xmtrx_ctx_acquire_sw(), matrix);
+}
+
+SHZ_FORCE_INLINE void shz_xmtrx_ctx_apply_4x4_x86(shz_xmtrx_ctx_t* ctx, const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+    shz_xmtrx__t* state = (shz_xmtrx__t*)ctx;
+
+    shz_xmtrx_mul4x4_x86_(state, state->elem, (const float*)matrix);
+}
+
+SHZ_FORCE_INLINE void shz_xmtrx_apply_4x4_x86(const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+    shz_xmtrx_ctx_apply_4x4_x86(shz_xmtrx_ctx_acquire_sw(), matrix);
+}
+
+SHZ_FORCE_INLINE void shz_xmtrx_ctx_load_apply_4x4_x86(shz_xmtrx_ctx_t* ctx,
+                                                       const shz_mat4x4_t* matrix1,
+                                                       const shz_mat4x4_t* matrix2) SHZ_NOEXCEPT {
+    shz_xmtrx__t* state = (shz_xmtrx__t*)ctx;
+
+    shz_x86_copy16_(state->elem, (const float*)matrix1);
+    shz_xmtrx_mul4x4_x86_(state, state->elem, (const float*)matrix2);
+}
+
+SHZ_FORCE_INLINE void shz_xmtrx_load_apply_4x4_x86(const shz_mat4x4_t* matrix1,
+                                                   const shz_mat4x4_t* matrix2) SHZ_NOEXCEPT {
+    shz_xmtrx_ctx_load_apply_4x4_x86(shz_xmtrx_ctx_acquire_sw(), matrix1, matrix2);
+}
+
+SHZ_INLINE void shz_xmtrx_ctx_apply_store_4x4_x86(shz_xmtrx_ctx_t* ctx,
+                                                  shz_mat4x4_t* out,
+                                                  const shz_mat4x4_t* in) SHZ_NOEXCEPT {
+    shz_xmtrx_mul4x4_x86_((const shz_xmtrx__t*)ctx, (float*)out, (const float*)in);
+}
+
+SHZ_INLINE void shz_xmtrx_apply_store_4x4_x86(shz_mat4x4_t* out,
+                                              const shz_mat4x4_t* in) SHZ_NOEXCEPT {
+    shz_xmtrx_ctx_apply_store_4x4_x86(shz_xmtrx_ctx_acquire_sw(), out, in);
+}
+
+SHZ_FORCE_INLINE shz_vec4_t shz_xmtrx_ctx_transform_vec4_x86(shz_xmtrx_ctx_t* ctx, shz_vec4_t vec) SHZ_NOEXCEPT {
+    return shz_m128_vec4_(shz_xmtrx_ftrv_x86_((const shz_xmtrx__t*)ctx, shz_vec4_m128_(vec)));
+}
+
+SHZ_FORCE_INLINE shz_vec4_t shz_xmtrx_transform_vec4_x86(shz_vec4_t vec) SHZ_NOEXCEPT {
+    return shz_xmtrx_ctx_transform_vec4_x86(shz_xmtrx_ctx_acquire_sw(), vec);
+}
+
+//! \endcond
+
+#endif
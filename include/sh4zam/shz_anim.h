@@ -0,0 +1,118 @@
+/*! \file
+    \brief Routines for sampling keyframed animation.
+    \ingroup anim
+
+    This file contains the public types and interface of the keyframe
+    sampler, which evaluates the scalar, vector, and rotation tracks of
+    animation clips.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#ifndef SHZ_ANIM_H
+#define SHZ_ANIM_H
+
+#include "shz_quat.h"
+
+/*! \defgroup anim Animation
+    \brief    Keyframe sampling of animation clips.
+
+    A clip is a set of tracks, each of which holds the keyframes of a
+    single animated value, such as one bone's rotation, within two packed
+    arrays: one of ascending key times, and one of key values.
+
+    Every animated instance keeps one cursor per track, remembering the
+    keyframe segment it last sampled. Sampling first checks that segment,
+    then walks forwards a few keys, and only binary searches the key
+    times upon seeking or looping back, so sequential playback takes
+    constant time per track.
+
+    Cursors must be zero-initialized before an instance's first sample,
+    and are otherwise only ever read and written by the sampler.
+*/
+
+SHZ_DECLS_BEGIN
+
+//! Type of value animated by a track, whose value is its number of components.
+typedef enum shz_anim_type {
+    SHZ_ANIM_SCALAR = 1,    //!< Single float.
+    SHZ_ANIM_VEC3   = 3,    //!< shz_vec3_t, such as a translation or scale.
+    SHZ_ANIM_QUAT   = 4     //!< shz_quat_t, as a rotation.
+} shz_anim_type_t;
+
+/*! Method of interpolating between the keyframes of a track.
+
+    \note
+    Rotations are interpolated with normalized LERP, which closely
+    matches SLERP across the short segments of sampled animation, and
+    with normalized cubic Hermite splines over their components.
+*/
+typedef enum shz_anim_interp {
+    SHZ_ANIM_STEP,          //!< Holds each key's value until the next key.
+    SHZ_ANIM_LINEAR,        //!< Linearly interpolates between keys.
+    SHZ_ANIM_CUBIC          //!< Cubic Hermite spline through keys, with explicit tangents.
+} shz_anim_interp_t;
+
+/*! Packed keyframes of a single animated value.
+
+    The values of each key are stored contiguously, in order, within
+    \p values. SHZ_ANIM_CUBIC tracks store three values per key, being its
+    incoming tangent, its value, then its outgoing tangent, where tangents
+    are expressed per second, as within glTF.
+*/
+typedef struct shz_anim_track {
+    shz_anim_type_t   type;     //!< Type of animated value.
+    shz_anim_interp_t interp;   //!< Interpolation between keys.
+    uint32_t          keys;     //!< Number of keyframes, which must be at least 1.
+    uint32_t          offset;   //!< Index of the first float of the track's output within a sample.
+    const float*      times;    //!< Ascending time of each keyframe, in seconds.
+    const float*      values;   //!< Packed components of each keyframe.
+} shz_anim_track_t;
+
+//! Alternate shz_anim_track_t C typedef for those who hate POSIX style.
+typedef shz_anim_track_t shz_anim_track;
+
+//! Set of tracks which are animated together.
+typedef struct shz_anim_clip {
+    const shz_anim_track_t* tracks;       //!< Array of tracks.
+    size_t                  track_count;  //!< Number of tracks.
+} shz_anim_clip_t;
+
+//! Alternate shz_anim_clip_t C typedef for those who hate POSIX style.
+typedef shz_anim_clip_t shz_anim_clip;
+
+/*! \name  Sampling
+    \brief Routines evaluating every track of a clip.
+    @{
+*/
+
+/*! Samples every track of \p clip at \p time, in seconds.
+
+    Each track writes its value into \p dst, starting at its own offset.
+    Times before the first or after the last key of a track are clamped.
+
+    \param clip     Clip to sample.
+    \param time     Time within the clip, in seconds.
+    \param cursors  One cursor per track for the sampled instance.
+    \param dst      Destination of the sampled values.
+*/
+void shz_anim_sample(const shz_anim_clip_t* clip, float time, uint32_t* cursors, float* dst) SHZ_NOEXCEPT;
+
+/*! Samples every track of \p clip for each of \p instances animated instances.
+
+    Equivalent to calling shz_anim_sample() for each instance, with
+    `times[i]`, the `clip->track_count` cursors beginning at
+    `cursors[i * clip->track_count]`, and `dsts[i]`, except that each
+    track is evaluated for every instance at once, keeping its keys
+    cached and its type and interpolation resolved.
+*/
+void shz_anim_sample_instances(const shz_anim_clip_t* clip, const float* times, uint32_t* cursors,
+                               float* const* dsts, size_t instances) SHZ_NOEXCEPT;
+
+//! @}
+
+SHZ_DECLS_END
+
+#endif // SHZ_ANIM_H
@@ -0,0 +1,38 @@
+/*! \file
+    \brief   C++ routines for sampling keyframed animation.
+    \ingroup anim
+
+    This file provides a C++ binding layer over the C API provided by
+    shz_anim.h.
+
+    \author    2026 Falco Girgis
+    \copyright MIT License
+*/
+
+#ifndef SHZ_ANIM_HPP
+#define SHZ_ANIM_HPP
+
+#include "shz_anim.h"
+#include "shz_quat.hpp"
+
+namespace shz {
+
+    //! C++ alias for the packed keyframes of a single animated value.
+    using anim_track = shz_anim_track_t;
+
+    //! C++ alias for a set of tracks which are animated together.
+    using anim_clip = shz_anim_clip_t;
+
+    //! C++ wrapper around shz_anim_sample(), which samples every track of a clip for one instance.
+    SHZ_FORCE_INLINE void sample(const anim_clip& clip, float time, uint32_t* cursors, float* dst) noexcept {
+        shz_anim_sample(&clip, time, cursors, dst);
+    }
+
+    //! C++ wrapper around shz_anim_sample_instances(), which samples every track of a clip for many instances.
+    SHZ_FORCE_INLINE void sample(const anim_clip& clip, const float* times, uint32_t* cursors,
+                                 float* const* dsts, size_t instances) noexcept {
+        shz_anim_sample_instances(&clip, times, cursors, dsts, instances);
+    }
+}
+
+#endif
@@ -59,11 +59,30 @@
 #ifndef SHZ_TLS_MODEL
 #   if SHZ_BACKEND == SHZ_SH4
 #       define SHZ_TLS_MODEL    SHZ_TLS_IMPLICIT    // SH4 back-end supports compiler-level TLS.
-#   elif SHZ_BACKEND == SHZ_SW
-#       define SHZ_TLS_MODEL    SHZ_TLS_PTHREAD     // SW back-end uses pthread-based TLS for compatibilty.
+#   else
+#       define SHZ_TLS_MODEL    SHZ_TLS_PTHREAD     // SW and host back-ends use pthread-based TLS for compatibilty.
 #   endif
 #endif
 
+/*! \name  Precision Tiers
+    \brief Defines for selecting the accuracy of approximated functions.
+
+    The log/exp/pow, inverse trig, hyperbolic, and cube root families each
+    pick the degree of their approximations from \ref SHZ_PRECISION, trading
+    cycles for accuracy. The unit test suite prints the maximum error and the
+    cost of each function for every tier.
+    @{
+*/
+#define SHZ_PRECISION_FAST      0   //!< Cheapest approximations, with only a few bits of accuracy.
+#define SHZ_PRECISION_BALANCED  1   //!< Low-degree polynomials, accurate to roughly 1e-4.
+#define SHZ_PRECISION_PRECISE   2   //!< Full polynomials, accurate to within a few ULPs.
+//! @}
+
+// Default to the fastest approximations, which have always been used.
+#ifndef SHZ_PRECISION
+#   define SHZ_PRECISION    SHZ_PRECISION_FAST
+#endif
+
 /*! \name  Compiler Detection
     \brief Defines for identifying the detected compiler.
     @{
@@ -152,6 +171,12 @@
 #   define SHZ_PREFETCH(a)             __builtin_prefetch(a)
     //! Tells GCC the pointer paraemter is unique and is not aliased by another parameter
 #   define SHZ_RESTRICT                __restrict__
+    //! Tells the compiler the following loop has no loop-carried dependencies through memory, so it may be vectorized
+#   ifdef __clang__
+#       define SHZ_IVDEP               _Pragma("clang loop vectorize(assume_safety)")
+#   else
+#       define SHZ_IVDEP               _Pragma("GCC ivdep")
+#   endif
     //! Creates a software memory barrier beyond which any loads or stores may not be reordered
 #   define SHZ_MEMORY_BARRIER_SOFT()   asm volatile("" : : : "memory")
     //! Creates a hardware memory barrier beyond which any loads or stores may not be reordered
@@ -197,6 +222,8 @@
 #   define SHZ_PREFETCH(a)
     //! Tells MSVC the pointer paraemter is unique and is not aliased by another parameter.
 #   define SHZ_RESTRICT               __restrict
+    //! Tells MSVC the following loop has no loop-carried dependencies through memory.
+#   define SHZ_IVDEP                  __pragma(loop(ivdep))
     //! Unimplemented for MSVC.
 #   define SHZ_MEMORY_BARRIER_SOFT()
     //! Unimpemented for MSVC.
@@ -43,6 +43,23 @@ namespace shz {
     using alias_double_t = shz_alias_double_t;
 
     //! @}
+
+    /*! \name  Precision Tiers
+     *  \brief C++ wrappers for the precision tier defines.
+     *  @{
+     */
+
+    //! Accuracy tier of an approximated function, passed as a template argument to the routines in shz::approx.
+    enum class precision: int {
+        fast     = SHZ_PRECISION_FAST,      //!< C++ wrapper around SHZ_PRECISION_FAST.
+        balanced = SHZ_PRECISION_BALANCED,  //!< C++ wrapper around SHZ_PRECISION_BALANCED.
+        precise  = SHZ_PRECISION_PRECISE    //!< C++ wrapper around SHZ_PRECISION_PRECISE.
+    };
+
+    //! Tier selected by SHZ_PRECISION, which is used when no template argument is given.
+    constexpr precision default_precision = static_cast<precision>(SHZ_PRECISION);
+
+    //! @}
 }
 
 #endif
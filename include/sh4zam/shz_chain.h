@@ -0,0 +1,175 @@
+/*! \file
+    \brief Recording and folding of transform chains.
+    \ingroup chain
+
+    This file contains the public types and interface for recording a
+    sequence of transform operations, which are folded together into a
+    single cached matrix before being executed upon XMTRX.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#ifndef SHZ_CHAIN_H
+#define SHZ_CHAIN_H
+
+#include "shz_matrix.h"
+
+/*! \defgroup chain Chain
+    \brief    Lazily evaluated, cached sequences of transforms.
+
+    A chain records the same operations which would otherwise be issued
+    one after another against XMTRX, such as when building a camera
+    matrix from a screen, perspective, rotation, and translation. Each
+    operation is post-multiplied onto the ones recorded before it, in the
+    same order as with the shz_xmtrx_translate(), shz_xmtrx_scale(),
+    shz_xmtrx_rotate_x(), shz_xmtrx_apply_screen(), and
+    shz_xmtrx_apply_perspective() family of routines.
+
+    Rather than performing a full 4x4 multiplication per operation, the
+    chain is compiled by folding each operation into an accumulated matrix,
+    updating only the columns which it actually touches: a translation
+    only updates the last column, a scale or perspective projection only
+    scales or swaps columns, and an axis rotation only mixes the two
+    columns about its axis. Only matrices recorded with
+    shz_chain_apply_4x4() require a full multiplication through XMTRX.
+
+    The compiled matrix is cached within the chain. Every frame may
+    simply re-record the whole chain between shz_chain_begin() and
+    executing it, in which case it is only compiled again when an
+    operation or one of its arguments differs from the previous frame.
+
+    \sa xmtrx
+*/
+
+SHZ_DECLS_BEGIN
+
+//! Types of operations which may be recorded within a chain.
+typedef enum shz_chain_op_type {
+    SHZ_CHAIN_TRANSLATE,    //!< Translation by (x, y, z).
+    SHZ_CHAIN_SCALE,        //!< Scale by (x, y, z).
+    SHZ_CHAIN_ROTATE_X,     //!< Rotation about the X axis, in radians.
+    SHZ_CHAIN_ROTATE_Y,     //!< Rotation about the Y axis, in radians.
+    SHZ_CHAIN_ROTATE_Z,     //!< Rotation about the Z axis, in radians.
+    SHZ_CHAIN_ROTATE_QUAT,  //!< Rotation by the (w, x, y, z) unit quaternion.
+    SHZ_CHAIN_SCREEN,       //!< Viewport transform of the given width and height.
+    SHZ_CHAIN_PERSPECTIVE,  //!< Perspective projection from the field-of-view, aspect ratio, and near plane.
+    SHZ_CHAIN_MATRIX        //!< Arbitrary 4x4 matrix, which is referenced rather than copied.
+} shz_chain_op_type_t;
+
+//! Alternate shz_chain_op_type_t C typedef for those who hate POSIX style.
+typedef shz_chain_op_type_t shz_chain_op_type;
+
+//! Single recorded operation, along with its arguments.
+typedef struct shz_chain_op {
+    shz_chain_op_type_t     type;       //!< Type of the operation.
+    union {
+        float               args[4];    //!< Arguments of every operation other than SHZ_CHAIN_MATRIX, with unused ones zeroed.
+        const shz_mat4x4_t* matrix;     //!< Matrix applied by SHZ_CHAIN_MATRIX.
+    };
+} shz_chain_op_t;
+
+//! Alternate shz_chain_op_t C typedef for those who hate POSIX style.
+typedef shz_chain_op_t shz_chain_op;
+
+/*! Recorded sequence of operations, along with its cached compiled matrix.
+
+    The operations are stored within a user-provided array, given to
+    shz_chain_init().
+
+    \warning This structure must be aligned to an 8-byte boundary!
+*/
+typedef struct shz_chain {
+    shz_mat4x4_t    matrix;     //!< Product of every recorded operation, as of the last compilation.
+    shz_chain_op_t* ops;        //!< Storage for the recorded operations.
+    size_t          capacity;   //!< Maximum number of operations which may be recorded.
+    size_t          count;      //!< Number of operations recorded since shz_chain_begin().
+    size_t          compiled;   //!< Number of operations which \p matrix was compiled from.
+    bool            dirty;      //!< Whether any operation has changed since \p matrix was compiled.
+} shz_chain_t;
+
+//! Alternate shz_chain_t C typedef for those who hate POSIX style.
+typedef shz_chain_t shz_chain;
+
+/*! \name  Recording
+    \brief Routines for recording operations onto a chain.
+
+    Each operation is compared against the one previously recorded at the
+    same position, only marking the chain as dirty when they differ.
+
+    \warning Recording more operations than the chain's capacity is undefined behavior.
+    @{
+*/
+
+//! Initializes an empty \p chain, recording into \p ops, which holds up to \p capacity operations.
+void shz_chain_init(shz_chain_t* chain, shz_chain_op_t* ops, size_t capacity) SHZ_NOEXCEPT;
+
+//! Begins recording \p chain over again, retaining its previous operations to compare against.
+void shz_chain_begin(shz_chain_t* chain) SHZ_NOEXCEPT;
+
+/*! Forces \p chain to be recompiled before its next use.
+
+    Matrices recorded with shz_chain_apply_4x4() are compared by address,
+    so this must be called after modifying one's contents in place.
+*/
+void shz_chain_invalidate(shz_chain_t* chain) SHZ_NOEXCEPT;
+
+//! Records a translation by (\p x, \p y, \p z) onto \p chain, as with shz_xmtrx_translate().
+void shz_chain_translate(shz_chain_t* chain, float x, float y, float z) SHZ_NOEXCEPT;
+
+//! Records a scale by (\p x, \p y, \p z) onto \p chain, as with shz_xmtrx_scale().
+void shz_chain_scale(shz_chain_t* chain, float x, float y, float z) SHZ_NOEXCEPT;
+
+//! Records a rotation about the X axis by \p radians onto \p chain, as with shz_xmtrx_rotate_x().
+void shz_chain_rotate_x(shz_chain_t* chain, float radians) SHZ_NOEXCEPT;
+
+//! Records a rotation about the Y axis by \p radians onto \p chain, as with shz_xmtrx_rotate_y().
+void shz_chain_rotate_y(shz_chain_t* chain, float radians) SHZ_NOEXCEPT;
+
+//! Records a rotation about the Z axis by \p radians onto \p chain, as with shz_xmtrx_rotate_z().
+void shz_chain_rotate_z(shz_chain_t* chain, float radians) SHZ_NOEXCEPT;
+
+//! Records a rotation by the unit quaternion \p q onto \p chain, as with shz_mat4x4_init_rotation_quat().
+void shz_chain_rotate_quat(shz_chain_t* chain, shz_quat_t q) SHZ_NOEXCEPT;
+
+//! Records a viewport transform onto \p chain, as with shz_xmtrx_apply_screen().
+void shz_chain_apply_screen(shz_chain_t* chain, float width, float height) SHZ_NOEXCEPT;
+
+//! Records a perspective projection onto \p chain, as with shz_xmtrx_apply_perspective().
+void shz_chain_apply_perspective(shz_chain_t* chain, float fov, float aspect, float znear) SHZ_NOEXCEPT;
+
+/*! Records the multiplication by an arbitrary \p matrix onto \p chain, as with shz_xmtrx_apply_4x4().
+
+    \warning \p matrix is referenced rather than copied, so it must remain
+    valid until \p chain is compiled.
+*/
+void shz_chain_apply_4x4(shz_chain_t* chain, const shz_mat4x4_t* matrix) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Execution
+    \brief Routines for compiling chains and applying them to XMTRX.
+
+    Each routine first compiles the chain when it has changed since its
+    last compilation, otherwise its cached matrix is reused.
+    @{
+*/
+
+/*! Returns the product of every operation recorded onto \p chain, compiling it if necessary.
+
+    \warning This routine clobbers XMTRX when the chain contains matrices recorded with shz_chain_apply_4x4().
+*/
+const shz_mat4x4_t* shz_chain_compile(shz_chain_t* chain) SHZ_NOEXCEPT;
+
+//! Loads the product of every operation recorded onto \p chain into XMTRX.
+void shz_chain_load(shz_chain_t* chain) SHZ_NOEXCEPT;
+
+//! Multiplies XMTRX by the product of every operation recorded onto \p chain, storing the result in XMTRX.
+void shz_chain_apply(shz_chain_t* chain) SHZ_NOEXCEPT;
+
+//! @}
+
+SHZ_DECLS_END
+
+#endif // SHZ_CHAIN_H
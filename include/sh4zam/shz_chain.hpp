@@ -0,0 +1,125 @@
+/*! \file
+    \brief   C++ routines for recording and folding transform chains.
+    \ingroup chain
+
+    This file provides a C++ binding layer over the C API provided by
+    shz_chain.h.
+
+    \author    2026 Falco Girgis
+    \copyright MIT License
+*/
+
+#ifndef SHZ_CHAIN_HPP
+#define SHZ_CHAIN_HPP
+
+#include "shz_chain.h"
+#include "shz_matrix.hpp"
+#include "shz_quat.hpp"
+
+namespace shz {
+
+    //! C++ alias for a single operation recorded within a chain.
+    using chain_op = shz_chain_op_t;
+
+    /*! C++ structure representing a recorded chain of transforms.
+
+        \note
+        shz::chain is the C++ extension of shz_chain_t, which adds member
+        functions and still retains backwards compatibility with the C API.
+
+        \sa shz_chain_t, shz::mat4x4
+    */
+    struct chain: public shz_chain_t {
+
+        //! Constructs an empty chain, recording into \p ops, which holds up to \p capacity operations.
+        SHZ_FORCE_INLINE chain(chain_op* ops, size_t capacity) noexcept {
+            shz_chain_init(this, ops, capacity);
+        }
+
+        /*! \name  Recording
+            \brief Routines for recording operations onto the chain.
+            @{
+        */
+
+        //! C++ wrapper around shz_chain_begin().
+        SHZ_FORCE_INLINE void begin() noexcept {
+            shz_chain_begin(this);
+        }
+
+        //! C++ wrapper around shz_chain_invalidate().
+        SHZ_FORCE_INLINE void invalidate() noexcept {
+            shz_chain_invalidate(this);
+        }
+
+        //! C++ wrapper around shz_chain_translate().
+        SHZ_FORCE_INLINE void translate(float x, float y, float z) noexcept {
+            shz_chain_translate(this, x, y, z);
+        }
+
+        //! C++ wrapper around shz_chain_scale().
+        SHZ_FORCE_INLINE void scale(float x, float y, float z) noexcept {
+            shz_chain_scale(this, x, y, z);
+        }
+
+        //! C++ wrapper around shz_chain_rotate_x().
+        SHZ_FORCE_INLINE void rotate_x(float radians) noexcept {
+            shz_chain_rotate_x(this, radians);
+        }
+
+        //! C++ wrapper around shz_chain_rotate_y().
+        SHZ_FORCE_INLINE void rotate_y(float radians) noexcept {
+            shz_chain_rotate_y(this, radians);
+        }
+
+        //! C++ wrapper around shz_chain_rotate_z().
+        SHZ_FORCE_INLINE void rotate_z(float radians) noexcept {
+            shz_chain_rotate_z(this, radians);
+        }
+
+        //! C++ wrapper around shz_chain_rotate_quat().
+        SHZ_FORCE_INLINE void rotate(quat q) noexcept {
+            shz_chain_rotate_quat(this, q);
+        }
+
+        //! C++ wrapper around shz_chain_apply_screen().
+        SHZ_FORCE_INLINE void apply_screen(float width, float height) noexcept {
+            shz_chain_apply_screen(this, width, height);
+        }
+
+        //! C++ wrapper around shz_chain_apply_perspective().
+        SHZ_FORCE_INLINE void apply_perspective(float fov, float aspect, float znear) noexcept {
+            shz_chain_apply_perspective(this, fov, aspect, znear);
+        }
+
+        //! C++ wrapper around shz_chain_apply_4x4().
+        SHZ_FORCE_INLINE void apply(const shz_mat4x4_t& matrix) noexcept {
+            shz_chain_apply_4x4(this, &matrix);
+        }
+
+        //! @}
+
+        /*! \name  Execution
+            \brief Routines for compiling the chain and applying it to XMTRX.
+            @{
+        */
+
+        //! C++ wrapper around shz_chain_compile().
+        SHZ_FORCE_INLINE const mat4x4& compile() noexcept {
+            return *static_cast<const mat4x4*>(shz_chain_compile(this));
+        }
+
+        //! C++ wrapper around shz_chain_load().
+        SHZ_FORCE_INLINE void load() noexcept {
+            shz_chain_load(this);
+        }
+
+        //! C++ wrapper around shz_chain_apply().
+        SHZ_FORCE_INLINE void apply() noexcept {
+            shz_chain_apply(this);
+        }
+
+        //! @}
+    };
+}
+
+#endif
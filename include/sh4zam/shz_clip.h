@@ -0,0 +1,156 @@
+/*! \file
+    \brief Routines for clipping primitives in clip-space.
+    \ingroup clip
+
+    This file contains the public types and interface for computing the
+    clip-space outcodes of a vertex buffer and clipping the triangles or
+    strips which straddle the near plane, or optionally any of the others.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#ifndef SHZ_CLIP_H
+#define SHZ_CLIP_H
+
+#include "shz_vector.h"
+
+/*! \defgroup clip Clipping
+    \brief    Outcodes and clipping of transformed primitives.
+
+    Clipping runs between transforming vertices into clip-space and the
+    perspective divide, as a stage over a whole buffer:
+
+    1. shz_clip_outcodes() computes the outcode of every vertex in a
+       single pass, returning the combination of all of them. When it
+       holds none of the planes being clipped against, the buffer may be
+       submitted as-is, with no further work.
+    2. shz_clip_triangles() or shz_clip_strip() then trivially rejects
+       primitives lying entirely outside of any plane, trivially accepts
+       those not crossing the planes being clipped against, and only clips
+       the primitives which straddle them.
+
+    Vertices are opaque to the clipper, other than their clip-space
+    position. New vertices along clipped edges are copies of the vertex
+    inside of the plane, with their position and every attribute given
+    by a shz_clip_layout_t interpolated.
+
+    Positions follow the OpenGL convention, where a vertex is within the
+    clip volume when -w <= x, y, z <= w. For the infinite projection of
+    shz_mat4x4_init_perspective(), the near plane is SHZ_CLIP_FAR.
+
+    \sa cull
+*/
+
+SHZ_DECLS_BEGIN
+
+//! Maximum size of a single vertex, in bytes, which may be clipped.
+#define SHZ_CLIP_VERTEX_SIZE_MAX    128
+
+//! Clip-space planes, as the bits of an outcode.
+typedef enum shz_clip_plane {
+    SHZ_CLIP_LEFT   = 0x01, //!< Set when x < -w.
+    SHZ_CLIP_RIGHT  = 0x02, //!< Set when x > w.
+    SHZ_CLIP_BOTTOM = 0x04, //!< Set when y < -w.
+    SHZ_CLIP_TOP    = 0x08, //!< Set when y > w.
+    SHZ_CLIP_NEAR   = 0x10, //!< Set when z < -w.
+    SHZ_CLIP_FAR    = 0x20, //!< Set when z > w.
+    SHZ_CLIP_ALL    = 0x3f  //!< Every plane.
+} shz_clip_plane_t;
+
+//! Alternate shz_clip_plane_t C typedef for those who hate POSIX style.
+typedef shz_clip_plane_t shz_clip_plane;
+
+//! Types of vertex attributes which may be interpolated along clipped edges.
+typedef enum shz_clip_attrib_type {
+    SHZ_CLIP_ATTRIB_FLOAT,      //!< Consecutive floats, each interpolated linearly.
+    SHZ_CLIP_ATTRIB_ARGB8888    //!< Consecutive packed 32-bit colors, each channel interpolated linearly.
+} shz_clip_attrib_type_t;
+
+//! Alternate shz_clip_attrib_type_t C typedef for those who hate POSIX style.
+typedef shz_clip_attrib_type_t shz_clip_attrib_type;
+
+//! Single interpolated attribute within a vertex.
+typedef struct shz_clip_attrib {
+    size_t                 offset;  //!< Offset of the attribute within each vertex, in bytes.
+    shz_clip_attrib_type_t type;    //!< Type of each component.
+    size_t                 count;   //!< Number of consecutive components.
+} shz_clip_attrib_t;
+
+//! Alternate shz_clip_attrib_t C typedef for those who hate POSIX style.
+typedef shz_clip_attrib_t shz_clip_attrib;
+
+//! Descriptor of the layout of each vertex within a buffer.
+typedef struct shz_clip_layout {
+    size_t                   stride;        //!< Size of each vertex, in bytes, up to SHZ_CLIP_VERTEX_SIZE_MAX.
+    size_t                   position;      //!< Offset of the clip-space <X, Y, Z, W> position, as consecutive floats.
+    const shz_clip_attrib_t* attribs;       //!< Attributes to interpolate, other than the position.
+    size_t                   attrib_count;  //!< Number of entries within \p attribs.
+} shz_clip_layout_t;
+
+//! Alternate shz_clip_layout_t C typedef for those who hate POSIX style.
+typedef shz_clip_layout_t shz_clip_layout;
+
+/*! \name  Outcodes
+    \brief Routines for classifying vertices against the clip volume.
+    @{
+*/
+
+//! Returns the outcode of the given clip-space position, with the bit of each plane it lies outside of set.
+SHZ_INLINE uint8_t shz_clip_outcode(shz_vec4_t pos) SHZ_NOEXCEPT;
+
+/*! Computes the outcode of each of the \p count vertices within \p vertices into \p outcodes.
+
+    Returns the bitwise OR of every outcode, which is 0 when the whole
+    buffer lies within the clip volume.
+*/
+uint8_t shz_clip_outcodes(const shz_clip_layout_t* layout,
+                          const void*              vertices,
+                          size_t                   count,
+                          uint8_t*                 outcodes) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Clipping
+    \brief Routines for clipping primitives against the clip volume.
+
+    Each routine takes the outcodes computed by shz_clip_outcodes() and
+    the set of \p planes to clip against, writing a list of independent
+    triangles into \p out, then returns how many vertices it wrote.
+
+    Primitives lying entirely outside of any single plane are dropped,
+    whether or not it's within \p planes. Primitives which merely cross
+    planes outside of \p planes are kept as-is, to be clipped or guard-band
+    culled by hardware.
+
+    \warning \p out must have room for shz_clip_vertices_max() vertices.
+    @{
+*/
+
+//! Returns the maximum number of vertices which clipping \p triangles triangles against \p planes may output.
+SHZ_INLINE size_t shz_clip_vertices_max(size_t triangles, uint8_t planes) SHZ_NOEXCEPT;
+
+//! Clips a list of \p count / 3 independent triangles against \p planes.
+size_t shz_clip_triangles(const shz_clip_layout_t* layout,
+                          const void*              vertices,
+                          const uint8_t*           outcodes,
+                          size_t                   count,
+                          uint8_t                  planes,
+                          void*                    out) SHZ_NOEXCEPT;
+
+//! Clips a triangle strip of \p count vertices against \p planes, preserving the winding of each triangle.
+size_t shz_clip_strip(const shz_clip_layout_t* layout,
+                      const void*              vertices,
+                      const uint8_t*           outcodes,
+                      size_t                   count,
+                      uint8_t                  planes,
+                      void*                    out) SHZ_NOEXCEPT;
+
+//! @}
+
+#include "inline/shz_clip.inl.h"
+
+SHZ_DECLS_END
+
+#endif // SHZ_CLIP_H
@@ -0,0 +1,63 @@
+/*! \file
+    \brief   C++ routines for clipping primitives in clip-space.
+    \ingroup clip
+
+    This file provides a C++ binding layer over the C API provided by
+    shz_clip.h.
+
+    \author    2026 Falco Girgis
+    \copyright MIT License
+*/
+
+#ifndef SHZ_CLIP_HPP
+#define SHZ_CLIP_HPP
+
+#include "shz_clip.h"
+#include "shz_vector.hpp"
+
+namespace shz {
+
+    //! C++ alias for an interpolated vertex attribute.
+    using clip_attrib = shz_clip_attrib_t;
+
+    //! C++ wrapper around shz_clip_outcode().
+    SHZ_FORCE_INLINE uint8_t clip_outcode(shz_vec4_t pos) noexcept {
+        return shz_clip_outcode(pos);
+    }
+
+    /*! C++ structure describing the layout of clipped vertices.
+
+        \note
+        shz::clip_layout is the C++ extension of shz_clip_layout_t, which
+        adds member functions for running each stage of clipping over a
+        buffer and still retains backwards compatibility with the C API.
+
+        \sa shz_clip_layout_t
+    */
+    struct clip_layout: public shz_clip_layout_t {
+
+        //! Default constructor, which does nothing.
+        clip_layout() noexcept = default;
+
+        //! Constructs a layout from the vertex stride, position offset, and the array of \p count attributes.
+        SHZ_FORCE_INLINE clip_layout(size_t stride, size_t position, const clip_attrib* attribs = nullptr, size_t count = 0) noexcept:
+            shz_clip_layout_t({ stride, position, attribs, count }) {}
+
+        //! C++ wrapper around shz_clip_outcodes().
+        SHZ_FORCE_INLINE uint8_t outcodes(const void* vertices, size_t count, uint8_t* codes) const noexcept {
+            return shz_clip_outcodes(this, vertices, count, codes);
+        }
+
+        //! C++ wrapper around shz_clip_triangles().
+        SHZ_FORCE_INLINE size_t triangles(const void* vertices, const uint8_t* codes, size_t count, uint8_t planes, void* out) const noexcept {
+            return shz_clip_triangles(this, vertices, codes, count, planes, out);
+        }
+
+        //! C++ wrapper around shz_clip_strip().
+        SHZ_FORCE_INLINE size_t strip(const void* vertices, const uint8_t* codes, size_t count, uint8_t planes, void* out) const noexcept {
+            return shz_clip_strip(this, vertices, codes, count, planes, out);
+        }
+    };
+}
+
+#endif
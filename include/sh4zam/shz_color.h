@@ -0,0 +1,130 @@
+/*! \file
+    \brief Routines for packed color math.
+    \ingroup color
+
+    This file contains the public interface for converting between
+    floating-point and packed colors, converting between the PVR's packed
+    color formats, and blending packed colors, both one at a time and over
+    arrays.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#ifndef SHZ_COLOR_H
+#define SHZ_COLOR_H
+
+#include "shz_vector.h"
+
+/*! \defgroup color Color
+    \brief    Packed color math.
+
+    Colors are packed as 32-bit ARGB8888, with alpha within the most
+    significant byte, as consumed by the PVR for vertex colors. Floating-
+    point colors are given as 4D vectors of <R, G, B, A>, ranging from
+    0.0f to 1.0f.
+
+    Packed colors are blended without ever unpacking them to floats, by
+    operating on multiple channels at a time within integer registers.
+    The array routines additionally use SIMD on the x86 back-end.
+
+    Textures may also be converted to and from the PVR's 16-bit formats,
+    optionally applying an ordered dither to hide banding.
+*/
+
+SHZ_DECLS_BEGIN
+
+//! 16-bit packed color formats, using the same values as the PVR's texture formats.
+typedef enum shz_color_format {
+    SHZ_COLOR_ARGB1555 = 0, //!< 1-bit alpha with 5-bit R, G, and B.
+    SHZ_COLOR_RGB565   = 1, //!< No alpha with 5-bit R and B and 6-bit G.
+    SHZ_COLOR_ARGB4444 = 2  //!< 4-bit A, R, G, and B.
+} shz_color_format_t;
+
+//! Alternate shz_color_format_t C typedef for those who hate POSIX style.
+typedef shz_color_format_t shz_color_format;
+
+/*! \name  Conversion
+    \brief Routines for converting between color representations.
+    @{
+*/
+
+//! Packs the given <R, G, B, A> color into ARGB8888, saturating and rounding each channel.
+SHZ_INLINE uint32_t shz_color_pack(shz_vec4_t rgba) SHZ_NOEXCEPT;
+
+//! Unpacks the given ARGB8888 color into <R, G, B, A>.
+SHZ_INLINE shz_vec4_t shz_color_unpack(uint32_t argb) SHZ_NOEXCEPT;
+
+//! Converts the given ARGB8888 color to the 16-bit \p format, truncating each channel.
+SHZ_INLINE uint16_t shz_color_to16(uint32_t argb, shz_color_format_t format) SHZ_NOEXCEPT;
+
+//! Converts the given color in the 16-bit \p format to ARGB8888, replicating the bits of each channel to fill it.
+SHZ_INLINE uint32_t shz_color_from16(uint16_t color, shz_color_format_t format) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Blending
+    \brief Routines for blending packed colors.
+    @{
+*/
+
+//! Linearly interpolates every channel of two ARGB8888 colors by \p t, which is clamped to [0.0f, 1.0f].
+SHZ_INLINE uint32_t shz_color_lerp(uint32_t a, uint32_t b, float t) SHZ_NOEXCEPT;
+
+//! Multiplies every channel of two ARGB8888 colors together, as if each were from 0.0f to 1.0f.
+SHZ_INLINE uint32_t shz_color_modulate(uint32_t a, uint32_t b) SHZ_NOEXCEPT;
+
+//! Adds every channel of two ARGB8888 colors together, saturating at 255.
+SHZ_INLINE uint32_t shz_color_add(uint32_t a, uint32_t b) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Arrays
+    \brief Routines for converting and blending arrays of colors.
+
+    Each routine processes \p count colors. Those whose \p dst holds the
+    same type of element as their sources, namely the lerp, modulate and
+    add routines, may operate in-place, with \p dst being the same array
+    as a source. The rest convert between elements of different sizes,
+    so \p dst must not overlap \p src.
+    @{
+*/
+
+//! Packs an array of <R, G, B, A> colors into ARGB8888.
+void shz_color_pack_array(uint32_t* dst, const shz_vec4_t* src, size_t count) SHZ_NOEXCEPT;
+
+//! Unpacks an array of ARGB8888 colors into <R, G, B, A>.
+void shz_color_unpack_array(shz_vec4_t* dst, const uint32_t* src, size_t count) SHZ_NOEXCEPT;
+
+//! Converts an array of ARGB8888 colors to the 16-bit \p format.
+void shz_color_to16_array(uint16_t* dst, const uint32_t* src, size_t count, shz_color_format_t format) SHZ_NOEXCEPT;
+
+//! Converts an array of colors in the 16-bit \p format to ARGB8888.
+void shz_color_from16_array(uint32_t* dst, const uint16_t* src, size_t count, shz_color_format_t format) SHZ_NOEXCEPT;
+
+/*! Converts a \p width by \p height image of ARGB8888 colors to the 16-bit \p format with ordered dithering.
+
+    Rather than being truncated, each channel is quantized against the
+    thresholds of a 4x4 Bayer matrix, trading banding for a fine, regular
+    pattern which averages out to the original color once widened again.
+    The alpha of SHZ_COLOR_ARGB1555 is not dithered, but thresholded at 128.
+*/
+void shz_color_dither16(uint16_t* dst, const uint32_t* src, size_t width, size_t height, shz_color_format_t format) SHZ_NOEXCEPT;
+
+//! Linearly interpolates between two arrays of ARGB8888 colors by \p t, as with shz_color_lerp().
+void shz_color_lerp_array(uint32_t* dst, const uint32_t* a, const uint32_t* b, size_t count, float t) SHZ_NOEXCEPT;
+
+//! Multiplies two arrays of ARGB8888 colors together, as with shz_color_modulate().
+void shz_color_modulate_array(uint32_t* dst, const uint32_t* a, const uint32_t* b, size_t count) SHZ_NOEXCEPT;
+
+//! Adds two arrays of ARGB8888 colors together, saturating, as with shz_color_add().
+void shz_color_add_array(uint32_t* dst, const uint32_t* a, const uint32_t* b, size_t count) SHZ_NOEXCEPT;
+
+//! @}
+
+#include "inline/shz_color.inl.h"
+
+SHZ_DECLS_END
+
+#endif // SHZ_COLOR_H
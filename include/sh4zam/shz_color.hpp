@@ -0,0 +1,114 @@
+/*! \file
+    \brief   C++ routines for packed color math.
+    \ingroup color
+
+    This file provides a C++ binding layer over the C API provided by
+    shz_color.h, overloading each routine for both single colors and
+    arrays of them.
+
+    \author    2026 Falco Girgis
+    \copyright MIT License
+*/
+
+#ifndef SHZ_COLOR_HPP
+#define SHZ_COLOR_HPP
+
+#include "shz_color.h"
+#include "shz_vector.hpp"
+
+namespace shz {
+
+    //! C++ alias for the 16-bit packed color formats.
+    using color_format = shz_color_format_t;
+
+    /*! \name  Conversion
+        \brief Routines for converting between color representations.
+        @{
+    */
+
+    //! C++ wrapper around shz_color_pack().
+    SHZ_FORCE_INLINE uint32_t color_pack(shz_vec4_t rgba) noexcept {
+        return shz_color_pack(rgba);
+    }
+
+    //! C++ wrapper around shz_color_pack_array().
+    SHZ_FORCE_INLINE void color_pack(uint32_t* dst, const shz_vec4_t* src, size_t count) noexcept {
+        shz_color_pack_array(dst, src, count);
+    }
+
+    //! C++ wrapper around shz_color_unpack().
+    SHZ_FORCE_INLINE vec4 color_unpack(uint32_t argb) noexcept {
+        return shz_color_unpack(argb);
+    }
+
+    //! C++ wrapper around shz_color_unpack_array().
+    SHZ_FORCE_INLINE void color_unpack(shz_vec4_t* dst, const uint32_t* src, size_t count) noexcept {
+        shz_color_unpack_array(dst, src, count);
+    }
+
+    //! C++ wrapper around shz_color_to16().
+    SHZ_FORCE_INLINE uint16_t color_to16(uint32_t argb, color_format format) noexcept {
+        return shz_color_to16(argb, format);
+    }
+
+    //! C++ wrapper around shz_color_to16_array().
+    SHZ_FORCE_INLINE void color_to16(uint16_t* dst, const uint32_t* src, size_t count, color_format format) noexcept {
+        shz_color_to16_array(dst, src, count, format);
+    }
+
+    //! C++ wrapper around shz_color_from16().
+    SHZ_FORCE_INLINE uint32_t color_from16(uint16_t color, color_format format) noexcept {
+        return shz_color_from16(color, format);
+    }
+
+    //! C++ wrapper around shz_color_from16_array().
+    SHZ_FORCE_INLINE void color_from16(uint32_t* dst, const uint16_t* src, size_t count, color_format format) noexcept {
+        shz_color_from16_array(dst, src, count, format);
+    }
+
+    //! C++ wrapper around shz_color_dither16().
+    SHZ_FORCE_INLINE void color_dither16(uint16_t* dst, const uint32_t* src, size_t width, size_t height, color_format format) noexcept {
+        shz_color_dither16(dst, src, width, height, format);
+    }
+
+    //! @}
+
+    /*! \name  Blending
+        \brief Routines for blending packed colors.
+        @{
+    */
+
+    //! C++ wrapper around shz_color_lerp().
+    SHZ_FORCE_INLINE uint32_t color_lerp(uint32_t a, uint32_t b, float t) noexcept {
+        return shz_color_lerp(a, b, t);
+    }
+
+    //! C++ wrapper around shz_color_lerp_array().
+    SHZ_FORCE_INLINE void color_lerp(uint32_t* dst, const uint32_t* a, const uint32_t* b, size_t count, float t) noexcept {
+        shz_color_lerp_array(dst, a, b, count, t);
+    }
+
+    //! C++ wrapper around shz_color_modulate().
+    SHZ_FORCE_INLINE uint32_t color_modulate(uint32_t a, uint32_t b) noexcept {
+        return shz_color_modulate(a, b);
+    }
+
+    //! C++ wrapper around shz_color_modulate_array().
+    SHZ_FORCE_INLINE void color_modulate(uint32_t* dst, const uint32_t* a, const uint32_t* b, size_t count) noexcept {
+        shz_color_modulate_array(dst, a, b, count);
+    }
+
+    //! C++ wrapper around shz_color_add().
+    SHZ_FORCE_INLINE uint32_t color_add(uint32_t a, uint32_t b) noexcept {
+        return shz_color_add(a, b);
+    }
+
+    //! C++ wrapper around shz_color_add_array().
+    SHZ_FORCE_INLINE void color_add(uint32_t* dst, const uint32_t* a, const uint32_t* b, size_t count) noexcept {
+        shz_color_add_array(dst, a, b, count);
+    }
+
+    //! @}
+}
+
+#endif
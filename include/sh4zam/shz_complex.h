@@ -12,7 +12,6 @@
     \todo
         - to/from shz_mat2x2_t and XMTRX
         - FFT utilities
-        - inverse FFT
 */
 
 #ifndef SHZ_COMPLEX_H
@@ -254,6 +253,455 @@ SHZ_INLINE shz_complex_t shz_cacothf(shz_complex_t c) SHZ_NOEXCEPT;
 */
 SHZ_INLINE void shz_fft(shz_complex_t* s, size_t size) SHZ_NOEXCEPT;
 
+/*! Batched Fast Fourier Transform
+
+    Applies shz_fft() in-place to each of the \p count buffers of
+    \p size samples pointed to by \p channels.
+
+    Rather than transforming one channel after another, every stage of
+    the FFT is applied to all channels before moving on to the next, so
+    each twiddle factor is only calculated once per batch, and the
+    bit-reversal pattern is only walked once.
+
+    \note
+    On SH4, the butterfly matrix stays resident within `XMTRX` while it
+    is applied across every channel.
+
+    \warning \p size must be a power-of-two!
+    \warning Each channel must be aligned to 8-byte boundaries!
+    \warning This routine clobbers `XMTRX`!
+
+    \sa shz_fft_batch_contiguous()
+*/
+void shz_fft_batch(shz_complex_t* const* channels, size_t count, size_t size) SHZ_NOEXCEPT;
+
+/*! Batched Fast Fourier Transform over contiguous channels
+
+    Equivalent to shz_fft_batch(), except the \p count channels are
+    stored back-to-back within \p s, with channel `c` starting at
+    `s + c * size`.
+
+    \warning \p size must be a power-of-two!
+    \warning \p s must be aligned to 8-byte boundaries!
+    \warning This routine clobbers `XMTRX`!
+*/
+void shz_fft_batch_contiguous(shz_complex_t* s, size_t count, size_t size) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Spectrum Conversion
+    \brief Batched conversions of complex spectra into real-valued scales.
+
+    Each routine is the array equivalent of calling its scalar counterpart
+    on every element, but without branches or libm calls, so it can be
+    vectorized on host back-ends.
+
+    @{
+*/
+
+//! Stores the magnitude of each of the \p count elements of \p src in \p dst. \sa shz_cabsf()
+void shz_cabsf_array(float* dst, const shz_complex_t* src, size_t count) SHZ_NOEXCEPT;
+
+//! Stores the squared magnitude (power) of each of the \p count elements of \p src in \p dst. \sa shz_cnormf()
+void shz_cnormf_array(float* dst, const shz_complex_t* src, size_t count) SHZ_NOEXCEPT;
+
+/*! Stores the magnitude of each of the \p count elements of \p src in \p dst, in decibels.
+
+    Computes `20 * log10(|src[i]|)`, accurate to about 0.001dB, with
+    magnitudes clamped to a floor of -200dB, so silence stays finite.
+*/
+void shz_cdbf_array(float* dst, const shz_complex_t* src, size_t count) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  FFT Plans
+    \brief Precomputed transforms for repeatedly processing signals of a fixed size.
+
+    A plan caches the twiddle factors and the bit-reversal permutation for a
+    particular transform size, so that each execution only has to run the
+    butterflies, rather than regenerating its sin/cos values every pass.
+    Plans also provide inverse transforms and real-valued transforms, which
+    run a complex transform of half the size.
+
+    \note
+    Plans never allocate. Their tables live within caller-provided storage of
+    at least SHZ_FFT_PLAN_STORAGE_SIZE() bytes, which must outlive the plan.
+    A single plan may be executed from multiple threads at once.
+
+    @{
+*/
+
+//! Returns the number of bytes of storage required by a plan of the given size.
+#define SHZ_FFT_PLAN_STORAGE_SIZE(size) \
+    (((size) / 2) * sizeof(shz_complex_t) + (size) * sizeof(uint16_t))
+
+//! Precomputed tables for running FFTs of a fixed, power-of-two size.
+typedef struct shz_fft_plan {
+    size_t         size;     //!< Number of points transformed by the plan.
+    shz_complex_t* twiddles; //!< `size / 2` twiddle factors, `e^(-2*PI*i*k / size)`.
+    uint16_t*      bitrev;   //!< Bit-reversed index of every point.
+} shz_fft_plan_t;
+
+//! shz_fft_plan_t alias for those who don't like POSIX-style.
+typedef shz_fft_plan_t shz_fft_plan;
+
+/*! Initializes an FFT plan for transforms of the given size.
+
+    Fills in the twiddle and bit-reversal tables of \p plan within
+    \p storage, which must be at least SHZ_FFT_PLAN_STORAGE_SIZE(\p size)
+    bytes and aligned to 8-byte boundaries.
+
+    \warning \p size must be a power-of-two between 2 and 65536!
+*/
+void shz_fft_plan_init(shz_fft_plan_t* plan, size_t size, void* storage) SHZ_NOEXCEPT;
+
+/*! Forward Fast Fourier Transform
+
+    Transforms the `plan->size` complex samples of \p src from the time to
+    the frequency domain, storing the resulting spectrum in \p dst. The
+    results match those of shz_fft().
+
+    \note
+    \p dst and \p src may either be the same array or not overlap at all.
+    Out-of-place transforms fuse the bit-reversal into the initial copy.
+*/
+void shz_fft_forward(const shz_fft_plan_t* plan, shz_complex_t* dst, const shz_complex_t* src) SHZ_NOEXCEPT;
+
+/*! Inverse Fast Fourier Transform
+
+    Transforms the `plan->size` complex bins of \p src from the frequency
+    back to the time domain, storing the resulting samples in \p dst. The
+    output is scaled by `1 / plan->size`, so that an inverse transform
+    exactly undoes a forward transform.
+
+    \note
+    \p dst and \p src may either be the same array or not overlap at all.
+*/
+void shz_fft_inverse(const shz_fft_plan_t* plan, shz_complex_t* dst, const shz_complex_t* src) SHZ_NOEXCEPT;
+
+/*! Real-to-Complex Fast Fourier Transform
+
+    Transforms the `plan->size` real samples of \p src into the
+    `plan->size / 2 + 1` non-redundant bins of their spectrum, stored in
+    \p dst. The remaining bins are the complex conjugates of these.
+
+    \note
+    The real samples are treated as a complex signal of half the length,
+    which is transformed and then split back apart, taking roughly half the
+    work of a complex transform of the same size.
+
+    \warning \p src must be aligned to 8-byte boundaries and must not overlap \p dst!
+    \warning `plan->size` must be at least 4!
+*/
+void shz_fft_real_forward(const shz_fft_plan_t* plan, shz_complex_t* dst, const float* src) SHZ_NOEXCEPT;
+
+/*! Complex-to-Real Inverse Fast Fourier Transform
+
+    Transforms the `plan->size / 2 + 1` bins of \p src, as produced by
+    shz_fft_real_forward(), back into `plan->size` real samples, stored in
+    \p dst. The output is scaled by `1 / plan->size`.
+
+    \warning \p dst must be aligned to 8-byte boundaries and must not overlap \p src!
+    \warning `plan->size` must be at least 4!
+*/
+void shz_fft_real_inverse(const shz_fft_plan_t* plan, float* dst, const shz_complex_t* src) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Discrete Cosine Transforms
+    \brief DCT and MDCT transforms for audio and image codecs.
+
+    Every transform is computed using an FFT of half its size or less,
+    taking `O(N log N)` rather than `O(N^2)` operations, using the tables
+    of a shz_dct_plan_t for one particular size.
+
+    \note
+    A DCT plan holds the scratch space used while transforming, so it may
+    only be executing one transform at a time.
+
+    @{
+*/
+
+//! Returns the number of bytes of storage required by a DCT plan of the given size.
+#define SHZ_DCT_PLAN_STORAGE_SIZE(size) \
+    (SHZ_FFT_PLAN_STORAGE_SIZE(size) + (2 * (size) + 2) * sizeof(shz_complex_t) + (size) * sizeof(float))
+
+//! Precomputed tables for running DCTs and MDCTs of a fixed, power-of-two size.
+typedef struct shz_dct_plan {
+    size_t         size;       //!< Number of coefficients produced by each transform.
+    shz_fft_plan_t fft;        //!< FFT plan of the same size.
+    shz_complex_t* twiddles;   //!< `size / 2 + 1` factors, `e^(-i*PI*k / (2 * size))`, for DCT-II/III.
+    shz_complex_t* pre;        //!< `size / 2` factors, `e^(-i*PI*(4k + 1) / (4 * size))`, for DCT-IV.
+    shz_complex_t* post;       //!< `size / 2` factors, `e^(-i*PI*k / size)`, for DCT-IV.
+    shz_complex_t* spectrum;   //!< Scratch spectrum of `size / 2 + 1` bins.
+    float*         samples;    //!< Scratch buffer of `size` samples.
+} shz_dct_plan_t;
+
+//! shz_dct_plan_t alias for those who don't like POSIX-style.
+typedef shz_dct_plan_t shz_dct_plan;
+
+/*! Initializes a DCT plan for transforms of the given size.
+
+    Fills in the tables of \p plan within \p storage, which must be at
+    least SHZ_DCT_PLAN_STORAGE_SIZE(\p size) bytes and aligned to 8-byte
+    boundaries.
+
+    \warning \p size must be a power-of-two between 4 and 65536!
+*/
+void shz_dct_plan_init(shz_dct_plan_t* plan, size_t size, void* storage) SHZ_NOEXCEPT;
+
+/*! DCT-II
+
+    Computes the `plan->size` coefficients of \p src, storing them in \p dst:
+
+        dst[k] = sum(src[n] * cos(PI / N * (n + 1/2) * k))
+
+    \note \p dst and \p src may either be the same array or not overlap at all.
+*/
+void shz_dct2(shz_dct_plan_t* plan, float* dst, const float* src) SHZ_NOEXCEPT;
+
+/*! DCT-III
+
+    Computes the inverse of shz_dct2(), which is the DCT-III scaled by `2 / N`:
+
+        dst[n] = 2 / N * (src[0] / 2 + sum(src[k] * cos(PI / N * (n + 1/2) * k)))
+
+    \note \p dst and \p src may either be the same array or not overlap at all.
+*/
+void shz_dct3(shz_dct_plan_t* plan, float* dst, const float* src) SHZ_NOEXCEPT;
+
+/*! DCT-IV
+
+    Computes the `plan->size` coefficients of \p src, storing them in \p dst:
+
+        dst[k] = sum(src[n] * cos(PI / N * (n + 1/2) * (k + 1/2)))
+
+    The DCT-IV is its own inverse, once scaled by `2 / N`.
+
+    \note \p dst and \p src may either be the same array or not overlap at all.
+*/
+void shz_dct4(shz_dct_plan_t* plan, float* dst, const float* src) SHZ_NOEXCEPT;
+
+/*! Modified Discrete Cosine Transform
+
+    Transforms the `2 * plan->size` samples of \p src into `plan->size`
+    coefficients, stored in \p dst:
+
+        dst[k] = sum(src[n] * cos(PI / N * (n + 1/2 + N/2) * (k + 1/2)))
+
+    Windowing is left up to the caller.
+
+    \warning \p dst and \p src must not overlap!
+*/
+void shz_mdct(shz_dct_plan_t* plan, float* dst, const float* src) SHZ_NOEXCEPT;
+
+/*! Inverse Modified Discrete Cosine Transform
+
+    Transforms the `plan->size` coefficients of \p src into `2 * plan->size`
+    samples, stored in \p dst:
+
+        dst[n] = 2 / N * sum(src[k] * cos(PI / N * (n + 1/2 + N/2) * (k + 1/2)))
+
+    Overlap-adding the windowed output of consecutive frames, using a window
+    which satisfies the Princen-Bradley condition, reconstructs the original
+    signal.
+
+    \warning \p dst and \p src must not overlap!
+*/
+void shz_imdct(shz_dct_plan_t* plan, float* dst, const float* src) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Short-Time Fourier Transforms
+    \brief Streaming spectrogram computation.
+
+    A STFT consumes a stream of real samples through a ring buffer, and
+    every hop of samples, multiplies the most recent frame of samples by a
+    precomputed window and transforms it with a real FFT. The spectrum of
+    each frame is then converted to the requested scale and written into
+    caller-owned frame storage, so a whole stream can be processed without
+    any allocations or extra copies.
+
+    @{
+*/
+
+//! Window functions which may be applied to each frame before transforming.
+typedef enum shz_window {
+    SHZ_WINDOW_RECTANGULAR, //!< No windowing.
+    SHZ_WINDOW_HANN,        //!< Raised cosine, `0.5 - 0.5 * cos(2 * PI * n / N)`.
+    SHZ_WINDOW_HAMMING,     //!< Raised cosine, `0.54 - 0.46 * cos(2 * PI * n / N)`.
+    SHZ_WINDOW_BLACKMAN     //!< Three-term cosine, with `a0 = 0.42`, `a1 = 0.5`, and `a2 = 0.08`.
+} shz_window_t;
+
+//! Scales into which each frame's spectrum may be converted.
+typedef enum shz_stft_scale {
+    SHZ_STFT_SCALE_MAGNITUDE,   //!< Magnitude of each bin. \sa shz_cabsf_array()
+    SHZ_STFT_SCALE_POWER,       //!< Squared magnitude of each bin. \sa shz_cnormf_array()
+    SHZ_STFT_SCALE_DECIBELS     //!< Magnitude of each bin, in decibels. \sa shz_cdbf_array()
+} shz_stft_scale_t;
+
+//! Returns the number of bytes of storage required by a STFT with frames of the given size.
+#define SHZ_STFT_STORAGE_SIZE(size) \
+    (SHZ_FFT_PLAN_STORAGE_SIZE(size) + ((size) / 2 + 1) * sizeof(shz_complex_t) + 3 * (size) * sizeof(float))
+
+//! State of a streaming STFT, which lives within caller-provided storage.
+typedef struct shz_stft {
+    size_t           size;      //!< Number of samples per frame.
+    size_t           hop;       //!< Number of samples between the start of consecutive frames.
+    size_t           head;      //!< Index of the oldest sample within the ring buffer.
+    size_t           until;     //!< Number of samples remaining until the next frame.
+    shz_stft_scale_t scale;     //!< Scale of the output frames.
+    float*           ring;      //!< Ring buffer of the most recent `size` samples.
+    float*           window;    //!< Precomputed window.
+    float*           frame;     //!< Scratch buffer holding the windowed frame.
+    shz_complex_t*   spectrum;  //!< Complex spectrum of the most recent frame, `size / 2 + 1` bins.
+    shz_fft_plan_t   plan;      //!< Plan for transforming each frame.
+} shz_stft_t;
+
+//! shz_stft_t alias for those who don't like POSIX-style.
+typedef shz_stft_t shz_stft;
+
+//! Fills \p dst with the given periodic window function of \p size samples.
+void shz_window_init(float* dst, size_t size, shz_window_t window) SHZ_NOEXCEPT;
+
+/*! Initializes a streaming STFT.
+
+    Prepares \p stft to produce a frame of `size / 2 + 1` bins in the given
+    \p scale every \p hop samples, from the last \p size samples
+    multiplied by the given \p window. All state is kept within
+    \p storage, which must be at least SHZ_STFT_STORAGE_SIZE(\p size)
+    bytes and aligned to 8-byte boundaries.
+
+    \warning \p size must be a power-of-two between 4 and 65536!
+    \warning \p hop must be between 1 and \p size!
+*/
+void shz_stft_init(shz_stft_t* stft, size_t size, size_t hop, shz_window_t window,
+                   shz_stft_scale_t scale, void* storage) SHZ_NOEXCEPT;
+
+//! Clears the ring buffer, so the next frame is produced after another `size` samples.
+void shz_stft_reset(shz_stft_t* stft) SHZ_NOEXCEPT;
+
+/*! Returns the number of frames that pushing \p count more samples will produce.
+
+    Used to size the \p frames buffer given to shz_stft_process().
+*/
+SHZ_INLINE size_t shz_stft_frames_pending(const shz_stft_t* stft, size_t count) SHZ_NOEXCEPT;
+
+/*! Pushes the next \p count samples of \p src through the STFT.
+
+    Each completed frame is written to \p frames as `size / 2 + 1`
+    consecutive floats, in the order they were produced. Returns the number
+    of frames written, which is equal to
+    shz_stft_frames_pending(\p stft, \p count).
+
+    \note
+    The complex spectrum of the last frame remains available within
+    `stft->spectrum` until the next frame is produced.
+*/
+size_t shz_stft_process(shz_stft_t* stft, float* frames, const float* src, size_t count) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  FIR Filters
+    \brief Streaming finite impulse response filters.
+
+    A filter convolves a stream of real samples with a fixed set of
+    coefficients (its impulse response), using one of two methods:
+
+    - Direct form: each output is a multiply-accumulate over every tap,
+      evaluated over tiles of outputs at once. Cheapest for short filters,
+      and introduces no latency.
+    - FFT: the impulse response is split into partitions of one block each,
+      which are convolved with the input in the frequency domain using
+      uniformly-partitioned overlap-save. The cost per sample grows with
+      the number of partitions rather than the number of taps, so it wins
+      for long responses, such as reverbs, at the cost of one block of
+      latency.
+
+    Filters never allocate, keeping all of their state within storage
+    provided by the caller, sized by shz_fir_storage_size().
+
+    @{
+*/
+
+/*! Number of taps at which SHZ_FIR_METHOD_AUTO switches to FFT convolution.
+
+    May be overridden, since the ideal crossover depends on the target and
+    block size. The complex unit test suite benchmarks both methods over a
+    range of filter lengths.
+*/
+#ifndef SHZ_FIR_FFT_MIN_TAPS
+#   define SHZ_FIR_FFT_MIN_TAPS 128
+#endif
+
+//! Method used by a FIR filter to perform its convolution.
+typedef enum shz_fir_method {
+    SHZ_FIR_METHOD_AUTO,    //!< Selects a method based on the number of taps.
+    SHZ_FIR_METHOD_DIRECT,  //!< Direct-form multiply-accumulate.
+    SHZ_FIR_METHOD_FFT      //!< Uniformly-partitioned overlap-save FFT convolution.
+} shz_fir_method_t;
+
+//! State of a streaming FIR filter, which lives within caller-provided storage.
+typedef struct shz_fir {
+    shz_fir_method_t method;      //!< Method being used, never SHZ_FIR_METHOD_AUTO.
+    size_t           taps;        //!< Number of filter coefficients.
+    size_t           block_size;  //!< Number of samples processed per block.
+    size_t           fill;        //!< Number of samples of the current block already consumed.
+    size_t           partitions;  //!< Number of impulse response partitions (FFT).
+    size_t           position;    //!< Index of the newest input spectrum (FFT).
+    float*           coeffs;      //!< Time-reversed coefficients (direct).
+    float*           input;       //!< Input history, followed by the current block.
+    float*           output;      //!< Output of the previous block (FFT).
+    float*           frame;       //!< Time-domain scratch frame (FFT).
+    shz_complex_t*   responses;   //!< Spectrum of each impulse response partition (FFT).
+    shz_complex_t*   history;     //!< Ring of the most recent input spectra (FFT).
+    shz_complex_t*   accum;       //!< Accumulated output spectrum (FFT).
+    shz_fft_plan_t   plan;        //!< Plan for transforms of twice the block size (FFT).
+} shz_fir_t;
+
+//! shz_fir_t alias for those who don't like POSIX-style.
+typedef shz_fir_t shz_fir;
+
+//! Returns the number of bytes of storage required by a filter with the given configuration.
+size_t shz_fir_storage_size(size_t taps, size_t block_size, shz_fir_method_t method) SHZ_NOEXCEPT;
+
+/*! Initializes a streaming FIR filter.
+
+    Prepares \p fir to convolve its input with the \p taps coefficients
+    of \p coeffs, processing up to \p block_size samples at once, using
+    the given \p method. All state is kept within \p storage, which must
+    be at least shz_fir_storage_size() bytes, aligned to 8-byte boundaries,
+    and must outlive the filter. \p coeffs is copied and need not persist.
+
+    \warning \p block_size must be a power-of-two between 2 and 32768!
+*/
+void shz_fir_init(shz_fir_t* fir, const float* coeffs, size_t taps, size_t block_size,
+                  shz_fir_method_t method, void* storage) SHZ_NOEXCEPT;
+
+//! Clears the filter's history, as if it had only ever been given silence.
+void shz_fir_reset(shz_fir_t* fir) SHZ_NOEXCEPT;
+
+/*! Filters the next \p count samples of the stream.
+
+    Reads \p count samples from \p src and writes the same number of
+    filtered samples to \p dst. Any \p count may be given, although
+    multiples of the block size are the most efficient.
+
+    \note
+    \p dst and \p src may either be the same array or not overlap at all.
+
+    \sa shz_fir_latency()
+*/
+void shz_fir_process(shz_fir_t* fir, float* dst, const float* src, size_t count) SHZ_NOEXCEPT;
+
+/*! Returns the latency of the filter, in samples.
+
+    Output sample `n` is the filtered value of input sample `n - latency`.
+    Direct-form filters have no latency, while FFT filters are delayed by
+    one block.
+*/
+SHZ_INLINE size_t shz_fir_latency(const shz_fir_t* fir) SHZ_NOEXCEPT;
+
 //! @}
 
 #include "inline/shz_complex.inl.h"
@@ -20,8 +20,22 @@
 #ifndef SHZ_COMPLEX_HPP
 #define SHZ_COMPLEX_HPP
 
+#include <array>
+#include <utility>
+
 #include "shz_complex.h"
 
+/*! Largest size of fixed-size FFT which is generated as fully unrolled straight-line code.
+
+    Larger sizes are decomposed into radix-4 passes over unrolled transforms
+    of this size or smaller, which bounds the code generated per size.
+
+    \sa shz::fft<N>()
+*/
+#ifndef SHZ_FFT_UNROLLED_MAX
+#   define SHZ_FFT_UNROLLED_MAX 64
+#endif
+
 namespace shz {
 
     //! C++ wrapper around a floating-point complex number, real/imaginary pair.
@@ -436,7 +450,423 @@ namespace shz {
         return shz_fft(s, size);
     }
 
+    //! C++ wrapper around shz_fft_batch(), which computes the FFT of each buffer in the batch. \sa shz_fft_batch()
+    SHZ_FORCE_INLINE void fft_batch(shz_complex_t* const* channels, size_t count, size_t size) noexcept {
+        shz_fft_batch(channels, count, size);
+    }
+
+    //! C++ wrapper around shz_fft_batch_contiguous(), which computes the FFT of each back-to-back buffer. \sa shz_fft_batch_contiguous()
+    SHZ_FORCE_INLINE void fft_batch_contiguous(shz_complex_t* s, size_t count, size_t size) noexcept {
+        shz_fft_batch_contiguous(s, count, size);
+    }
+
+    //! C++ wrapper around shz_cabsf_array(), which stores the magnitude of each element. \sa shz_cabsf_array()
+    SHZ_FORCE_INLINE void cabsf_array(float* dst, const shz_complex_t* src, size_t count) noexcept {
+        shz_cabsf_array(dst, src, count);
+    }
+
+    //! C++ wrapper around shz_cnormf_array(), which stores the squared magnitude of each element. \sa shz_cnormf_array()
+    SHZ_FORCE_INLINE void cnormf_array(float* dst, const shz_complex_t* src, size_t count) noexcept {
+        shz_cnormf_array(dst, src, count);
+    }
+
+    //! C++ wrapper around shz_cdbf_array(), which stores the magnitude of each element in decibels. \sa shz_cdbf_array()
+    SHZ_FORCE_INLINE void cdbf_array(float* dst, const shz_complex_t* src, size_t count) noexcept {
+        shz_cdbf_array(dst, src, count);
+    }
+
+    //! C++ wrapper around shz_window_init(), which fills \p dst with a window function. \sa shz_window_init()
+    SHZ_FORCE_INLINE void window_init(float* dst, size_t size, shz_window_t window) noexcept {
+        shz_window_init(dst, size, window);
+    }
+
     //! @}
+
+    //! Implementation details of the fixed-size FFT templates.
+    namespace detail {
+        //! Returns the twiddle factor, `e^(-2 * PI * i * k / n)`, evaluated at compile-time.
+        constexpr shz_complex_t fft_twiddle(size_t k, size_t n) {
+            constexpr double pi = 3.14159265358979323846;
+
+            double x = -2.0 * pi * (double)(k % n) / (double)n;
+            if(x < -pi)
+                x += 2.0 * pi;
+
+            // Taylor series, which have converged to double precision over [-PI, PI].
+            double sin = x, cos = 1.0, sin_term = x, cos_term = 1.0;
+            for(int j = 1; j < 16; ++j) {
+                sin_term *= -x * x / (double)((2 * j) * (2 * j + 1));
+                cos_term *= -x * x / (double)((2 * j - 1) * (2 * j));
+                sin      += sin_term;
+                cos      += cos_term;
+            }
+
+            return { (float)cos, (float)sin };
+        }
+
+        //! Returns \p i with its lowest log2(\p n) bits reversed.
+        consteval size_t fft_bit_reverse(size_t i, size_t n) {
+            size_t r = 0;
+            for(size_t bit = 1; bit < n; bit <<= 1, i >>= 1)
+                r = (r << 1) | (i & 1);
+            return r;
+        }
+
+        //! Returns the base-2 logarithm of the power-of-two, \p n.
+        consteval size_t fft_log2(size_t n) {
+            size_t l = 0;
+            while(n >>= 1)
+                ++l;
+            return l;
+        }
+
+        //! Fully unrolled radix-2 DIT FFT, whose indices and twiddle factors are all compile-time constants.
+        template<size_t N>
+        struct fft_unrolled {
+            // Butterfly J of the stage of length Len, rotating its bottom input by a compile-time twiddle.
+            template<size_t Len, size_t J>
+            SHZ_FORCE_INLINE static void butterfly(float* re, float* im) noexcept {
+                constexpr size_t half = Len / 2;
+                constexpr size_t k    = J % half;
+                constexpr size_t top  = (J / half) * Len + k;
+                constexpr size_t bot  = top + half;
+
+                float br, bi;
+
+                // Trivial twiddles of 1 and -i are swizzles rather than multiplies.
+                if constexpr(k == 0) {
+                    br = re[bot];
+                    bi = im[bot];
+                } else if constexpr(4 * k == Len) {
+                    br =  im[bot];
+                    bi = -re[bot];
+                } else {
+                    constexpr shz_complex_t w = fft_twiddle(k, Len);
+
+                    br = re[bot] * w.real - im[bot] * w.imag;
+                    bi = re[bot] * w.imag + im[bot] * w.real;
+                }
+
+                re[bot] = re[top] - br;
+                im[bot] = im[top] - bi;
+                re[top] = re[top] + br;
+                im[top] = im[top] + bi;
+            }
+
+            template<size_t Len, size_t... J>
+            SHZ_FORCE_INLINE static void stage(float* re, float* im, std::index_sequence<J...>) noexcept {
+                (butterfly<Len, J>(re, im), ...);
+            }
+
+            template<size_t... S>
+            SHZ_FORCE_INLINE static void stages(float* re, float* im, std::index_sequence<S...>) noexcept {
+                (stage<(size_t{2} << S)>(re, im, std::make_index_sequence<N / 2>{}), ...);
+            }
+
+            template<size_t... I>
+            SHZ_FORCE_INLINE static void load(float* re, float* im, const shz_complex_t* src,
+                                              size_t stride, std::index_sequence<I...>) noexcept {
+                ((re[I] = src[fft_bit_reverse(I, N) * stride].real,
+                  im[I] = src[fft_bit_reverse(I, N) * stride].imag), ...);
+            }
+
+            template<size_t... I>
+            SHZ_FORCE_INLINE static void store(shz_complex_t* dst, const float* re, const float* im,
+                                               std::index_sequence<I...>) noexcept {
+                ((dst[I] = shz_cinitf(re[I], im[I])), ...);
+            }
+
+            // Every input is loaded before any output is stored, so dst may alias src.
+            static void execute(shz_complex_t* dst, const shz_complex_t* src, size_t stride) noexcept {
+                float re[N], im[N];
+
+                load(re, im, src, stride, std::make_index_sequence<N>{});
+                stages(re, im, std::make_index_sequence<fft_log2(N)>{});
+                store(dst, re, im, std::make_index_sequence<N>{});
+            }
+        };
+
+        //! Table of the three twiddle factors, `W^k`, `W^2k`, and `W^3k`, for each radix-4 butterfly, `k`.
+        template<size_t N>
+        constexpr auto fft_radix4_twiddles = [] {
+            std::array<shz_complex_t, 3 * (N / 4)> table{};
+
+            for(size_t k = 0; k < N / 4; ++k)
+                for(size_t j = 0; j < 3; ++j)
+                    table[3 * k + j] = fft_twiddle((j + 1) * k, N);
+
+            return table;
+        }();
+
+        template<size_t N>
+        void fft_execute(shz_complex_t* dst, const shz_complex_t* src, size_t stride) noexcept;
+
+        //! Radix-4 DIT pass, which combines four transforms of a quarter of the size, from every fourth input.
+        template<size_t N>
+        void fft_radix4(shz_complex_t* dst, const shz_complex_t* src, size_t stride) noexcept {
+            constexpr size_t     q = N / 4;
+            const shz_complex_t* w = fft_radix4_twiddles<N>.data();
+
+            for(size_t j = 0; j < 4; ++j)
+                fft_execute<q>(&dst[j * q], &src[j * stride], 4 * stride);
+
+            for(size_t k = 0; k < q; ++k, w += 3) {
+                const shz_complex_t a = dst[k];
+                const shz_complex_t b = dst[k + q];
+                const shz_complex_t c = dst[k + 2 * q];
+                const shz_complex_t d = dst[k + 3 * q];
+
+                const float br = b.real * w[0].real - b.imag * w[0].imag;
+                const float bi = b.real * w[0].imag + b.imag * w[0].real;
+                const float cr = c.real * w[1].real - c.imag * w[1].imag;
+                const float ci = c.real * w[1].imag + c.imag * w[1].real;
+                const float dr = d.real * w[2].real - d.imag * w[2].imag;
+                const float di = d.real * w[2].imag + d.imag * w[2].real;
+
+                const float t0r = a.real + cr, t0i = a.imag + ci;
+                const float t1r = a.real - cr, t1i = a.imag - ci;
+                const float t2r = br + dr,     t2i = bi + di;
+                const float t3r = br - dr,     t3i = bi - di;
+
+                dst[k]         = shz_cinitf(t0r + t2r, t0i + t2i);
+                dst[k + q]     = shz_cinitf(t1r + t3i, t1i - t3r);
+                dst[k + 2 * q] = shz_cinitf(t0r - t2r, t0i - t2i);
+                dst[k + 3 * q] = shz_cinitf(t1r - t3i, t1i + t3r);
+            }
+        }
+
+        //! Transforms \p N inputs, spaced \p stride elements apart within \p src, into \p dst.
+        template<size_t N>
+        void fft_execute(shz_complex_t* dst, const shz_complex_t* src, size_t stride) noexcept {
+            if constexpr(N <= SHZ_FFT_UNROLLED_MAX)
+                fft_unrolled<N>::execute(dst, src, stride);
+            else
+                fft_radix4<N>(dst, src, stride);
+        }
+    }
+
+    /*! \name  Fixed-Size FFTs
+        \brief FFTs whose size is known at compile-time.
+
+        Transforms of up to SHZ_FFT_UNROLLED_MAX points are generated as
+        straight-line butterflies with constant twiddle factors, free of any
+        loops, branches, or table lookups, while larger transforms combine
+        them with radix-4 passes using compile-time twiddle tables. Each
+        produces the same result as shz_fft() of the same size.
+
+        @{
+    */
+
+    /*! Computes the forward FFT of the \p N complex samples within \p src, storing the spectrum in \p dst.
+
+        \warning \p dst may only alias \p src when \p N is no larger than SHZ_FFT_UNROLLED_MAX!
+    */
+    template<size_t N>
+    SHZ_FORCE_INLINE void fft(shz_complex_t* dst, const shz_complex_t* src) noexcept {
+        static_assert(N >= 2 && (N & (N - 1)) == 0, "FFT size must be a power-of-two!");
+
+        detail::fft_execute<N>(dst, src, 1);
+    }
+
+    /*! Computes the forward FFT of the \p N complex samples within \p s, in-place.
+
+        \note
+        Sizes larger than SHZ_FFT_UNROLLED_MAX copy their input into a
+        temporary buffer of \p N samples on the stack.
+    */
+    template<size_t N>
+    SHZ_FORCE_INLINE void fft(shz_complex_t* s) noexcept {
+        if constexpr(N <= SHZ_FFT_UNROLLED_MAX) {
+            fft<N>(s, s);
+        } else {
+            alignas(8) shz_complex_t tmp[N];
+
+            for(size_t i = 0; i < N; ++i)
+                tmp[i] = s[i];
+
+            fft<N>(s, tmp);
+        }
+    }
+
+    //! @}
+
+    /*! C++ wrapper around shz_fft_plan_t.
+
+        Precomputed tables for repeatedly running forward, inverse, and real
+        FFTs of a fixed size, within caller-provided storage.
+
+        \sa shz_fft_plan_t, shz_fft_plan_init()
+    */
+    struct fft_plan: shz_fft_plan_t {
+        //! Default constructor: does nothing.
+        fft_plan() = default;
+
+        //! C Constructor: initializes a C++ shz::fft_plan from a C shz_fft_plan_t.
+        SHZ_FORCE_INLINE fft_plan(const shz_fft_plan_t& other) noexcept:
+            shz_fft_plan_t(other) {}
+
+        //! Value constructor: initializes the plan's tables within \p storage. \sa shz_fft_plan_init()
+        SHZ_FORCE_INLINE fft_plan(size_t size, void* storage) noexcept {
+            shz_fft_plan_init(this, size, storage);
+        }
+
+        //! C++ wrapper around shz_fft_forward().
+        SHZ_FORCE_INLINE void forward(shz_complex_t* dst, const shz_complex_t* src) const noexcept {
+            shz_fft_forward(this, dst, src);
+        }
+
+        //! C++ wrapper around shz_fft_forward(), transforming \p s in-place.
+        SHZ_FORCE_INLINE void forward(shz_complex_t* s) const noexcept {
+            shz_fft_forward(this, s, s);
+        }
+
+        //! C++ wrapper around shz_fft_inverse().
+        SHZ_FORCE_INLINE void inverse(shz_complex_t* dst, const shz_complex_t* src) const noexcept {
+            shz_fft_inverse(this, dst, src);
+        }
+
+        //! C++ wrapper around shz_fft_inverse(), transforming \p s in-place.
+        SHZ_FORCE_INLINE void inverse(shz_complex_t* s) const noexcept {
+            shz_fft_inverse(this, s, s);
+        }
+
+        //! C++ wrapper around shz_fft_real_forward().
+        SHZ_FORCE_INLINE void real_forward(shz_complex_t* dst, const float* src) const noexcept {
+            shz_fft_real_forward(this, dst, src);
+        }
+
+        //! C++ wrapper around shz_fft_real_inverse().
+        SHZ_FORCE_INLINE void real_inverse(float* dst, const shz_complex_t* src) const noexcept {
+            shz_fft_real_inverse(this, dst, src);
+        }
+    };
+
+    /*! C++ wrapper around shz_dct_plan_t.
+
+        Precomputed tables and scratch space for running DCT-II/III/IV and
+        MDCT transforms of a fixed size, within caller-provided storage.
+
+        \sa shz_dct_plan_t, shz_dct_plan_init()
+    */
+    struct dct_plan: shz_dct_plan_t {
+        //! Default constructor: does nothing.
+        dct_plan() = default;
+
+        //! Value constructor: initializes the plan's tables within \p storage. \sa shz_dct_plan_init()
+        SHZ_FORCE_INLINE dct_plan(size_t size, void* storage) noexcept {
+            shz_dct_plan_init(this, size, storage);
+        }
+
+        //! C++ wrapper around shz_dct2().
+        SHZ_FORCE_INLINE void dct2(float* dst, const float* src) noexcept {
+            shz_dct2(this, dst, src);
+        }
+
+        //! C++ wrapper around shz_dct3().
+        SHZ_FORCE_INLINE void dct3(float* dst, const float* src) noexcept {
+            shz_dct3(this, dst, src);
+        }
+
+        //! C++ wrapper around shz_dct4().
+        SHZ_FORCE_INLINE void dct4(float* dst, const float* src) noexcept {
+            shz_dct4(this, dst, src);
+        }
+
+        //! C++ wrapper around shz_mdct().
+        SHZ_FORCE_INLINE void mdct(float* dst, const float* src) noexcept {
+            shz_mdct(this, dst, src);
+        }
+
+        //! C++ wrapper around shz_imdct().
+        SHZ_FORCE_INLINE void imdct(float* dst, const float* src) noexcept {
+            shz_imdct(this, dst, src);
+        }
+    };
+
+    /*! C++ wrapper around shz_stft_t.
+
+        Streaming short-time Fourier transform, which writes a frame of
+        windowed spectra into caller-owned storage every hop of samples.
+
+        \sa shz_stft_t, shz_stft_init()
+    */
+    struct stft: shz_stft_t {
+        //! Alias for the C enumeration of window functions.
+        using window_t = shz_window_t;
+
+        //! Alias for the C enumeration of output scales.
+        using scale_t = shz_stft_scale_t;
+
+        //! Default constructor: does nothing.
+        stft() = default;
+
+        //! Value constructor: initializes the STFT within \p storage. \sa shz_stft_init()
+        SHZ_FORCE_INLINE stft(size_t size, size_t hop, window_t window, scale_t scale, void* storage) noexcept {
+            shz_stft_init(this, size, hop, window, scale, storage);
+        }
+
+        //! Returns the number of floats within each output frame.
+        SHZ_FORCE_INLINE size_t bins() const noexcept {
+            return size / 2 + 1;
+        }
+
+        //! C++ wrapper around shz_stft_reset().
+        SHZ_FORCE_INLINE void reset() noexcept {
+            shz_stft_reset(this);
+        }
+
+        //! C++ wrapper around shz_stft_frames_pending().
+        SHZ_FORCE_INLINE size_t frames_pending(size_t count) const noexcept {
+            return shz_stft_frames_pending(this, count);
+        }
+
+        //! C++ wrapper around shz_stft_process().
+        SHZ_FORCE_INLINE size_t process(float* frames, const float* src, size_t count) noexcept {
+            return shz_stft_process(this, frames, src, count);
+        }
+    };
+
+    /*! C++ wrapper around shz_fir_t.
+
+        Streaming FIR filter which convolves with either direct-form
+        multiply-accumulates or partitioned FFT convolution.
+
+        \sa shz_fir_t, shz_fir_init()
+    */
+    struct fir: shz_fir_t {
+        //! Alias for the C enumeration of convolution methods.
+        using method_t = shz_fir_method_t;
+
+        //! Default constructor: does nothing.
+        fir() = default;
+
+        //! Value constructor: initializes the filter within \p storage. \sa shz_fir_init()
+        SHZ_FORCE_INLINE fir(const float* coeffs, size_t taps, size_t block_size,
+                             method_t method, void* storage) noexcept {
+            shz_fir_init(this, coeffs, taps, block_size, method, storage);
+        }
+
+        //! C++ wrapper around shz_fir_storage_size().
+        SHZ_FORCE_INLINE static size_t storage_size(size_t taps, size_t block_size,
+                                                    method_t method = SHZ_FIR_METHOD_AUTO) noexcept {
+            return shz_fir_storage_size(taps, block_size, method);
+        }
+
+        //! C++ wrapper around shz_fir_reset().
+        SHZ_FORCE_INLINE void reset() noexcept {
+            shz_fir_reset(this);
+        }
+
+        //! C++ wrapper around shz_fir_process().
+        SHZ_FORCE_INLINE void process(float* dst, const float* src, size_t count) noexcept {
+            shz_fir_process(this, dst, src, count);
+        }
+
+        //! C++ wrapper around shz_fir_latency().
+        SHZ_FORCE_INLINE size_t latency() const noexcept {
+            return shz_fir_latency(this);
+        }
+    };
 }
 
 #endif
@@ -0,0 +1,153 @@
+/*! \file
+    \brief Routines for view-frustum culling of bounding volumes.
+    \ingroup cull
+
+    This file contains the public types and interface for extracting the
+    planes of a view frustum and testing bounding spheres and axis-aligned
+    bounding boxes against them, either individually or in batches.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#ifndef SHZ_CULL_H
+#define SHZ_CULL_H
+
+#include "shz_matrix.h"
+
+/*! \defgroup cull Culling
+    \brief    View-frustum culling of bounding volumes.
+
+    A frustum is extracted from a combined projection and view (and
+    optionally model) matrix, either from a shz_mat4x4_t or directly from
+    XMTRX, as its six planes, each normalized so that its dot product with
+    a point is the signed distance to it. Bounding volumes are then given
+    in the same space which the matrix transforms from.
+
+    The batched routines write one visibility bit per object and may be
+    given a per-object plane cache. Each object begins testing from the
+    plane which last rejected it, so objects which stay outside of the
+    frustum from frame to frame are usually rejected by the first test.
+
+    \note
+    The planes are extracted assuming the OpenGL clip-space convention of
+    -w <= z <= w, as with shz_mat4x4_init_frustum(). For the infinite
+    projection of shz_mat4x4_init_perspective(), the near and far planes
+    trade places, but still bound the same volume.
+*/
+
+SHZ_DECLS_BEGIN
+
+//! Indices of each plane within a shz_frustum_t.
+typedef enum shz_frustum_plane {
+    SHZ_FRUSTUM_LEFT,           //!< Left clipping plane.
+    SHZ_FRUSTUM_RIGHT,          //!< Right clipping plane.
+    SHZ_FRUSTUM_BOTTOM,         //!< Bottom clipping plane.
+    SHZ_FRUSTUM_TOP,            //!< Top clipping plane.
+    SHZ_FRUSTUM_NEAR,           //!< Near clipping plane.
+    SHZ_FRUSTUM_FAR,            //!< Far clipping plane.
+    SHZ_FRUSTUM_PLANE_COUNT     //!< Number of planes bounding a frustum.
+} shz_frustum_plane_t;
+
+//! Alternate shz_frustum_plane_t C typedef for those who hate POSIX style.
+typedef shz_frustum_plane_t shz_frustum_plane;
+
+/*! View frustum, as its six bounding planes.
+
+    Each plane is stored as its normal, pointing into the frustum, within
+    <X, Y, Z>, and its distance from the origin within W.
+*/
+typedef struct shz_frustum {
+    shz_vec4_t planes[SHZ_FRUSTUM_PLANE_COUNT]; //!< Normalized planes, indexed by shz_frustum_plane_t.
+} shz_frustum_t;
+
+//! Alternate shz_frustum_t C typedef for those who hate POSIX style.
+typedef shz_frustum_t shz_frustum;
+
+//! Bounding sphere.
+typedef struct shz_sphere {
+    shz_vec3_t center;  //!< Center of the sphere.
+    float      radius;  //!< Radius of the sphere.
+} shz_sphere_t;
+
+//! Alternate shz_sphere_t C typedef for those who hate POSIX style.
+typedef shz_sphere_t shz_sphere;
+
+//! Axis-aligned bounding box.
+typedef struct shz_aabb {
+    shz_vec3_t center;  //!< Center of the box.
+    shz_vec3_t extents; //!< Half of the box's size along each axis.
+} shz_aabb_t;
+
+//! Alternate shz_aabb_t C typedef for those who hate POSIX style.
+typedef shz_aabb_t shz_aabb;
+
+/*! \name  Initialization
+    \brief Routines for extracting frustums and building bounding volumes.
+    @{
+*/
+
+//! Extracts the normalized planes of the frustum whose clip-space transform is given by \p mat.
+void shz_frustum_init_mat4x4(shz_frustum_t* frustum, const shz_mat4x4_t* mat) SHZ_NOEXCEPT;
+
+//! Extracts the normalized planes of the frustum whose clip-space transform is currently held within XMTRX.
+void shz_frustum_init_xmtrx(shz_frustum_t* frustum) SHZ_NOEXCEPT;
+
+//! Returns the axis-aligned bounding box spanning from the \p min to the \p max corner.
+SHZ_INLINE shz_aabb_t shz_aabb_init_min_max(shz_vec3_t min, shz_vec3_t max) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Testing
+    \brief Routines for testing single bounding volumes against a frustum.
+
+    Each routine returns false only when the volume lies entirely outside
+    of a plane. Volumes straddling the corners of a frustum may be
+    conservatively reported as visible.
+    @{
+*/
+
+//! Returns whether the given sphere is potentially visible within \p frustum.
+SHZ_INLINE bool shz_frustum_test_sphere(const shz_frustum_t* frustum, shz_sphere_t sphere) SHZ_NOEXCEPT;
+
+//! Returns whether the given box is potentially visible within \p frustum.
+SHZ_INLINE bool shz_frustum_test_aabb(const shz_frustum_t* frustum, shz_aabb_t aabb) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Batching
+    \brief Routines for culling arrays of bounding volumes against a frustum.
+
+    Each routine sets bit (i % 32) of \p visible[i / 32] when object i is
+    potentially visible and clears it otherwise, writing every one of the
+    (count + 31) / 32 words, then returns the number of visible objects.
+
+    \p cache may be NULL. Otherwise, it holds one shz_frustum_plane_t
+    index per object, which must be zero-initialized before the first
+    call. Testing each object begins from its cached plane, which is
+    updated to whichever plane rejects it.
+    @{
+*/
+
+//! Culls \p count spheres against \p frustum, returning how many are potentially visible.
+size_t shz_frustum_cull_spheres(const shz_frustum_t* frustum,
+                                const shz_sphere_t*  spheres,
+                                size_t               count,
+                                uint32_t*            visible,
+                                uint8_t*             cache) SHZ_NOEXCEPT;
+
+//! Culls \p count boxes against \p frustum, returning how many are potentially visible.
+size_t shz_frustum_cull_aabbs(const shz_frustum_t* frustum,
+                              const shz_aabb_t*    aabbs,
+                              size_t               count,
+                              uint32_t*            visible,
+                              uint8_t*             cache) SHZ_NOEXCEPT;
+
+//! @}
+
+#include "inline/shz_cull.inl.h"
+
+SHZ_DECLS_END
+
+#endif // SHZ_CULL_H
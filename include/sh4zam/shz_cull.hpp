@@ -0,0 +1,91 @@
+/*! \file
+    \brief   C++ routines for view-frustum culling of bounding volumes.
+    \ingroup cull
+
+    This file provides a C++ binding layer over the C API provided by
+    shz_cull.h.
+
+    \author    2026 Falco Girgis
+    \copyright MIT License
+*/
+
+#ifndef SHZ_CULL_HPP
+#define SHZ_CULL_HPP
+
+#include "shz_cull.h"
+#include "shz_matrix.hpp"
+
+namespace shz {
+
+    //! C++ alias for a bounding sphere.
+    using sphere = shz_sphere_t;
+
+    //! C++ alias for an axis-aligned bounding box.
+    using aabb = shz_aabb_t;
+
+    /*! C++ structure representing a view frustum.
+
+        \note
+        shz::frustum is the C++ extension of shz_frustum_t, which adds
+        member functions and still retains backwards compatibility with the
+        C API.
+
+        \sa shz_frustum_t, shz::mat4x4
+    */
+    struct frustum: public shz_frustum_t {
+
+        //! Default constructor, which does nothing.
+        frustum() noexcept = default;
+
+        //! Constructs a frustum from the clip-space transform given by \p mat.
+        SHZ_FORCE_INLINE frustum(const shz_mat4x4_t& mat) noexcept {
+            shz_frustum_init_mat4x4(this, &mat);
+        }
+
+        /*! \name  Initialization
+            \brief Routines for extracting the frustum's planes.
+            @{
+        */
+
+        //! C++ wrapper around shz_frustum_init_mat4x4().
+        SHZ_FORCE_INLINE void init(const shz_mat4x4_t& mat) noexcept {
+            shz_frustum_init_mat4x4(this, &mat);
+        }
+
+        //! C++ wrapper around shz_frustum_init_xmtrx().
+        SHZ_FORCE_INLINE void init_xmtrx() noexcept {
+            shz_frustum_init_xmtrx(this);
+        }
+
+        //! @}
+
+        /*! \name  Testing
+            \brief Routines for testing bounding volumes against the frustum.
+            @{
+        */
+
+        //! C++ wrapper around shz_frustum_test_sphere().
+        SHZ_FORCE_INLINE bool test(sphere s) const noexcept {
+            return shz_frustum_test_sphere(this, s);
+        }
+
+        //! C++ wrapper around shz_frustum_test_aabb().
+        SHZ_FORCE_INLINE bool test(aabb box) const noexcept {
+            return shz_frustum_test_aabb(this, box);
+        }
+
+        //! C++ wrapper around shz_frustum_cull_spheres().
+        SHZ_FORCE_INLINE size_t cull(const sphere* spheres, size_t count, uint32_t* visible, uint8_t* cache = nullptr) const noexcept {
+            return shz_frustum_cull_spheres(this, spheres, count, visible, cache);
+        }
+
+        //! C++ wrapper around shz_frustum_cull_aabbs().
+        SHZ_FORCE_INLINE size_t cull(const aabb* aabbs, size_t count, uint32_t* visible, uint8_t* cache = nullptr) const noexcept {
+            return shz_frustum_cull_aabbs(this, aabbs, count, visible, cache);
+        }
+
+        //! @}
+    };
+}
+
+#endif
@@ -0,0 +1,213 @@
+/*! \file
+    \brief Routines for operating upon dual quaternions.
+    \ingroup dualquat
+
+    This file contains the public type(s) and interface providing the
+    dual-quaternion math API, including dual-quaternion skinning.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#ifndef SHZ_DUALQUAT_H
+#define SHZ_DUALQUAT_H
+
+#include "shz_quat.h"
+#include "shz_matrix.h"
+
+/*! \defgroup dualquat Dual Quaternions
+    \brief    Routines for rigid transforms represented as dual quaternions.
+*/
+
+SHZ_DECLS_BEGIN
+
+/*! Represents a rigid transform as a dual quaternion.
+
+    A unit dual quaternion encodes a rotation followed by a translation
+    within 8 floats: its real part is the rotation quaternion, while its
+    dual part is half of the translation, as a pure quaternion, multiplied
+    by the rotation.
+
+    Unlike matrices, dual quaternions may be blended linearly and then
+    renormalized without introducing scale or shear, which is what makes
+    them attractive for skinning.
+
+    \note
+    Scales are not representable, so only rigid transforms may be
+    converted to and from matrices.
+*/
+typedef struct shz_dualquat {
+    shz_quat_t real;  //!< Real part, representing the rotation.
+    shz_quat_t dual;  //!< Dual part, encoding the translation.
+} shz_dualquat_t;
+
+//! Alternate shz_dualquat_t C typedef for those who hate POSIX style.
+typedef shz_dualquat_t shz_dualquat;
+
+/*! \name  Initialization
+    \brief Routines for creating and initializing dual quaternions.
+    @{
+*/
+
+//! Initializes and returns a new dual quaternion with the given real and dual parts.
+SHZ_INLINE shz_dualquat_t shz_dualquat_init(shz_quat_t real, shz_quat_t dual) SHZ_NOEXCEPT;
+
+//! Initializes and returns an identity dual quaternion.
+SHZ_INLINE shz_dualquat_t shz_dualquat_identity(void) SHZ_NOEXCEPT;
+
+//! Returns true if the two given dual quaternions are considered equal based on either absolute or relative tolerance.
+SHZ_INLINE bool shz_dualquat_equal(shz_dualquat_t a, shz_dualquat_t b) SHZ_NOEXCEPT;
+
+//! Returns a dual quaternion which rotates by the unit quaternion, \p rotation, then translates by \p translation.
+SHZ_INLINE shz_dualquat_t shz_dualquat_from_rotation_translation(shz_quat_t rotation, shz_vec3_t translation) SHZ_NOEXCEPT;
+
+//! Returns a dual quaternion which only rotates by the given unit quaternion.
+SHZ_INLINE shz_dualquat_t shz_dualquat_from_quat(shz_quat_t rotation) SHZ_NOEXCEPT;
+
+//! Returns a dual quaternion which only translates by the given vector.
+SHZ_INLINE shz_dualquat_t shz_dualquat_from_translation(shz_vec3_t translation) SHZ_NOEXCEPT;
+
+/*! Returns the dual quaternion representing the rigid transform within the given matrix.
+
+    \warning
+    The upper 3x3 of \p mat must be a pure rotation, without scale or shear.
+*/
+SHZ_INLINE shz_dualquat_t shz_dualquat_from_mat4x4(const shz_mat4x4_t* mat) SHZ_NOEXCEPT;
+
+//! Returns the dual quaternion which linearly interpolates \p a to \p b by \p t, then renormalizes the result.
+SHZ_INLINE shz_dualquat_t shz_dualquat_nlerp(shz_dualquat_t a, shz_dualquat_t b, float t) SHZ_NOEXCEPT;
+
+/*! Returns the screw linear interpolation (ScLERP) from \p a to \p b by a \p t factor of `0.0f-1.0f`.
+
+    Interpolates along the single screw motion taking \p a to \p b, with
+    constant angular and linear velocity, which is the rigid-transform
+    equivalent of shz_quat_slerp(). Both inputs must be unit dual
+    quaternions, and are returned unchanged for a \p t of exactly `0.0f`
+    or `1.0f`.
+*/
+shz_dualquat_t shz_dualquat_sclerp(shz_dualquat_t a, shz_dualquat_t b, float t) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Properties
+    \brief Routines returning derived values from a dual quaternion.
+    @{
+*/
+
+//! Returns the rotation of the given unit dual quaternion.
+SHZ_INLINE shz_quat_t shz_dualquat_rotation(shz_dualquat_t dq) SHZ_NOEXCEPT;
+
+//! Returns the translation of the given unit dual quaternion.
+SHZ_INLINE shz_vec3_t shz_dualquat_translation(shz_dualquat_t dq) SHZ_NOEXCEPT;
+
+//! Returns the dot product of the real parts of the two dual quaternions.
+SHZ_INLINE float shz_dualquat_dot(shz_dualquat_t a, shz_dualquat_t b) SHZ_NOEXCEPT;
+
+//! Stores the rigid transform represented by the given unit dual quaternion into \p mat.
+SHZ_INLINE void shz_dualquat_to_mat4x4(shz_dualquat_t dq, shz_mat4x4_t* mat) SHZ_NOEXCEPT;
+
+//! Stores the rigid transform represented by the given unit dual quaternion into the compact 3x4 \p mat.
+SHZ_INLINE void shz_dualquat_to_mat3x4(shz_dualquat_t dq, shz_mat3x4_t* mat) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Modifiers
+    \brief Routines for returning new dual quaternions derived from existing ones.
+    @{
+*/
+
+/*! Returns the normalized form of the given dual quaternion.
+
+    Scales both parts so that the real part has unit length, then removes
+    any component of the dual part which is parallel to the real part,
+    which accumulates from blending and repeated composition.
+*/
+SHZ_INLINE shz_dualquat_t shz_dualquat_normalize(shz_dualquat_t dq) SHZ_NOEXCEPT;
+
+//! Returns the quaternion conjugate of both parts of the given dual quaternion, which inverts a unit dual quaternion.
+SHZ_INLINE shz_dualquat_t shz_dualquat_conjugate(shz_dualquat_t dq) SHZ_NOEXCEPT;
+
+/*! Returns the inverse of the given dual quaternion.
+
+    \note
+    Unit dual quaternions are inverted more cheaply by shz_dualquat_conjugate().
+*/
+SHZ_INLINE shz_dualquat_t shz_dualquat_inv(shz_dualquat_t dq) SHZ_NOEXCEPT;
+
+//! Returns the negation of both parts of the given dual quaternion, which represents the same transform.
+SHZ_INLINE shz_dualquat_t shz_dualquat_neg(shz_dualquat_t dq) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Arithmetic
+    \brief Routines performing calculations with dual quaternions.
+    @{
+*/
+
+//! Returns the dual quaternion produced from adding each part of the given dual quaternions.
+SHZ_INLINE shz_dualquat_t shz_dualquat_add(shz_dualquat_t a, shz_dualquat_t b) SHZ_NOEXCEPT;
+
+//! Scales both parts of the given dual quaternion by the given factor.
+SHZ_INLINE shz_dualquat_t shz_dualquat_scale(shz_dualquat_t dq, float f) SHZ_NOEXCEPT;
+
+/*! Multiplies the two dual quaternions, returning the result as a new dual quaternion.
+
+    The resulting transform applies \p b first, then \p a, just like
+    multiplying matrices.
+*/
+SHZ_INLINE shz_dualquat_t shz_dualquat_mult(shz_dualquat_t a, shz_dualquat_t b) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Transformations
+    \brief Routines for applying dual-quaternion transforms.
+    @{
+*/
+
+//! Rotates then translates the given point by the unit dual quaternion.
+SHZ_INLINE shz_vec3_t shz_dualquat_transform_point3(shz_dualquat_t dq, shz_vec3_t p) SHZ_NOEXCEPT;
+
+//! Only rotates the given direction vector by the unit dual quaternion, ignoring its translation.
+SHZ_INLINE shz_vec3_t shz_dualquat_transform_vec3(shz_dualquat_t dq, shz_vec3_t v) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Skinning
+    \brief Dual-quaternion blend skinning of vertex streams.
+
+    Skins each vertex by the normalized, weighted sum of up to
+    SHZ_SKIN_MAX_INFLUENCES bone dual quaternions (DLB), which, unlike
+    linear blend skinning, preserves volume around twisting joints. Each
+    bone is half the size of a 4x4 matrix, halving palette uploads.
+
+    Bones whose real parts lie in the opposite hemisphere from the first
+    influence are negated before blending, so that every vertex takes the
+    shortest path between its bones.
+
+    Consecutive vertices bound to the same single bone are transformed as
+    one run by the batched XMTRX routines, after converting the bone to a
+    matrix once, while blended vertices convert their blended dual
+    quaternion into a matrix on the stack.
+
+    Vertex arrays follow the same conventions as shz_skin_mat4x4(), with
+    \p stride bytes between consecutive vertices, or tightly packed when
+    0, and may be skinned in-place.
+
+    \warning These routines clobber XMTRX.
+    @{
+*/
+
+//! Skins \p count vertices against a palette of unit dual quaternions, using the given shz_skin_influence_t per vertex.
+void shz_skin_dualquat(const shz_dualquat_t* palette, const shz_skin_influence_t* influences,
+                       shz_vec3_t* dst_positions, const shz_vec3_t* src_positions,
+                       shz_vec3_t* dst_normals, const shz_vec3_t* src_normals,
+                       size_t count, size_t stride) SHZ_NOEXCEPT;
+
+//! @}
+
+#include "inline/shz_dualquat.inl.h"
+
+SHZ_DECLS_END
+
+#endif // SHZ_DUALQUAT_H
@@ -0,0 +1,257 @@
+/*! \file
+    \brief   C++ routines for operating upon dual quaternions.
+    \ingroup dualquat
+
+    This file provides a C++ binding layer over the C API provided by
+    shz_dualquat.h.
+
+    \author    2026 Falco Girgis
+    \copyright MIT License
+*/
+
+#ifndef SHZ_DUALQUAT_HPP
+#define SHZ_DUALQUAT_HPP
+
+#include "shz_dualquat.h"
+#include "shz_quat.hpp"
+#include "shz_matrix.hpp"
+
+namespace shz {
+
+    /*! C++ structure representing a dual quaternion.
+
+        A unit dual quaternion represents a rigid transform: a rotation,
+        held by its real part, followed by a translation, encoded within
+        its dual part.
+
+        \note
+        shz::dualquat is the C++ extension of shz_dualquat_t, which adds
+        member functions, convenience operators, and still retains
+        backwards compatibility with the C API.
+
+        \sa shz_dualquat_t, shz::quat, shz::mat4x4
+    */
+    struct dualquat: public shz_dualquat_t {
+
+        /*! \name  Initialization
+            \brief Routines for creating and initializing dual quaternions.
+            @{
+        */
+
+        //! Default constructor: does nothing.
+        dualquat() noexcept = default;
+
+        //! Value constructor: initializes a dual quaternion with the given real and dual parts.
+        SHZ_FORCE_INLINE dualquat(quat real, quat dual) noexcept:
+            shz_dualquat_t(shz_dualquat_init(real, dual)) {}
+
+        //! C Converting constructor: constructs a C++ shz::dualquat from a C shz_dualquat_t.
+        SHZ_FORCE_INLINE dualquat(const shz_dualquat_t& dq) noexcept:
+            shz_dualquat_t(dq) {}
+
+        //! Returns an identity dual quaternion.
+        SHZ_FORCE_INLINE static dualquat identity() noexcept {
+            return shz_dualquat_identity();
+        }
+
+        //! Returns a dual quaternion which rotates by \p rotation, then translates by \p translation.
+        SHZ_FORCE_INLINE static dualquat from_rotation_translation(quat rotation, vec3 translation) noexcept {
+            return shz_dualquat_from_rotation_translation(rotation, translation);
+        }
+
+        //! Returns a dual quaternion which only rotates by the given quaternion.
+        SHZ_FORCE_INLINE static dualquat from_quat(quat rotation) noexcept {
+            return shz_dualquat_from_quat(rotation);
+        }
+
+        //! Returns a dual quaternion which only translates by the given vector.
+        SHZ_FORCE_INLINE static dualquat from_translation(vec3 translation) noexcept {
+            return shz_dualquat_from_translation(translation);
+        }
+
+        //! Returns the dual quaternion representing the rigid transform within the given matrix.
+        SHZ_FORCE_INLINE static dualquat from_mat4x4(const shz_mat4x4_t& mat) noexcept {
+            return shz_dualquat_from_mat4x4(&mat);
+        }
+
+        //! Returns the renormalized linear interpolation from \p a to \p b by \p t.
+        SHZ_FORCE_INLINE static dualquat nlerp(dualquat a, dualquat b, float t) noexcept {
+            return shz_dualquat_nlerp(a, b, t);
+        }
+
+        //! Returns the screw linear interpolation from \p a to \p b by a \p t factor of `0.0f-1.0f`.
+        SHZ_FORCE_INLINE static dualquat sclerp(dualquat a, dualquat b, float t) noexcept {
+            return shz_dualquat_sclerp(a, b, t);
+        }
+
+        //! @}
+
+        //! Overloaded comparison operator, checks for dual quaternion equality.
+        friend bool operator==(dualquat lhs, dualquat rhs) noexcept {
+            return shz_dualquat_equal(lhs, rhs);
+        }
+
+        /*! \name  Properties
+            \brief Routines for accessing or extracting values.
+            @{
+        */
+
+        //! Returns the rotation of the given dual quaternion.
+        SHZ_FORCE_INLINE quat rotation() const noexcept {
+            return shz_dualquat_rotation(*this);
+        }
+
+        //! Returns the translation of the given dual quaternion.
+        SHZ_FORCE_INLINE vec3 translation() const noexcept {
+            return shz_dualquat_translation(*this);
+        }
+
+        //! Returns the dot product between the real parts of the given dual quaternion and another.
+        SHZ_FORCE_INLINE float dot(dualquat other) const noexcept {
+            return shz_dualquat_dot(*this, other);
+        }
+
+        //! Returns the rigid transform represented by the given dual quaternion as a 4x4 matrix.
+        SHZ_FORCE_INLINE mat4x4 to_mat4x4() const noexcept {
+            mat4x4 mat;
+            shz_dualquat_to_mat4x4(*this, &mat);
+            return mat;
+        }
+
+        //! Stores the rigid transform represented by the given dual quaternion into a compact 3x4 matrix.
+        SHZ_FORCE_INLINE void to_mat3x4(shz_mat3x4_t* mat) const noexcept {
+            shz_dualquat_to_mat3x4(*this, mat);
+        }
+
+        //! @}
+
+        /*! \name  Modifiers
+            \brief Routines for applying modifiers to an existing dual quaternion.
+            @{
+        */
+
+        //! Returns the given dual quaternion as a unit dual quaternion.
+        SHZ_FORCE_INLINE dualquat normalized() const noexcept {
+            return shz_dualquat_normalize(*this);
+        }
+
+        //! Normalizes the given dual quaternion.
+        SHZ_FORCE_INLINE void normalize() noexcept {
+            *this = normalized();
+        }
+
+        //! Returns the quaternion conjugate of both parts of the given dual quaternion.
+        SHZ_FORCE_INLINE dualquat conjugated() const noexcept {
+            return shz_dualquat_conjugate(*this);
+        }
+
+        //! Conjugates both parts of the given dual quaternion.
+        SHZ_FORCE_INLINE void conjugate() noexcept {
+            *this = conjugated();
+        }
+
+        //! Returns the inverse of the given dual quaternion.
+        SHZ_FORCE_INLINE dualquat inverse() const noexcept {
+            return shz_dualquat_inv(*this);
+        }
+
+        //! Inverts the given dual quaternion.
+        SHZ_FORCE_INLINE void invert() noexcept {
+            *this = inverse();
+        }
+
+        //! Returns the negation of the given dual quaternion, which represents the same transform.
+        SHZ_FORCE_INLINE dualquat negated() const noexcept {
+            return shz_dualquat_neg(*this);
+        }
+
+        //! @}
+
+        /*! \name  Arithmetic
+            \brief Routines performing calculations with dual quaternions.
+            @{
+        */
+
+        //! Returns a new dual quaternion from adding the given dual quaternion to \p rhs.
+        SHZ_FORCE_INLINE dualquat add(dualquat rhs) const noexcept {
+            return shz_dualquat_add(*this, rhs);
+        }
+
+        //! Returns a new dual quaternion from scaling both parts of the given dual quaternion by \p s.
+        SHZ_FORCE_INLINE dualquat scaled(float s) const noexcept {
+            return shz_dualquat_scale(*this, s);
+        }
+
+        //! Returns the composition of the given dual quaternion with \p rhs, which is applied first.
+        SHZ_FORCE_INLINE dualquat mult(dualquat rhs) const noexcept {
+            return shz_dualquat_mult(*this, rhs);
+        }
+
+        //! @}
+
+        /*! \name  Transformations
+            \brief Routines for applying dual-quaternion transforms.
+            @{
+        */
+
+        //! Returns the given point, rotated then translated by the given dual quaternion.
+        SHZ_FORCE_INLINE vec3 transform_point(vec3 in) const noexcept {
+            return shz_dualquat_transform_point3(*this, in);
+        }
+
+        //! Returns the given direction, only rotated by the given dual quaternion.
+        SHZ_FORCE_INLINE vec3 transform(vec3 in) const noexcept {
+            return shz_dualquat_transform_vec3(*this, in);
+        }
+
+        //! @}
+
+        //! Overloaded unary negation operator, returns the negation of the given dual quaternion.
+        SHZ_FORCE_INLINE dualquat operator-() const noexcept {
+            return negated();
+        }
+
+        //! Composes \p rhs, applied first, into the given dual quaternion.
+        SHZ_FORCE_INLINE dualquat operator*=(dualquat rhs) noexcept {
+            return *this = mult(rhs);
+        }
+    };
+
+    //! Alternate C++ alias for dualquat, for those who like POSIX style.
+    using dualquat_t = dualquat;
+
+    //! Overloaded operator for adding two dual quaternions and returning the result.
+    SHZ_FORCE_INLINE dualquat operator+(dualquat lhs, dualquat rhs) noexcept {
+        return lhs.add(rhs);
+    }
+
+    //! Overloaded operator for composing two dual quaternions, where \p rhs is applied first.
+    SHZ_FORCE_INLINE dualquat operator*(dualquat lhs, dualquat rhs) noexcept {
+        return lhs.mult(rhs);
+    }
+
+    //! Overloaded operator for scaling both parts of \p lhs by \p rhs and returning the result.
+    SHZ_FORCE_INLINE dualquat operator*(dualquat lhs, float rhs) noexcept {
+        return lhs.scaled(rhs);
+    }
+
+    //! Overloaded operator for scaling both parts of \p rhs by \p lhs and returning the result.
+    SHZ_FORCE_INLINE dualquat operator*(float lhs, dualquat rhs) noexcept {
+        return rhs.scaled(lhs);
+    }
+
+    //! Overloaded operator for transforming a point, \p rhs, by a dual quaternion, \p lhs.
+    SHZ_FORCE_INLINE vec3 operator*(dualquat lhs, vec3 rhs) noexcept {
+        return lhs.transform_point(rhs);
+    }
+
+    //! C++ wrapper around shz_skin_dualquat(), which skins vertices against a palette of dual quaternions.
+    SHZ_FORCE_INLINE void skin(const shz_dualquat_t* palette, const skin_influence* influences,
+                               shz_vec3_t* dst_positions, const shz_vec3_t* src_positions,
+                               shz_vec3_t* dst_normals, const shz_vec3_t* src_normals,
+                               size_t count, size_t stride=0) noexcept {
+        shz_skin_dualquat(palette, influences, dst_positions, src_positions, dst_normals, src_normals, count, stride);
+    }
+}
+
+#endif
@@ -0,0 +1,97 @@
+/*! \file
+    \brief Routines for updating transform hierarchies.
+    \ingroup hierarchy
+
+    This file contains the public types and interface for flattening a
+    hierarchy of local transforms into world transforms.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#ifndef SHZ_HIERARCHY_H
+#define SHZ_HIERARCHY_H
+
+#include "shz_matrix.h"
+
+/*! \defgroup hierarchy Hierarchy
+    \brief    Propagation of transforms through node hierarchies.
+
+    A hierarchy is a flat array of nodes, such as the bones of a skeleton
+    or the objects of a scene graph, each with a local transform relative
+    to its parent. Updating it computes every world transform as the world
+    transform of its parent applied to its own local transform.
+
+    Nodes must be stored in topological order, with every parent placed
+    before each of its children. The world transform of a parent is kept
+    loaded within XMTRX while consecutive children referring to it are
+    updated, so storing siblings adjacently, as within a breadth-first
+    ordering, minimizes reloads.
+
+    Each node carries a dirty flag, which is set by the user upon changing
+    its local transform. Dirty flags are propagated down to every
+    descendant, while clean subtrees are skipped, and are cleared by each
+    update.
+*/
+
+SHZ_DECLS_BEGIN
+
+//! Parent index of a node with no parent, whose world transform is its local transform.
+#define SHZ_HIERARCHY_ROOT  UINT32_MAX
+
+/*! Structure-of-arrays view over the nodes of a transform hierarchy.
+
+    Each array holds one element per node.
+
+    \warning \p locals and \p worlds must be aligned to 8-byte boundaries!
+*/
+typedef struct shz_hierarchy {
+    const uint32_t*     parents;    //!< Index of each node's parent, which must precede it, or SHZ_HIERARCHY_ROOT.
+    const shz_mat4x4_t* locals;     //!< Transform of each node, relative to its parent.
+    shz_mat4x4_t*       worlds;     //!< Resulting transform of each node, relative to the world.
+    uint8_t*            dirty;      //!< Nonzero for each node whose local transform has changed.
+    size_t              count;      //!< Number of nodes.
+} shz_hierarchy_t;
+
+//! Alternate shz_hierarchy_t C typedef for those who hate POSIX style.
+typedef shz_hierarchy_t shz_hierarchy;
+
+/*! \name  Updating
+    \brief Routines recomputing the world transforms of dirty nodes.
+
+    \warning These routines clobber XMTRX.
+    @{
+*/
+
+/*! Updates the world transform of every dirty node within \p hierarchy.
+
+    A node is updated when either it or any of its ancestors is dirty,
+    after which every dirty flag is cleared.
+
+    \returns The number of world transforms which were recomputed.
+*/
+size_t shz_hierarchy_update(const shz_hierarchy_t* hierarchy) SHZ_NOEXCEPT;
+
+/*! Updates \p hierarchy as with shz_hierarchy_update(), across as many as \p threads threads.
+
+    The nodes are split into contiguous ranges, where no node within one
+    range is the descendant of a node within another, which are updated
+    in parallel by worker threads, along with the calling thread. Small
+    hierarchies, or those whose subtrees cannot be separated, are updated
+    serially.
+
+    \note
+    Workers are only spawned by host builds whose TLS model is based upon
+    pthreads or C11 threads, so that each has its own XMTRX. Otherwise,
+    this is equivalent to shz_hierarchy_update().
+
+    \returns The number of world transforms which were recomputed.
+*/
+size_t shz_hierarchy_update_parallel(const shz_hierarchy_t* hierarchy, unsigned threads) SHZ_NOEXCEPT;
+
+//! @}
+
+SHZ_DECLS_END
+
+#endif // SHZ_HIERARCHY_H
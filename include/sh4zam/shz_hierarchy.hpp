@@ -0,0 +1,34 @@
+/*! \file
+    \brief   C++ routines for updating transform hierarchies.
+    \ingroup hierarchy
+
+    This file provides a C++ binding layer over the C API provided by
+    shz_hierarchy.h.
+
+    \author    2026 Falco Girgis
+    \copyright MIT License
+*/
+
+#ifndef SHZ_HIERARCHY_HPP
+#define SHZ_HIERARCHY_HPP
+
+#include "shz_hierarchy.h"
+#include "shz_matrix.hpp"
+
+namespace shz {
+
+    //! C++ alias for the structure-of-arrays view over the nodes of a transform hierarchy.
+    using hierarchy = shz_hierarchy_t;
+
+    //! C++ wrapper around shz_hierarchy_update(), which recomputes the world transforms of dirty nodes.
+    SHZ_FORCE_INLINE size_t update(const hierarchy& nodes) noexcept {
+        return shz_hierarchy_update(&nodes);
+    }
+
+    //! C++ wrapper around shz_hierarchy_update_parallel(), which recomputes the world transforms of dirty nodes across threads.
+    SHZ_FORCE_INLINE size_t update_parallel(const hierarchy& nodes, unsigned threads) noexcept {
+        return shz_hierarchy_update_parallel(&nodes, threads);
+    }
+}
+
+#endif
@@ -0,0 +1,167 @@
+/*! \file
+    \brief Routines for per-vertex lighting and fog.
+    \ingroup light
+
+    This file contains the public types and interface for describing
+    directional, point, and spot lights, then evaluating them along with
+    fog over streams of vertices, producing packed colors.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#ifndef SHZ_LIGHT_H
+#define SHZ_LIGHT_H
+
+#include "shz_vector.h"
+
+/*! \defgroup light Lighting
+    \brief    Per-vertex lighting and fog.
+
+    Lighting is evaluated on the CPU, once per vertex, with the result
+    written out as a packed ARGB8888 color, ready for submission. Each
+    color is given by the Lambertian model:
+
+        color = ambient + sum(light.color * max(N . L, 0) * attenuation * spot)
+
+    with every channel then saturated, blended towards the fog color by
+    the fog factor, and packed.
+
+    Directional lights are evaluated three at a time, with a single
+    shz_vec3_dot3() against the normal, while point and spot lights each
+    share a single shz_vec3_dot3() between their diffuse, distance, and
+    cone terms.
+
+    \note
+    There is no separate material color; to light a tinted surface, scale
+    the ambient color and the color of each light by it up-front.
+
+    \sa shz_vec3_dot3()
+*/
+
+SHZ_DECLS_BEGIN
+
+//! Maximum number of lights which may be evaluated together.
+#define SHZ_LIGHTS_MAX  8
+
+//! Types of lights.
+typedef enum shz_light_type {
+    SHZ_LIGHT_DIRECTIONAL,  //!< Infinitely distant light, shining in a single direction.
+    SHZ_LIGHT_POINT,        //!< Light radiating in every direction from a position, attenuating with distance.
+    SHZ_LIGHT_SPOT          //!< Point light which only shines within a cone.
+} shz_light_type_t;
+
+//! Alternate shz_light_type_t C typedef for those who hate POSIX style.
+typedef shz_light_type_t shz_light_type;
+
+//! Single light, which is initialized through one of the shz_light_init_() routines.
+typedef struct shz_light {
+    shz_light_type_t type;          //!< Type of light.
+    shz_vec3_t       color;         //!< RGB color, which may exceed 1.0f to brighten.
+    shz_vec3_t       position;      //!< Position of point and spot lights.
+    shz_vec3_t       direction;     //!< Normalized direction the light shines in, for directional and spot lights.
+    shz_vec3_t       attenuation;   //!< Constant, linear, and quadratic attenuation factors of point and spot lights.
+    float            cos_inner;     //!< Cosine of the angle within which a spot light is at full intensity.
+    float            cos_outer;     //!< Cosine of the angle outside of which a spot light has no effect.
+} shz_light_t;
+
+//! Alternate shz_light_t C typedef for those who hate POSIX style.
+typedef shz_light_t shz_light;
+
+//! Fog modes.
+typedef enum shz_fog_mode {
+    SHZ_FOG_NONE,   //!< No fog.
+    SHZ_FOG_LINEAR, //!< Fog increasing linearly from shz_fog_t::start to shz_fog_t::end.
+    SHZ_FOG_EXP     //!< Fog increasing exponentially with shz_fog_t::density.
+} shz_fog_mode_t;
+
+//! Alternate shz_fog_mode_t C typedef for those who hate POSIX style.
+typedef shz_fog_mode_t shz_fog_mode;
+
+/*! Fog applied to the lit color of each vertex.
+
+    The depth of each vertex is its distance along \p plane, which is
+    typically the camera's forward axis, with its W set so that the
+    camera's position lies at a depth of 0.
+*/
+typedef struct shz_fog {
+    shz_fog_mode_t mode;    //!< Fog mode, or SHZ_FOG_NONE to disable fog.
+    shz_vec3_t     color;   //!< RGB color of the fog.
+    shz_vec4_t     plane;   //!< Plane, as <normal, distance>, giving the depth of each vertex.
+    float          start;   //!< Depth at which linear fog begins.
+    float          end;     //!< Depth at which linear fog completely obscures the vertex.
+    float          density; //!< Density of exponential fog.
+} shz_fog_t;
+
+//! Alternate shz_fog_t C typedef for those who hate POSIX style.
+typedef shz_fog_t shz_fog;
+
+//! Lighting environment evaluated over each vertex.
+typedef struct shz_lighting {
+    shz_vec3_t         ambient;     //!< RGB color applied to every vertex, regardless of the lights.
+    float              alpha;       //!< Alpha of every output color, from 0.0f to 1.0f.
+    const shz_light_t* lights;      //!< Array of lights.
+    size_t             light_count; //!< Number of \p lights, up to SHZ_LIGHTS_MAX.
+    shz_fog_t          fog;         //!< Fog applied after lighting.
+} shz_lighting_t;
+
+//! Alternate shz_lighting_t C typedef for those who hate POSIX style.
+typedef shz_lighting_t shz_lighting;
+
+/*! \name  Initialization
+    \brief Routines for initializing each type of light.
+    @{
+*/
+
+//! Returns a directional light of the given color, shining along the normalized \p direction.
+SHZ_INLINE shz_light_t shz_light_init_directional(shz_vec3_t direction, shz_vec3_t color) SHZ_NOEXCEPT;
+
+//! Returns a point light of the given color at \p position, with <constant, linear, quadratic> \p attenuation.
+SHZ_INLINE shz_light_t shz_light_init_point(shz_vec3_t position, shz_vec3_t color, shz_vec3_t attenuation) SHZ_NOEXCEPT;
+
+//! Returns a spot light, as with a point light, shining along \p direction between the \p inner and \p outer half-angles, in radians.
+SHZ_INLINE shz_light_t shz_light_init_spot(shz_vec3_t position,
+                                           shz_vec3_t direction,
+                                           shz_vec3_t color,
+                                           shz_vec3_t attenuation,
+                                           float      inner,
+                                           float      outer) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Evaluation
+    \brief Routines for lighting streams of vertices.
+    @{
+*/
+
+//! Returns the fog factor, from 1.0f when unobscured to 0.0f when completely fogged, at the given depth.
+SHZ_INLINE float shz_fog_factor(const shz_fog_t* fog, float depth) SHZ_NOEXCEPT;
+
+/*! Lights \p count vertices, writing a packed ARGB8888 color for each.
+
+    The position and normal of each vertex are read from \p positions and
+    \p normals, which are both \p stride bytes apart, so they may be
+    members of the same interleaved vertex structure. Each color is
+    written \p color_stride bytes apart within \p colors, such as into
+    the `argb` member of a `pvr_vertex_t`. A stride of 0 denotes a tightly
+    packed array.
+
+    \note
+    Normals are expected to be normalized.
+*/
+void shz_lighting_apply(const shz_lighting_t* lighting,
+                        const shz_vec3_t*     positions,
+                        const shz_vec3_t*     normals,
+                        size_t                count,
+                        size_t                stride,
+                        uint32_t*             colors,
+                        size_t                color_stride) SHZ_NOEXCEPT;
+
+//! @}
+
+#include "inline/shz_light.inl.h"
+
+SHZ_DECLS_END
+
+#endif // SHZ_LIGHT_H
@@ -0,0 +1,73 @@
+/*! \file
+    \brief   C++ routines for per-vertex lighting and fog.
+    \ingroup light
+
+    This file provides a C++ binding layer over the C API provided by
+    shz_light.h.
+
+    \author    2026 Falco Girgis
+    \copyright MIT License
+*/
+
+#ifndef SHZ_LIGHT_HPP
+#define SHZ_LIGHT_HPP
+
+#include "shz_light.h"
+#include "shz_vector.hpp"
+
+namespace shz {
+
+    //! C++ alias for a single light.
+    using light = shz_light_t;
+
+    //! C++ alias for fog applied after lighting.
+    using fog = shz_fog_t;
+
+    //! C++ wrapper around shz_light_init_directional().
+    SHZ_FORCE_INLINE light light_directional(shz_vec3_t direction, shz_vec3_t color) noexcept {
+        return shz_light_init_directional(direction, color);
+    }
+
+    //! C++ wrapper around shz_light_init_point().
+    SHZ_FORCE_INLINE light light_point(shz_vec3_t position, shz_vec3_t color, shz_vec3_t attenuation) noexcept {
+        return shz_light_init_point(position, color, attenuation);
+    }
+
+    //! C++ wrapper around shz_light_init_spot().
+    SHZ_FORCE_INLINE light light_spot(shz_vec3_t position, shz_vec3_t direction, shz_vec3_t color,
+                                      shz_vec3_t attenuation, float inner, float outer) noexcept {
+        return shz_light_init_spot(position, direction, color, attenuation, inner, outer);
+    }
+
+    //! C++ wrapper around shz_fog_factor().
+    SHZ_FORCE_INLINE float fog_factor(const shz_fog_t& fog, float depth) noexcept {
+        return shz_fog_factor(&fog, depth);
+    }
+
+    /*! C++ structure describing a lighting environment.
+
+        \note
+        shz::lighting is the C++ extension of shz_lighting_t, which adds
+        member functions for lighting streams of vertices and still retains
+        backwards compatibility with the C API.
+
+        \sa shz_lighting_t
+    */
+    struct lighting: public shz_lighting_t {
+
+        //! Default constructor, which does nothing.
+        lighting() noexcept = default;
+
+        //! Constructs an environment from the ambient color and the array of \p count lights, without fog.
+        SHZ_FORCE_INLINE lighting(shz_vec3_t ambient, const light* lights = nullptr, size_t count = 0, float alpha = 1.0f) noexcept:
+            shz_lighting_t({ ambient, alpha, lights, count, { SHZ_FOG_NONE, {}, {}, 0.0f, 0.0f, 0.0f } }) {}
+
+        //! C++ wrapper around shz_lighting_apply().
+        SHZ_FORCE_INLINE void apply(const shz_vec3_t* positions, const shz_vec3_t* normals, size_t count,
+                                    uint32_t* colors, size_t stride = 0, size_t color_stride = 0) const noexcept {
+            shz_lighting_apply(this, positions, normals, count, stride, colors, color_stride);
+        }
+    };
+}
+
+#endif
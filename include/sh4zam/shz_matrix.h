@@ -921,6 +921,71 @@ SHZ_INLINE shz_vec3_t shz_mat3x3_transform_vec3_transpose(const shz_mat3x3_t* m,
 
 //! \endcond
 
+/*! \name  Skinning
+    \brief Matrix-palette linear blend skinning of vertex streams.
+
+    Skins each vertex by the weighted sum of up to SHZ_SKIN_MAX_INFLUENCES
+    bone matrices, selected from a palette by its per-vertex indices.
+
+    Consecutive vertices bound to the same single bone are transformed as
+    one run by the batched XMTRX routines, whose matrix is only loaded
+    when the bone changes, so meshes which are sorted by bone spend
+    most of their time in the fast path. Vertices with multiple influences
+    blend their matrices in-place before transforming, rather than loading
+    each one.
+
+    Every per-vertex array advances by \p stride bytes between
+    consecutive vertices, allowing them to be members of interleaved
+    vertex structures, or by the size of its own elements when \p stride
+    is 0. Skinned vertices may be written over their sources.
+
+    \note
+    Normals are transformed by the upper 3x3 of each matrix without being
+    renormalized, so palettes should not contain non-uniform scales.
+
+    \warning These routines clobber XMTRX.
+    @{
+*/
+
+//! Maximum number of bones which may influence a single vertex.
+#define SHZ_SKIN_MAX_INFLUENCES 4
+
+/*! Bone indices and weights of a single skinned vertex.
+
+    A vertex's weights must sum to 1.0f, and its unused influences must
+    come last, with weights of 0.0f. A vertex whose second weight is 0.0f
+    is bound only to its first bone, which enables the fast path.
+*/
+typedef struct shz_skin_influence {
+    float   weights[SHZ_SKIN_MAX_INFLUENCES];   //!< Weight of each influencing bone.
+    uint8_t bones[SHZ_SKIN_MAX_INFLUENCES];     //!< Palette index of each influencing bone.
+} shz_skin_influence_t;
+
+//! Alternate shz_skin_influence_t C typedef for those who hate POSIX style.
+typedef shz_skin_influence_t shz_skin_influence;
+
+/*! Skins \p count vertices against a palette of 4x4 matrices.
+
+    Transforms each position from \p src_positions into \p dst_positions
+    and, unless they're NULL, each normal from \p src_normals into
+    \p dst_normals, by the blend of the \p palette matrices given by each
+    vertex's entry within \p influences.
+
+    \warning \p palette must be aligned to 8-byte boundaries!
+*/
+void shz_skin_mat4x4(const shz_mat4x4_t* palette, const shz_skin_influence_t* influences,
+                     shz_vec3_t* dst_positions, const shz_vec3_t* src_positions,
+                     shz_vec3_t* dst_normals, const shz_vec3_t* src_normals,
+                     size_t count, size_t stride) SHZ_NOEXCEPT;
+
+//! Equivalent to shz_skin_mat4x4(), except with a compact palette of 3x4 affine matrices.
+void shz_skin_mat3x4(const shz_mat3x4_t* palette, const shz_skin_influence_t* influences,
+                     shz_vec3_t* dst_positions, const shz_vec3_t* src_positions,
+                     shz_vec3_t* dst_normals, const shz_vec3_t* src_normals,
+                     size_t count, size_t stride) SHZ_NOEXCEPT;
+
+//! @}
+
 #include "inline/shz_matrix.inl.h"
 
 SHZ_DECLS_END
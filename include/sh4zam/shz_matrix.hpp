@@ -527,6 +527,32 @@ namespace shz {
 
     //! Alternate mat4x4 C++ alias for those who like POSIX style.
     using mat4x4_t = mat4x4;
+
+    /*! \name  Skinning
+        \brief Matrix-palette linear blend skinning of vertex streams.
+        @{
+    */
+
+    //! C++ alias for the bone indices and weights of a skinned vertex.
+    using skin_influence = shz_skin_influence_t;
+
+    //! C++ wrapper around shz_skin_mat4x4(), which skins vertices against a palette of 4x4 matrices.
+    SHZ_FORCE_INLINE void skin(const shz_mat4x4_t* palette, const skin_influence* influences,
+                               shz_vec3_t* dst_positions, const shz_vec3_t* src_positions,
+                               shz_vec3_t* dst_normals, const shz_vec3_t* src_normals,
+                               size_t count, size_t stride=0) noexcept {
+        shz_skin_mat4x4(palette, influences, dst_positions, src_positions, dst_normals, src_normals, count, stride);
+    }
+
+    //! C++ wrapper around shz_skin_mat3x4(), which skins vertices against a palette of 3x4 affine matrices.
+    SHZ_FORCE_INLINE void skin(const shz_mat3x4_t* palette, const skin_influence* influences,
+                               shz_vec3_t* dst_positions, const shz_vec3_t* src_positions,
+                               shz_vec3_t* dst_normals, const shz_vec3_t* src_normals,
+                               size_t count, size_t stride=0) noexcept {
+        shz_skin_mat3x4(palette, influences, dst_positions, src_positions, dst_normals, src_normals, count, stride);
+    }
+
+    //! @}
 }
 
 #endif
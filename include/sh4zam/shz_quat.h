@@ -234,6 +234,64 @@ SHZ_INLINE shz_vec3_t shz_quat_transform_vec3(shz_quat_t q, shz_vec3_t v) SHZ_NO
 
 //! @}
 
+/*! \name  Pose Blending
+    \brief Batched interpolation of whole skeletal poses.
+
+    These routines interpolate every bone of a pose within a single pass,
+    without branching per bone, so that host compilers are able to
+    vectorize them. Each pair of rotations is still interpolated along the
+    shorter arc, by selecting the sign of its weight rather than negating
+    either input.
+
+    Spherical interpolation uses a polynomial approximation of the SLERP
+    coefficients in terms of the dot product (Eberly, "A Fast and Accurate
+    Algorithm for Computing SLERP"), whose components stay within 3e-5 of
+    an exact SLERP, in place of calling acosf() and sinf() for every bone.
+
+    Destinations may alias their sources.
+    @{
+*/
+
+//! Stores the shortest-arc SLERP by \p t of each pair of quaternions from \p a and \p b into \p dst.
+void shz_quat_slerp_array(shz_quat_t* dst, const shz_quat_t* a, const shz_quat_t* b, float t, size_t count) SHZ_NOEXCEPT;
+
+//! Stores the shortest-arc, normalized LERP by \p t of each pair of quaternions from \p a and \p b into \p dst.
+void shz_quat_nlerp_array(shz_quat_t* dst, const shz_quat_t* a, const shz_quat_t* b, float t, size_t count) SHZ_NOEXCEPT;
+
+/*! Stores the normalized, weighted sum of each quaternion across the \p sources arrays of \p srcs into \p dst.
+
+    Every quaternion is first flipped into the same hemisphere as its
+    counterpart within `srcs[0]`. The weights should sum to 1.0f.
+*/
+void shz_quat_blend_array(shz_quat_t* dst, const shz_quat_t* const* srcs, const float* weights,
+                          size_t sources, size_t count) SHZ_NOEXCEPT;
+
+/*! Structure-of-arrays view over the local transforms of a skeleton's bones.
+
+    Translations and scales are optional, and are skipped when NULL within
+    either the destination or any source.
+*/
+typedef struct shz_pose {
+    shz_quat_t* rotations;    //!< Rotation of each bone.
+    shz_vec3_t* translations; //!< Translation of each bone, or NULL.
+    shz_vec3_t* scales;       //!< Scale of each bone, or NULL.
+} shz_pose_t;
+
+//! Alternate shz_pose_t C typedef for those who hate POSIX style.
+typedef shz_pose_t shz_pose;
+
+//! Equivalent to shz_quat_slerp_array(), with each bone's translation and scale also linearly interpolated within the same pass.
+void shz_pose_slerp(const shz_pose_t* dst, const shz_pose_t* a, const shz_pose_t* b, float t, size_t bones) SHZ_NOEXCEPT;
+
+//! Equivalent to shz_quat_nlerp_array(), with each bone's translation and scale also linearly interpolated within the same pass.
+void shz_pose_nlerp(const shz_pose_t* dst, const shz_pose_t* a, const shz_pose_t* b, float t, size_t bones) SHZ_NOEXCEPT;
+
+//! Equivalent to shz_quat_blend_array(), with each bone's translation and scale also blended by the same weights.
+void shz_pose_blend(const shz_pose_t* dst, const shz_pose_t* srcs, const float* weights,
+                    size_t sources, size_t bones) SHZ_NOEXCEPT;
+
+//! @}
+
 #include "inline/shz_quat.inl.h"
 
 SHZ_DECLS_END
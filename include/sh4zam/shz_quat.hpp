@@ -454,6 +454,47 @@ namespace shz {
     SHZ_FORCE_INLINE vec3 operator*(quat lhs, vec3 rhs) noexcept {
         return lhs.transform(rhs);
     }
+
+    /*! \name  Pose Blending
+        \brief Batched interpolation of whole skeletal poses.
+        @{
+    */
+
+    //! C++ alias for the structure-of-arrays view over a skeleton's bone transforms.
+    using pose = shz_pose_t;
+
+    //! C++ wrapper around shz_quat_slerp_array(), which interpolates each pair of quaternions spherically.
+    SHZ_FORCE_INLINE void slerp_array(shz_quat_t* dst, const shz_quat_t* a, const shz_quat_t* b, float t, size_t count) noexcept {
+        shz_quat_slerp_array(dst, a, b, t, count);
+    }
+
+    //! C++ wrapper around shz_quat_nlerp_array(), which interpolates each pair of quaternions linearly, then normalizes them.
+    SHZ_FORCE_INLINE void nlerp_array(shz_quat_t* dst, const shz_quat_t* a, const shz_quat_t* b, float t, size_t count) noexcept {
+        shz_quat_nlerp_array(dst, a, b, t, count);
+    }
+
+    //! C++ wrapper around shz_quat_blend_array(), which takes the weighted blend of each quaternion across several arrays.
+    SHZ_FORCE_INLINE void blend_array(shz_quat_t* dst, const shz_quat_t* const* srcs, const float* weights,
+                                      size_t sources, size_t count) noexcept {
+        shz_quat_blend_array(dst, srcs, weights, sources, count);
+    }
+
+    //! C++ wrapper around shz_pose_slerp(), which interpolates whole poses with spherical rotations.
+    SHZ_FORCE_INLINE void slerp(const pose& dst, const pose& a, const pose& b, float t, size_t bones) noexcept {
+        shz_pose_slerp(&dst, &a, &b, t, bones);
+    }
+
+    //! C++ wrapper around shz_pose_nlerp(), which interpolates whole poses with normalized linear rotations.
+    SHZ_FORCE_INLINE void nlerp(const pose& dst, const pose& a, const pose& b, float t, size_t bones) noexcept {
+        shz_pose_nlerp(&dst, &a, &b, t, bones);
+    }
+
+    //! C++ wrapper around shz_pose_blend(), which takes the weighted blend of several poses.
+    SHZ_FORCE_INLINE void blend(const pose& dst, const pose* srcs, const float* weights, size_t sources, size_t bones) noexcept {
+        shz_pose_blend(&dst, srcs, weights, sources, bones);
+    }
+
+    //! @}
 }
 
 #endif
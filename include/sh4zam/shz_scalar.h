@@ -323,6 +323,9 @@ SHZ_INLINE float shz_mag_sqr4f(float x, float y, float z, float w) SHZ_NOEXCEPT;
 
 /*! \name  Transcendental
     \brief Fast approximations for non-trig transcendental functions.
+
+    The accuracy of these routines, along with shz_cbrtf(), is selected by
+    \ref SHZ_PRECISION, or per call from C++ with shz::approx.
     @{
 */
 
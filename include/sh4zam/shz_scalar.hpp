@@ -171,6 +171,40 @@ namespace shz {
     // C++ alias for shz_expf()
     constexpr auto expf   = shz_expf;
     //! @}
+
+    /*! Transcendental routines with an explicit precision tier.
+
+        Each routine takes its tier as a template argument, overriding
+        SHZ_PRECISION on a per-call basis:
+
+            float y = shz::approx::logf<shz::precision::precise>(x);
+    */
+    namespace approx {
+        //! Tiered version of shz_cbrtf().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float cbrtf(float x) noexcept { return shz_cbrtf_tier(x, static_cast<int>(P)); }
+        //! Tiered version of shz_pow2f().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float pow2f(float p) noexcept { return shz_pow2f_tier(p, static_cast<int>(P)); }
+        //! Tiered version of shz_powf().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float powf(float x, float p) noexcept { return shz_powf_tier(x, p, static_cast<int>(P)); }
+        //! Tiered version of shz_pow10f().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float pow10f(float p) noexcept { return shz_pow10f_tier(p, static_cast<int>(P)); }
+        //! Tiered version of shz_log2f().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float log2f(float x) noexcept { return shz_log2f_tier(x, static_cast<int>(P)); }
+        //! Tiered version of shz_logf().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float logf(float x) noexcept { return shz_logf_tier(x, static_cast<int>(P)); }
+        //! Tiered version of shz_log10f().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float log10f(float x) noexcept { return shz_log10f_tier(x, static_cast<int>(P)); }
+        //! Tiered version of shz_expf().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float expf(float p) noexcept { return shz_expf_tier(p, static_cast<int>(P)); }
+    }
 }
 
 #endif
@@ -20,6 +20,16 @@
 #include "shz_vector.h"
 #include "shz_quat.h"
 #include "shz_matrix.h"
+#include "shz_dualquat.h"
+#include "shz_anim.h"
+#include "shz_hierarchy.h"
+#include "shz_chain.h"
+#include "shz_transform.h"
+#include "shz_cull.h"
+#include "shz_clip.h"
+#include "shz_light.h"
+#include "shz_color.h"
+#include "shz_twiddle.h"
 #include "shz_xmtrx.h"
 #include "shz_complex.h"
 
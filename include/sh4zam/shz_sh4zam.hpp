@@ -20,6 +20,16 @@
 #include "shz_vector.hpp"
 #include "shz_quat.hpp"
 #include "shz_matrix.hpp"
+#include "shz_dualquat.hpp"
+#include "shz_anim.hpp"
+#include "shz_hierarchy.hpp"
+#include "shz_chain.hpp"
+#include "shz_transform.hpp"
+#include "shz_cull.hpp"
+#include "shz_clip.hpp"
+#include "shz_light.hpp"
+#include "shz_color.hpp"
+#include "shz_twiddle.hpp"
 #include "shz_xmtrx.hpp"
 #include "shz_complex.hpp"
 
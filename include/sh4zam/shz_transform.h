@@ -0,0 +1,181 @@
+/*! \file
+    \brief Routines for operating upon kind-tagged transform matrices.
+    \ingroup transform
+
+    This file contains the public types and interface for 4x4 matrices
+    which track the kind of transform they represent, so that each
+    operation may skip the work its kind makes redundant.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#ifndef SHZ_TRANSFORM_H
+#define SHZ_TRANSFORM_H
+
+#include "shz_matrix.h"
+
+/*! \defgroup transform Transforms
+    \brief    4x4 matrices tagged with the kind of transform they hold.
+
+    Most matrices within a game are far from arbitrary: node transforms are
+    rigid or scaled, while only the projection is truly projective. A
+    shz_transform_t pairs a matrix with its kind, which is maintained by
+    every routine initializing, applying to, or multiplying it, so that
+    each dispatches to the cheapest kernel for the kinds involved:
+
+    | Kind        | Multiply           | Inverse             | Point transform |
+    |-------------|--------------------|---------------------|-----------------|
+    | Identity    | Copy               | Copy                | None            |
+    | Translation | 3 adds             | 3 negations         | 3 adds          |
+    | Diagonal    | 3 multiplies       | 3 reciprocals       | 3 multiplies    |
+    | Rigid       | 3x4 affine product | Transpose           | 3x4 product     |
+    | Affine      | 3x4 affine product | Block-triangular    | 3x4 product     |
+    | Projective  | Full 4x4 product   | Full 4x4 inverse    | Full 4x4 product|
+
+    Mixed operands use the cheapest kernel which is valid for both, such as
+    a translation merely offsetting the last column of any affine matrix.
+
+    \note
+    Every kind is a special case of an affine transform, which is itself a
+    special case of a projective one.
+*/
+
+SHZ_DECLS_BEGIN
+
+//! Kinds of transforms, which a shz_transform_t may be tagged as.
+typedef enum shz_transform_kind {
+    SHZ_TRANSFORM_IDENTITY,     //!< Identity matrix.
+    SHZ_TRANSFORM_TRANSLATION,  //!< Translation only.
+    SHZ_TRANSFORM_DIAGONAL,     //!< Scale only, along the X, Y, and Z axes.
+    SHZ_TRANSFORM_RIGID,        //!< Rotation, followed by translation.
+    SHZ_TRANSFORM_AFFINE,       //!< Any transform whose bottom row is (0, 0, 0, 1).
+    SHZ_TRANSFORM_PROJECTIVE    //!< Any 4x4 matrix.
+} shz_transform_kind_t;
+
+//! Alternate shz_transform_kind_t C typedef for those who hate POSIX style.
+typedef shz_transform_kind_t shz_transform_kind;
+
+/*! 4x4 matrix, tagged with the kind of transform it holds.
+
+    \warning
+    Modifying \p matrix directly without updating \p kind to a kind which
+    is at least as general results in undefined behavior.
+*/
+typedef struct shz_transform {
+    shz_mat4x4_t         matrix;    //!< Column-major transform matrix.
+    shz_transform_kind_t kind;      //!< Kind of transform held by \p matrix.
+} shz_transform_t;
+
+//! Alternate shz_transform_t C typedef for those who hate POSIX style.
+typedef shz_transform_t shz_transform;
+
+/*! \name  Initialization
+    \brief Routines for initializing transforms of known kinds.
+    @{
+*/
+
+//! Initializes the given transform to identity.
+SHZ_INLINE void shz_transform_init_identity(shz_transform_t* xf) SHZ_NOEXCEPT;
+
+//! Initializes the given transform to a translation by (\p x, \p y, \p z).
+SHZ_INLINE void shz_transform_init_translation(shz_transform_t* xf, float x, float y, float z) SHZ_NOEXCEPT;
+
+//! Initializes the given transform to a scale by (\p x, \p y, \p z).
+SHZ_INLINE void shz_transform_init_scale(shz_transform_t* xf, float x, float y, float z) SHZ_NOEXCEPT;
+
+//! Initializes the given transform to a rotation by the unit quaternion \p q.
+SHZ_INLINE void shz_transform_init_rotation_quat(shz_transform_t* xf, shz_quat_t q) SHZ_NOEXCEPT;
+
+//! Initializes the given transform to a rotation by the unit quaternion \p q, followed by a translation by \p t.
+SHZ_INLINE void shz_transform_init_rigid(shz_transform_t* xf, shz_quat_t q, shz_vec3_t t) SHZ_NOEXCEPT;
+
+//! Initializes the given transform to a perspective projection, as with shz_mat4x4_init_perspective().
+SHZ_INLINE void shz_transform_init_perspective(shz_transform_t* xf, float fov, float aspect, float znear) SHZ_NOEXCEPT;
+
+/*! Initializes the given transform from an untagged matrix, classifying its kind.
+
+    Identity, translation, diagonal, affine, and projective matrices are
+    detected exactly. Rigid transforms cannot be told apart from affine
+    ones without tolerances, so they're tagged as affine.
+*/
+void shz_transform_init_mat4x4(shz_transform_t* xf, const shz_mat4x4_t* mat) SHZ_NOEXCEPT;
+
+//! Returns the least general kind which holds the product of transforms of kinds \p lhs and \p rhs.
+SHZ_INLINE shz_transform_kind_t shz_transform_kind_mult(shz_transform_kind_t lhs, shz_transform_kind_t rhs) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  GL Transformations
+    \brief Routines post-multiplying transforms in place, as with shz_mat4x4_translate() and friends.
+
+    These routines never touch XMTRX.
+    @{
+*/
+
+//! Post-multiplies the given transform by a translation by (\p x, \p y, \p z).
+void shz_transform_translate(shz_transform_t* xf, float x, float y, float z) SHZ_NOEXCEPT;
+
+//! Post-multiplies the given transform by a scale by (\p x, \p y, \p z).
+void shz_transform_scale(shz_transform_t* xf, float x, float y, float z) SHZ_NOEXCEPT;
+
+//! Post-multiplies the given transform by a rotation about the X axis by \p radians.
+void shz_transform_rotate_x(shz_transform_t* xf, float radians) SHZ_NOEXCEPT;
+
+//! Post-multiplies the given transform by a rotation about the Y axis by \p radians.
+void shz_transform_rotate_y(shz_transform_t* xf, float radians) SHZ_NOEXCEPT;
+
+//! Post-multiplies the given transform by a rotation about the Z axis by \p radians.
+void shz_transform_rotate_z(shz_transform_t* xf, float radians) SHZ_NOEXCEPT;
+
+//! Post-multiplies the given transform by a rotation by the unit quaternion \p q.
+void shz_transform_rotate_quat(shz_transform_t* xf, shz_quat_t q) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Arithmetic
+    \brief Routines combining and inverting transforms.
+    @{
+*/
+
+/*! Multiplies \p lhs by \p rhs, storing the result and its kind within \p out.
+
+    \note \p out may alias either operand.
+
+    \warning This routine clobbers XMTRX when either operand is projective.
+*/
+void shz_transform_mult(shz_transform_t* out, const shz_transform_t* lhs, const shz_transform_t* rhs) SHZ_NOEXCEPT;
+
+/*! Stores the inverse of \p xf, along with its kind, within \p out.
+
+    \note \p out may alias \p xf.
+*/
+void shz_transform_inverse(shz_transform_t* out, const shz_transform_t* xf) SHZ_NOEXCEPT;
+
+//! Returns the determinant of the given transform.
+SHZ_INLINE float shz_transform_determinant(const shz_transform_t* xf) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Transformations
+    \brief Routines for transforming vectors and points.
+    @{
+*/
+
+//! Transforms the given 3D point by \p xf, treating its W component as 1.
+SHZ_INLINE shz_vec3_t shz_transform_point3(const shz_transform_t* xf, shz_vec3_t pt) SHZ_NOEXCEPT;
+
+//! Transforms the given 3D direction by \p xf, treating its W component as 0.
+SHZ_INLINE shz_vec3_t shz_transform_vec3(const shz_transform_t* xf, shz_vec3_t v) SHZ_NOEXCEPT;
+
+//! Transforms the given 4D vector by \p xf.
+SHZ_INLINE shz_vec4_t shz_transform_vec4(const shz_transform_t* xf, shz_vec4_t v) SHZ_NOEXCEPT;
+
+//! @}
+
+#include "inline/shz_transform.inl.h"
+
+SHZ_DECLS_END
+
+#endif // SHZ_TRANSFORM_H
@@ -0,0 +1,193 @@
+/*! \file
+    \brief   C++ routines for operating upon kind-tagged transform matrices.
+    \ingroup transform
+
+    This file provides a C++ binding layer over the C API provided by
+    shz_transform.h.
+
+    \author    2026 Falco Girgis
+    \copyright MIT License
+*/
+
+#ifndef SHZ_TRANSFORM_HPP
+#define SHZ_TRANSFORM_HPP
+
+#include "shz_transform.h"
+#include "shz_matrix.hpp"
+#include "shz_quat.hpp"
+
+namespace shz {
+
+    //! C++ alias for the kinds of transforms which may be tagged.
+    using transform_kind = shz_transform_kind_t;
+
+    /*! C++ structure representing a 4x4 matrix tagged with its kind.
+
+        \note
+        shz::transform is the C++ extension of shz_transform_t, which adds
+        member functions and still retains backwards compatibility with the
+        C API.
+
+        \sa shz_transform_t, shz::mat4x4
+    */
+    struct transform: public shz_transform_t {
+
+        //! Default constructor, which does nothing.
+        transform() noexcept = default;
+
+        //! Constructs a transform from the given untagged matrix, classifying its kind.
+        SHZ_FORCE_INLINE transform(const shz_mat4x4_t& mat) noexcept {
+            shz_transform_init_mat4x4(this, &mat);
+        }
+
+        /*! \name  Initialization
+            \brief Routines for initializing transforms of known kinds.
+            @{
+        */
+
+        //! C++ wrapper around shz_transform_init_identity().
+        SHZ_FORCE_INLINE void init_identity() noexcept {
+            shz_transform_init_identity(this);
+        }
+
+        //! C++ wrapper around shz_transform_init_translation().
+        SHZ_FORCE_INLINE void init_translation(float x, float y, float z) noexcept {
+            shz_transform_init_translation(this, x, y, z);
+        }
+
+        //! C++ wrapper around shz_transform_init_scale().
+        SHZ_FORCE_INLINE void init_scale(float x, float y, float z) noexcept {
+            shz_transform_init_scale(this, x, y, z);
+        }
+
+        //! C++ wrapper around shz_transform_init_rotation_quat().
+        SHZ_FORCE_INLINE void init_rotation(quat q) noexcept {
+            shz_transform_init_rotation_quat(this, q);
+        }
+
+        //! C++ wrapper around shz_transform_init_rigid().
+        SHZ_FORCE_INLINE void init_rigid(quat q, vec3 t) noexcept {
+            shz_transform_init_rigid(this, q, t);
+        }
+
+        //! C++ wrapper around shz_transform_init_perspective().
+        SHZ_FORCE_INLINE void init_perspective(float fov, float aspect, float znear) noexcept {
+            shz_transform_init_perspective(this, fov, aspect, znear);
+        }
+
+        //! C++ wrapper around shz_transform_init_mat4x4().
+        SHZ_FORCE_INLINE void init(const shz_mat4x4_t& mat) noexcept {
+            shz_transform_init_mat4x4(this, &mat);
+        }
+
+        //! Returns the untagged matrix held by the transform.
+        SHZ_FORCE_INLINE const mat4x4& mat() const noexcept {
+            return *static_cast<const mat4x4*>(&matrix);
+        }
+
+        //! @}
+
+        /*! \name  GL Transformations
+            \brief Routines post-multiplying the transform in place.
+            @{
+        */
+
+        //! C++ wrapper around shz_transform_translate().
+        SHZ_FORCE_INLINE void translate(float x, float y, float z) noexcept {
+            shz_transform_translate(this, x, y, z);
+        }
+
+        //! C++ wrapper around shz_transform_scale().
+        SHZ_FORCE_INLINE void scale(float x, float y, float z) noexcept {
+            shz_transform_scale(this, x, y, z);
+        }
+
+        //! C++ wrapper around shz_transform_rotate_x().
+        SHZ_FORCE_INLINE void rotate_x(float radians) noexcept {
+            shz_transform_rotate_x(this, radians);
+        }
+
+        //! C++ wrapper around shz_transform_rotate_y().
+        SHZ_FORCE_INLINE void rotate_y(float radians) noexcept {
+            shz_transform_rotate_y(this, radians);
+        }
+
+        //! C++ wrapper around shz_transform_rotate_z().
+        SHZ_FORCE_INLINE void rotate_z(float radians) noexcept {
+            shz_transform_rotate_z(this, radians);
+        }
+
+        //! C++ wrapper around shz_transform_rotate_quat().
+        SHZ_FORCE_INLINE void rotate(quat q) noexcept {
+            shz_transform_rotate_quat(this, q);
+        }
+
+        //! @}
+
+        /*! \name  Arithmetic
+            \brief Routines combining and inverting transforms.
+            @{
+        */
+
+        //! C++ wrapper around shz_transform_inverse().
+        SHZ_FORCE_INLINE transform inverse() const noexcept {
+            transform out;
+            shz_transform_inverse(&out, this);
+            return out;
+        }
+
+        //! C++ wrapper around shz_transform_determinant().
+        SHZ_FORCE_INLINE float determinant() const noexcept {
+            return shz_transform_determinant(this);
+        }
+
+        //! Post-multiplies the transform by \p rhs, in place.
+        SHZ_FORCE_INLINE transform& operator*=(const transform& rhs) noexcept {
+            shz_transform_mult(this, this, &rhs);
+            return *this;
+        }
+
+        //! @}
+
+        /*! \name  Transformations
+            \brief Routines for transforming vectors and points.
+            @{
+        */
+
+        //! C++ wrapper around shz_transform_point3().
+        SHZ_FORCE_INLINE vec3 transform_point(vec3 pt) const noexcept {
+            return shz_transform_point3(this, pt);
+        }
+
+        //! C++ wrapper around shz_transform_vec3().
+        SHZ_FORCE_INLINE vec3 transform_vec(vec3 v) const noexcept {
+            return shz_transform_vec3(this, v);
+        }
+
+        //! C++ wrapper around shz_transform_vec4().
+        SHZ_FORCE_INLINE vec4 transform_vec(vec4 v) const noexcept {
+            return shz_transform_vec4(this, v);
+        }
+
+        //! @}
+    };
+
+    //! C++ wrapper around shz_transform_mult().
+    SHZ_FORCE_INLINE transform operator*(const transform& lhs, const transform& rhs) noexcept {
+        transform out;
+        shz_transform_mult(&out, &lhs, &rhs);
+        return out;
+    }
+
+    //! C++ wrapper around shz_transform_point3().
+    SHZ_FORCE_INLINE vec3 operator*(const transform& lhs, vec3 rhs) noexcept {
+        return shz_transform_point3(&lhs, rhs);
+    }
+
+    //! C++ wrapper around shz_transform_vec4().
+    SHZ_FORCE_INLINE vec4 operator*(const transform& lhs, vec4 rhs) noexcept {
+        return shz_transform_vec4(&lhs, rhs);
+    }
+}
+
+#endif
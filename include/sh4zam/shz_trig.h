@@ -13,6 +13,8 @@
 #ifndef SHZ_TRIG_H
 #define SHZ_TRIG_H
 
+#include <stddef.h>
+
 #include "shz_scalar.h"
 
 /*! \defgroup trig Trigonometry
@@ -21,6 +23,9 @@
     The following API provides a series of routines implementing trigonometric
     functions. While some of these are specialized, many are meant to be
     drop-in replacements for the equivalent functions provided by <math.h>.
+
+    The inverse and hyperbolic routines trade accuracy for speed according to
+    the precision tier chosen with \ref SHZ_PRECISION.
 */
 
 //! Single-precision floating-point PI approximation (do not use M_PI!)
@@ -88,6 +93,41 @@ SHZ_INLINE float shz_sincos_cotf(shz_sincos_t sincos) SHZ_NOEXCEPT;
 
 //! @}
 
+/*! \name  Sin/Cos Arrays
+    \brief Routines computing sine + cosine pairs for arrays of angles.
+
+    These routines evaluate a whole array of angles at once, writing the
+    results to separate sine and cosine output arrays. They are considerably
+    faster than calling shz_sincosf() in a loop when there are more than a
+    handful of angles to process.
+
+    - On SH4, the `FSCA` instructions for consecutive angles are interleaved,
+      so their latencies overlap, with the same accuracy as shz_sincosf()
+      (\ref SHZ_FSCA_ERROR_MAX at best, with the angle truncated to 1/65536th
+      of a revolution).
+    - On other back-ends, a branchless range-reduced polynomial is used, which
+      compilers can vectorize. It has a maximum absolute error of about 1.1e-7
+      for every 16-bit angle, for degrees, and for radians within +/- 10,000,
+      beyond which the radian reduction slowly loses precision.
+
+    For the floating-point variants, either output array may alias the
+    input array, provided it does so exactly. The outputs of
+    shz_sincosu16_array() must not overlap its input.
+
+    @{
+*/
+
+//! Computes \p count sine and cosine pairs for the given array of unsigned 16-bit angles, where 65536 is a full revolution.
+void shz_sincosu16_array(float* sins, float* coss, const uint16_t* radians16, size_t count) SHZ_NOEXCEPT;
+
+//! Computes \p count sine and cosine pairs for the given array of floating-point angles in radians.
+void shz_sincosf_array(float* sins, float* coss, const float* radians, size_t count) SHZ_NOEXCEPT;
+
+//! Computes \p count sine and cosine pairs for the given array of floating-point angles in degrees.
+void shz_sincosf_deg_array(float* sins, float* coss, const float* degrees, size_t count) SHZ_NOEXCEPT;
+
+//! @}
+
 /*! \name  Independent Functions
     \brief Routines providing single trigonometric functions.
     @{
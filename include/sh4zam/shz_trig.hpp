@@ -15,6 +15,7 @@
 #include <tuple>
 #include <utility>
 
+#include "shz_cdefs.hpp"
 #include "shz_trig.h"
 
 namespace shz {
@@ -100,6 +101,12 @@ namespace shz {
     constexpr auto sincos_cscf = shz_sincos_cscf;
     //! C++ wrapper around shz_sincos_cotf().
     constexpr auto sincos_cotf = shz_sincos_cotf;
+    //! C++ wrapper around shz_sincosu16_array().
+    constexpr auto sincosu16_array   = shz_sincosu16_array;
+    //! C++ wrapper around shz_sincosf_array().
+    constexpr auto sincosf_array     = shz_sincosf_array;
+    //! C++ wrapper around shz_sincosf_deg_array().
+    constexpr auto sincosf_deg_array = shz_sincosf_deg_array;
 
     //! @}
 
@@ -201,6 +208,40 @@ namespace shz {
     SHZ_FORCE_INLINE float acothf(float x) noexcept { return shz_acothf(x); }
 
     //! @}
+
+    //! Inverse trig and hyperbolic routines with an explicit precision tier.
+    namespace approx {
+        //! Tiered version of shz_atanf().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float atanf(float x) noexcept { return shz_atanf_tier(x, static_cast<int>(P)); }
+        //! Tiered version of shz_atan2f().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float atan2f(float y, float x) noexcept { return shz_atan2f_tier(y, x, static_cast<int>(P)); }
+        //! Tiered version of shz_asinf().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float asinf(float x) noexcept { return shz_asinf_tier(x, static_cast<int>(P)); }
+        //! Tiered version of shz_acosf().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float acosf(float x) noexcept { return shz_acosf_tier(x, static_cast<int>(P)); }
+        //! Tiered version of shz_sinhf().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float sinhf(float x) noexcept { return shz_sinhf_tier(x, static_cast<int>(P)); }
+        //! Tiered version of shz_coshf().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float coshf(float x) noexcept { return shz_coshf_tier(x, static_cast<int>(P)); }
+        //! Tiered version of shz_tanhf().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float tanhf(float x) noexcept { return shz_tanhf_tier(x, static_cast<int>(P)); }
+        //! Tiered version of shz_asinhf().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float asinhf(float x) noexcept { return shz_asinhf_tier(x, static_cast<int>(P)); }
+        //! Tiered version of shz_acoshf().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float acoshf(float x) noexcept { return shz_acoshf_tier(x, static_cast<int>(P)); }
+        //! Tiered version of shz_atanhf().
+        template<precision P = default_precision>
+        SHZ_FORCE_INLINE float atanhf(float x) noexcept { return shz_atanhf_tier(x, static_cast<int>(P)); }
+    }
 }
 
 #endif
\ No newline at end of file
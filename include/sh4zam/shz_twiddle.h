@@ -0,0 +1,116 @@
+/*! \file
+    \brief Routines for twiddling textures.
+    \ingroup twiddle
+
+    This file contains the public interface for encoding and decoding
+    Morton codes, as well as for converting whole textures between linear
+    and twiddled layouts.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#ifndef SHZ_TWIDDLE_H
+#define SHZ_TWIDDLE_H
+
+#include "shz_mem.h"
+
+/*! \defgroup twiddle Twiddle
+    \brief    Morton-order texture layouts.
+
+    The PVR samples most textures in "twiddled" order, where texels are
+    stored along a Z-shaped Morton curve, rather than row by row, keeping
+    neighboring texels nearby in memory. The Morton code of a texel
+    interleaves the bits of its coordinates, with Y occupying the even
+    bits and X occupying the odd bits.
+
+    Rectangular textures are twiddled as a row or column of square blocks,
+    each the size of the smaller dimension, and each twiddled on its own.
+
+    Every texture routine converts a whole texture at once, two rows of
+    texels at a time, and writes its twiddled texels in 32-byte chunks.
+    Texture dimensions must be powers of two which are at least 8 texels,
+    as with the PVR itself.
+*/
+
+SHZ_DECLS_BEGIN
+
+/*! \name  Morton Codes
+    \brief Routines for interleaving coordinates.
+    @{
+*/
+
+//! Spreads the lower 16 bits of \p v out into the even bits of the result.
+SHZ_INLINE uint32_t shz_morton_spread(uint32_t v) SHZ_NOEXCEPT;
+
+//! Compacts the even bits of \p v into the lower 16 bits of the result, the inverse of shz_morton_spread().
+SHZ_INLINE uint32_t shz_morton_compact(uint32_t v) SHZ_NOEXCEPT;
+
+//! Returns the Morton code of the given coordinates, each of which must be less than 65536.
+SHZ_INLINE uint32_t shz_morton_encode(uint32_t x, uint32_t y) SHZ_NOEXCEPT;
+
+//! Returns the X coordinate encoded within the given Morton code.
+SHZ_INLINE uint32_t shz_morton_decode_x(uint32_t code) SHZ_NOEXCEPT;
+
+//! Returns the Y coordinate encoded within the given Morton code.
+SHZ_INLINE uint32_t shz_morton_decode_y(uint32_t code) SHZ_NOEXCEPT;
+
+/*! Returns the index of the texel at the given coordinates within a twiddled \p width by \p height texture.
+
+    Unlike shz_morton_encode(), this also handles rectangular textures.
+*/
+SHZ_INLINE uint32_t shz_twiddle_index(uint32_t x, uint32_t y, uint32_t width, uint32_t height) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Textures
+    \brief Routines for converting textures between linear and twiddled layouts.
+
+    Each routine converts a \p width by \p height texture from \p src into
+    \p dst, which must not overlap. Twiddling streams its output through
+    shz_memcpy32(), so \p dst must be 32-byte aligned, while the linear
+    \p src must be 4-byte aligned. Untwiddling reads whole 32-byte chunks
+    from \p src, which must be 8-byte aligned.
+
+    \note
+    Twiddled output should be written to RAM, then uploaded to VRAM, such
+    as with DMA or the Store Queues.
+    @{
+*/
+
+/*! Twiddles a 4bpp paletted texture.
+
+    Two texels are packed into each byte, with the first texel occupying
+    the lower nibble.
+*/
+void shz_twiddle4(uint8_t* dst, const uint8_t* src, size_t width, size_t height) SHZ_NOEXCEPT;
+
+//! Twiddles an 8bpp paletted texture.
+void shz_twiddle8(uint8_t* dst, const uint8_t* src, size_t width, size_t height) SHZ_NOEXCEPT;
+
+//! Twiddles a 16bpp texture, such as RGB565, ARGB1555, ARGB4444, or YUV422.
+void shz_twiddle16(uint16_t* dst, const uint16_t* src, size_t width, size_t height) SHZ_NOEXCEPT;
+
+//! Twiddles a 32bpp texture.
+void shz_twiddle32(uint32_t* dst, const uint32_t* src, size_t width, size_t height) SHZ_NOEXCEPT;
+
+//! Untwiddles a 4bpp paletted texture, the inverse of shz_twiddle4().
+void shz_untwiddle4(uint8_t* dst, const uint8_t* src, size_t width, size_t height) SHZ_NOEXCEPT;
+
+//! Untwiddles an 8bpp paletted texture, the inverse of shz_twiddle8().
+void shz_untwiddle8(uint8_t* dst, const uint8_t* src, size_t width, size_t height) SHZ_NOEXCEPT;
+
+//! Untwiddles a 16bpp texture, the inverse of shz_twiddle16().
+void shz_untwiddle16(uint16_t* dst, const uint16_t* src, size_t width, size_t height) SHZ_NOEXCEPT;
+
+//! Untwiddles a 32bpp texture, the inverse of shz_twiddle32().
+void shz_untwiddle32(uint32_t* dst, const uint32_t* src, size_t width, size_t height) SHZ_NOEXCEPT;
+
+//! @}
+
+#include "inline/shz_twiddle.inl.h"
+
+SHZ_DECLS_END
+
+#endif // SHZ_TWIDDLE_H
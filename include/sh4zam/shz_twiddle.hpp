@@ -0,0 +1,107 @@
+/*! \file
+    \brief   C++ routines for twiddling textures.
+    \ingroup twiddle
+
+    This file provides a C++ binding layer over the C API provided by
+    shz_twiddle.h, overloading the texture routines on their texel types.
+
+    \author    2026 Falco Girgis
+    \copyright MIT License
+*/
+
+#ifndef SHZ_TWIDDLE_HPP
+#define SHZ_TWIDDLE_HPP
+
+#include "shz_twiddle.h"
+
+namespace shz {
+
+    /*! \name  Morton Codes
+        \brief Routines for interleaving coordinates.
+        @{
+    */
+
+    //! C++ wrapper around shz_morton_spread().
+    SHZ_FORCE_INLINE uint32_t morton_spread(uint32_t v) noexcept {
+        return shz_morton_spread(v);
+    }
+
+    //! C++ wrapper around shz_morton_compact().
+    SHZ_FORCE_INLINE uint32_t morton_compact(uint32_t v) noexcept {
+        return shz_morton_compact(v);
+    }
+
+    //! C++ wrapper around shz_morton_encode().
+    SHZ_FORCE_INLINE uint32_t morton_encode(uint32_t x, uint32_t y) noexcept {
+        return shz_morton_encode(x, y);
+    }
+
+    //! C++ wrapper around shz_morton_decode_x().
+    SHZ_FORCE_INLINE uint32_t morton_decode_x(uint32_t code) noexcept {
+        return shz_morton_decode_x(code);
+    }
+
+    //! C++ wrapper around shz_morton_decode_y().
+    SHZ_FORCE_INLINE uint32_t morton_decode_y(uint32_t code) noexcept {
+        return shz_morton_decode_y(code);
+    }
+
+    //! C++ wrapper around shz_twiddle_index().
+    SHZ_FORCE_INLINE uint32_t twiddle_index(uint32_t x, uint32_t y, uint32_t width, uint32_t height) noexcept {
+        return shz_twiddle_index(x, y, width, height);
+    }
+
+    //! @}
+
+    /*! \name  Textures
+        \brief Routines for converting textures between linear and twiddled layouts.
+
+        4bpp textures share their texel type with 8bpp textures, so they
+        keep their own names rather than overloading.
+        @{
+    */
+
+    //! C++ wrapper around shz_twiddle4().
+    SHZ_FORCE_INLINE void twiddle4(uint8_t* dst, const uint8_t* src, size_t width, size_t height) noexcept {
+        shz_twiddle4(dst, src, width, height);
+    }
+
+    //! C++ wrapper around shz_twiddle8().
+    SHZ_FORCE_INLINE void twiddle(uint8_t* dst, const uint8_t* src, size_t width, size_t height) noexcept {
+        shz_twiddle8(dst, src, width, height);
+    }
+
+    //! C++ wrapper around shz_twiddle16().
+    SHZ_FORCE_INLINE void twiddle(uint16_t* dst, const uint16_t* src, size_t width, size_t height) noexcept {
+        shz_twiddle16(dst, src, width, height);
+    }
+
+    //! C++ wrapper around shz_twiddle32().
+    SHZ_FORCE_INLINE void twiddle(uint32_t* dst, const uint32_t* src, size_t width, size_t height) noexcept {
+        shz_twiddle32(dst, src, width, height);
+    }
+
+    //! C++ wrapper around shz_untwiddle4().
+    SHZ_FORCE_INLINE void untwiddle4(uint8_t* dst, const uint8_t* src, size_t width, size_t height) noexcept {
+        shz_untwiddle4(dst, src, width, height);
+    }
+
+    //! C++ wrapper around shz_untwiddle8().
+    SHZ_FORCE_INLINE void untwiddle(uint8_t* dst, const uint8_t* src, size_t width, size_t height) noexcept {
+        shz_untwiddle8(dst, src, width, height);
+    }
+
+    //! C++ wrapper around shz_untwiddle16().
+    SHZ_FORCE_INLINE void untwiddle(uint16_t* dst, const uint16_t* src, size_t width, size_t height) noexcept {
+        shz_untwiddle16(dst, src, width, height);
+    }
+
+    //! C++ wrapper around shz_untwiddle32().
+    SHZ_FORCE_INLINE void untwiddle(uint32_t* dst, const uint32_t* src, size_t width, size_t height) noexcept {
+        shz_untwiddle32(dst, src, width, height);
+    }
+
+    //! @}
+}
+
+#endif
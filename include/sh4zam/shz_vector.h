@@ -16,6 +16,7 @@
 
 #include <math.h>
 #include <float.h>
+#include <stddef.h>
 
 #include "shz_scalar.h"
 #include "shz_trig.h"
@@ -104,6 +105,23 @@ typedef struct shz_vec4 {
 //! Alternate typedef for the shz_vec4 struct for those who hate POSIX-style.
 typedef shz_vec4_t shz_vec4;
 
+/*! 3D Vector stream type
+ *
+ *  Structure-of-arrays representation of a stream of 3-dimensional vectors,
+ *  where each component is held within its own contiguous array.
+ *
+ *  \sa shz_vec3_t, shz_vec3_soa_init()
+ */
+typedef struct shz_vec3_soa {
+    float* x;     //!< Array of X coordinates
+    float* y;     //!< Array of Y coordinates
+    float* z;     //!< Array of Z coordinates
+    size_t count; //!< Number of vectors within the stream
+} shz_vec3_soa_t;
+
+//! Alternate typedef for the shz_vec3_soa struct for those who hate POSIX-style.
+typedef shz_vec3_soa_t shz_vec3_soa;
+
 /*! \name  Initializers
     \brief Component-based initialization routines.
     @{
@@ -666,6 +684,55 @@ SHZ_INLINE shz_vec4_t shz_vec3_vec4(shz_vec3_t vec, float w) SHZ_NOEXCEPT;
 
  //! @}
 
+/*! \name  Structure-of-Arrays Streams
+    \brief Bulk routines operating on entire streams of 3D vectors.
+
+    Each routine processes as many vectors as are held within its first source
+    stream, so destinations must be at least as large. A destination may be the
+    same stream as one of its sources for operating in-place, but must not
+    otherwise overlap with it.
+
+    \note
+    These routines are out-of-line, so they are intended for processing large
+    numbers of entities at once rather than a handful of vectors.
+    @{
+*/
+
+//! Returns a 3D vector stream over the given component arrays, each holding \p count elements.
+SHZ_INLINE shz_vec3_soa_t shz_vec3_soa_init(float* x, float* y, float* z, size_t count) SHZ_NOEXCEPT;
+
+//! Transposes the array of 3D vectors, \p src, into the stream, \p dst, filling all of its elements.
+void shz_vec3_soa_from_aos(const shz_vec3_soa_t* dst, const shz_vec3_t* src) SHZ_NOEXCEPT;
+
+//! Transposes each element within the stream, \p src, into the array of 3D vectors, \p dst.
+void shz_vec3_soa_to_aos(shz_vec3_t* dst, const shz_vec3_soa_t* src) SHZ_NOEXCEPT;
+
+//! Stores the sum of each element within \p a and its corresponding element within \p b in \p dst.
+void shz_vec3_soa_add(const shz_vec3_soa_t* dst, const shz_vec3_soa_t* a, const shz_vec3_soa_t* b) SHZ_NOEXCEPT;
+
+//! Stores the difference of each element within \p a and its corresponding element within \p b in \p dst.
+void shz_vec3_soa_sub(const shz_vec3_soa_t* dst, const shz_vec3_soa_t* a, const shz_vec3_soa_t* b) SHZ_NOEXCEPT;
+
+//! Stores each element within \p src scaled by \p factor in \p dst.
+void shz_vec3_soa_scale(const shz_vec3_soa_t* dst, const shz_vec3_soa_t* src, float factor) SHZ_NOEXCEPT;
+
+//! Stores the dot product of each element within \p a and its corresponding element within \p b in the array, \p dst.
+void shz_vec3_soa_dot(float* dst, const shz_vec3_soa_t* a, const shz_vec3_soa_t* b) SHZ_NOEXCEPT;
+
+//! Stores the cross product of each element within \p a and its corresponding element within \p b in \p dst.
+void shz_vec3_soa_cross(const shz_vec3_soa_t* dst, const shz_vec3_soa_t* a, const shz_vec3_soa_t* b) SHZ_NOEXCEPT;
+
+//! Stores the unit vector of each element within \p src in \p dst.
+void shz_vec3_soa_normalize(const shz_vec3_soa_t* dst, const shz_vec3_soa_t* src) SHZ_NOEXCEPT;
+
+//! Stores the linear interpolation by \p t between each element within \p a and its corresponding element within \p b in \p dst.
+void shz_vec3_soa_lerp(const shz_vec3_soa_t* dst, const shz_vec3_soa_t* a, const shz_vec3_soa_t* b, float t) SHZ_NOEXCEPT;
+
+//! Stores the distance between each element within \p a and its corresponding element within \p b in the array, \p dst.
+void shz_vec3_soa_distance(float* dst, const shz_vec3_soa_t* a, const shz_vec3_soa_t* b) SHZ_NOEXCEPT;
+
+//! @}
+
 SHZ_DECLS_END
 
 /*! \name Adapters
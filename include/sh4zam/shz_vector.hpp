@@ -632,6 +632,88 @@ struct vec4: vecN<vec4, shz_vec4_t, 4> {
 //! C++ alias for vec4 for those who like POSIX-style.s
 using vec4_t = vec4;
 
+/*! 3D Vector stream type
+
+    C++ structure for representing a structure-of-arrays stream of
+    3-dimensional vectors, whose routines operate on the entire stream.
+
+    Routines producing a stream store their results within the stream
+    they're called on, while routines producing scalars or vectors read
+    from the stream they're called on.
+
+    \sa shz_vec3_soa_t, shz::vec3
+*/
+struct vec3_soa: shz_vec3_soa_t {
+    //! Default constructor: does nothing.
+    vec3_soa() = default;
+
+    //! C Constructor: initializes a C++ shz::vec3_soa from a C shz_vec3_soa_t.
+    SHZ_FORCE_INLINE vec3_soa(const shz_vec3_soa_t& other) noexcept:
+        shz_vec3_soa_t(other) {}
+
+    //! Value constructor: initializes the stream over the given component arrays.
+    SHZ_FORCE_INLINE vec3_soa(float* x, float* y, float* z, size_t count) noexcept:
+        shz_vec3_soa_t(shz_vec3_soa_init(x, y, z, count)) {}
+
+    //! C++ wrapper around shz_vec3_soa_from_aos().
+    SHZ_FORCE_INLINE void from_aos(const shz_vec3_t* src) const noexcept {
+        shz_vec3_soa_from_aos(this, src);
+    }
+
+    //! C++ wrapper around shz_vec3_soa_to_aos().
+    SHZ_FORCE_INLINE void to_aos(shz_vec3_t* dst) const noexcept {
+        shz_vec3_soa_to_aos(dst, this);
+    }
+
+    //! C++ wrapper around shz_vec3_soa_add().
+    SHZ_FORCE_INLINE void add(const shz_vec3_soa_t& a, const shz_vec3_soa_t& b) const noexcept {
+        shz_vec3_soa_add(this, &a, &b);
+    }
+
+    //! C++ wrapper around shz_vec3_soa_sub().
+    SHZ_FORCE_INLINE void sub(const shz_vec3_soa_t& a, const shz_vec3_soa_t& b) const noexcept {
+        shz_vec3_soa_sub(this, &a, &b);
+    }
+
+    //! C++ wrapper around shz_vec3_soa_scale().
+    SHZ_FORCE_INLINE void scale(const shz_vec3_soa_t& src, float factor) const noexcept {
+        shz_vec3_soa_scale(this, &src, factor);
+    }
+
+    //! C++ wrapper around shz_vec3_soa_dot().
+    SHZ_FORCE_INLINE void dot(float* dst, const shz_vec3_soa_t& other) const noexcept {
+        shz_vec3_soa_dot(dst, this, &other);
+    }
+
+    //! C++ wrapper around shz_vec3_soa_cross().
+    SHZ_FORCE_INLINE void cross(const shz_vec3_soa_t& a, const shz_vec3_soa_t& b) const noexcept {
+        shz_vec3_soa_cross(this, &a, &b);
+    }
+
+    //! C++ wrapper around shz_vec3_soa_normalize().
+    SHZ_FORCE_INLINE void normalize(const shz_vec3_soa_t& src) const noexcept {
+        shz_vec3_soa_normalize(this, &src);
+    }
+
+    //! C++ wrapper around shz_vec3_soa_lerp().
+    SHZ_FORCE_INLINE void lerp(const shz_vec3_soa_t& a, const shz_vec3_soa_t& b, float t) const noexcept {
+        shz_vec3_soa_lerp(this, &a, &b, t);
+    }
+
+    //! C++ wrapper around shz_vec3_soa_distance().
+    SHZ_FORCE_INLINE void distance(float* dst, const shz_vec3_soa_t& other) const noexcept {
+        shz_vec3_soa_distance(dst, this, &other);
+    }
+
+    //! Returns the element at the given \p index as a C++ 3D vector.
+    SHZ_FORCE_INLINE vec3 operator[](size_t index) const noexcept {
+        return shz_vec3_init(x[index], y[index], z[index]);
+    }
+};
+
+//! C++ alias for vec3_soa for those who like POSIX-style.
+using vec3_soa_t = vec3_soa;
+
 template<typename CRTP, typename C, size_t R>
 SHZ_FORCE_INLINE vec2 vecN<CRTP, C, R>::dot(CppType v1, CppType v2) const noexcept {
     return shz_vec_dot2(*static_cast<const CRTP*>(this), v1, v2);
@@ -51,6 +51,12 @@
     Unless TLS has been disabled, the XMTRX API is thread-safe, with each thread
     getting its own unique copy of XMTRX.
 
+    \note
+    On the SW-based back-ends, every implicit XMTRX routine must first resolve
+    the calling thread's XMTRX state, which can be expensive with the pthread
+    or C11 TLS models. Hot loops should acquire a shz_xmtrx_ctx_t handle once
+    with shz_xmtrx_ctx_acquire() and use the `shz_xmtrx_ctx_` routines instead.
+
     \sa matrix
  */
 
@@ -64,6 +70,20 @@ SHZ_DECLARE_STRUCT        (shz_mat4x3, shz_mat4x3_t);
 SHZ_DECLARE_STRUCT        (shz_mat3x4, shz_mat3x4_t);
 /*! \endcond */
 
+/*! Opaque handle to the calling thread's XMTRX.
+
+    Obtained from shz_xmtrx_ctx_acquire(), a context handle allows for the
+    thread-local XMTRX state to be resolved once, then passed explicitly to
+    each subsequent `shz_xmtrx_ctx_` routine.
+
+    \warning
+    A context handle belongs to the thread which acquired it and must not be
+    shared with or used from any other thread.
+
+    \sa shz_xmtrx_ctx_acquire()
+*/
+SHZ_DECLARE_STRUCT(shz_xmtrx_ctx, shz_xmtrx_ctx_t);
+
 //! Registers comprising XMTRX, in the FPU back-bank.
 typedef enum shz_xmtrx_reg {
     SHZ_XMTRX_XF0,  //!< FP register `xf0`.
@@ -84,6 +104,21 @@ typedef enum shz_xmtrx_reg {
     SHZ_XMTRX_XF15  //!< FP register `xf15`.
 } shz_xmtrx_reg_t, shz_xmtrx_reg;
 
+/*! Mapping from normalized device coordinates onto the screen.
+
+    Applied to X and Y after the perspective divide by
+    shz_xmtrx_project_point3_array().
+
+    \sa shz_viewport_init()
+*/
+typedef struct shz_viewport {
+    shz_vec2_t scale;   //!< Scale applied to X and Y after dividing by W.
+    shz_vec2_t offset;  //!< Offset added to X and Y after scaling.
+} shz_viewport_t;
+
+//! Alternate shz_viewport_t C typedef for those who hate POSIX style.
+typedef shz_viewport_t shz_viewport;
+
 /*! \name  Accessors
     \brief Setting and retrieving individual XMTRX register values.
     @{
@@ -713,6 +748,118 @@ SHZ_INLINE shz_vec3_t shz_xmtrx_transform_point3(shz_vec3_t pt) SHZ_NOEXCEPT;
 
 //! @}
 
+/*! \name  Batched Transformations
+    \brief Transforming arrays of vectors and points against XMTRX.
+
+    These routines transform \p count elements from \p src, storing the results
+    within \p dst, where \p stride is the distance in bytes between consecutive
+    elements of both arrays. A \p stride of 0 denotes a tightly packed array.
+
+    Since the stride is arbitrary, the elements may be embedded within larger
+    interleaved vertex structures, such as the position of a `pvr_vertex_t`,
+    and \p dst may be equal to \p src for transforming them in-place.
+
+    \note
+    The SH4 implementations are software-pipelined, transforming one element
+    while loading the next and storing the previous, and prefetch ahead.
+
+    \warning
+    Element pointers need only be 4-byte aligned, but \p dst and \p src must
+    either be equal or not overlap.
+    @{
+*/
+
+//! Transforms \p count 4D vectors from \p src by XMTRX, storing the results in \p dst.
+SHZ_INLINE void shz_xmtrx_transform_vec4_array(shz_vec4_t* dst, const shz_vec4_t* src, size_t count, size_t stride) SHZ_NOEXCEPT;
+
+//! Transforms \p count 3D vectors from \p src by XMTRX (implicit W of 0.0f), storing the results in \p dst.
+SHZ_INLINE void shz_xmtrx_transform_vec3_array(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride) SHZ_NOEXCEPT;
+
+//! Transforms \p count 3D points from \p src by XMTRX (implicit W of 1.0f), storing the results in \p dst.
+SHZ_INLINE void shz_xmtrx_transform_point3_array(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride) SHZ_NOEXCEPT;
+
+//! Returns the viewport mapping NDC onto the rectangle at \p x, \p y of the given dimensions, with Y pointing down, as with shz_xmtrx_init_screen().
+SHZ_INLINE shz_viewport_t shz_viewport_init(float x, float y, float width, float height) SHZ_NOEXCEPT;
+
+/*! Transforms \p count 3D points from \p src by XMTRX, then projects them onto \p viewport, storing the results in \p dst.
+
+    Each point is transformed with an implicit W of 1.0f, has its X and Y
+    divided by the resulting W then mapped onto the viewport, and has its
+    Z replaced with 1/W, as is expected for depth by the PVR:
+
+        dst = <x / w * scale.x + offset.x, y / w * scale.y + offset.y, 1 / w>
+
+    This fuses the transform, perspective divide, and viewport mapping
+    into a single pass, such as over the positions of `pvr_vertex_t`s.
+
+    \note
+    The SH4 implementation overlaps each element's `FSRRA` with the `FTRV`
+    of the next one.
+
+    \warning
+    W must be positive, as it is for points in front of the near plane, so
+    anything straddling it should be clipped beforehand.
+
+    \sa shz_clip_outcodes()
+*/
+SHZ_INLINE void shz_xmtrx_project_point3_array(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride, const shz_viewport_t* viewport) SHZ_NOEXCEPT;
+
+//! @}
+
+/*! \name  Explicit Context
+    \brief Routines operating on an explicitly passed XMTRX context handle.
+
+    These routines are equivalent to their implicit counterparts, except that
+    they operate on the XMTRX referenced by \p ctx rather than looking up the
+    calling thread's XMTRX upon every call.
+
+    \note
+    On the SH4 back-end XMTRX lives within FPU registers, so the handle carries
+    no state, and these routines are identical to their implicit counterparts.
+    @{
+*/
+
+/*! Returns a handle to the calling thread's XMTRX.
+
+    Resolving the thread-local XMTRX state is performed only once here, so the
+    returned handle should be cached for the duration of a batch of operations.
+
+    \note
+    On the SH4 back-end, the returned handle is NULL, but is still valid to
+    pass to the other `shz_xmtrx_ctx_` routines.
+*/
+SHZ_INLINE shz_xmtrx_ctx_t* shz_xmtrx_ctx_acquire(void) SHZ_NOEXCEPT;
+
+//! Equivalent to shz_xmtrx_load_4x4(), operating on the XMTRX referenced by \p ctx.
+SHZ_INLINE void shz_xmtrx_ctx_load_4x4(shz_xmtrx_ctx_t* ctx, const shz_mat4x4_t* matrix) SHZ_NOEXCEPT;
+
+//! Equivalent to shz_xmtrx_store_4x4(), operating on the XMTRX referenced by \p ctx.
+SHZ_INLINE void shz_xmtrx_ctx_store_4x4(shz_xmtrx_ctx_t* ctx, shz_mat4x4_t* matrix) SHZ_NOEXCEPT;
+
+//! Equivalent to shz_xmtrx_apply_4x4(), operating on the XMTRX referenced by \p ctx.
+SHZ_INLINE void shz_xmtrx_ctx_apply_4x4(shz_xmtrx_ctx_t* ctx, const shz_mat4x4_t* matrix) SHZ_NOEXCEPT;
+
+//! Equivalent to shz_xmtrx_load_apply_4x4(), operating on the XMTRX referenced by \p ctx.
+SHZ_INLINE void shz_xmtrx_ctx_load_apply_4x4(shz_xmtrx_ctx_t* ctx,
+                                             const shz_mat4x4_t* matrix1,
+                                             const shz_mat4x4_t* matrix2) SHZ_NOEXCEPT;
+
+//! Equivalent to shz_xmtrx_apply_store_4x4(), operating on the XMTRX referenced by \p ctx.
+SHZ_INLINE void shz_xmtrx_ctx_apply_store_4x4(shz_xmtrx_ctx_t* ctx,
+                                              shz_mat4x4_t* out,
+                                              const shz_mat4x4_t* in) SHZ_NOEXCEPT;
+
+//! Equivalent to shz_xmtrx_transform_vec4(), operating on the XMTRX referenced by \p ctx.
+SHZ_INLINE shz_vec4_t shz_xmtrx_ctx_transform_vec4(shz_xmtrx_ctx_t* ctx, shz_vec4_t vec) SHZ_NOEXCEPT;
+
+//! Equivalent to shz_xmtrx_transform_vec3(), operating on the XMTRX referenced by \p ctx.
+SHZ_INLINE shz_vec3_t shz_xmtrx_ctx_transform_vec3(shz_xmtrx_ctx_t* ctx, shz_vec3_t vec) SHZ_NOEXCEPT;
+
+//! Equivalent to shz_xmtrx_transform_point3(), operating on the XMTRX referenced by \p ctx.
+SHZ_INLINE shz_vec3_t shz_xmtrx_ctx_transform_point3(shz_xmtrx_ctx_t* ctx, shz_vec3_t pt) SHZ_NOEXCEPT;
+
+//! @}
+
 /*! \name  Setters
     \brief Sets the values of related XMTRX components.
     @{
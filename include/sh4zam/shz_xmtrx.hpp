@@ -675,6 +675,33 @@ struct xmtrx {
 
 //! @}
 
+/*! \name  Batched Transformations
+    \brief Transforming arrays of vectors and points against XMTRX.
+    @{
+*/
+
+    //! C++ wrapper around shz_xmtrx_transform_vec4_array().
+    SHZ_FORCE_INLINE static void transform(shz_vec4_t* dst, const shz_vec4_t* src, size_t count, size_t stride=0) noexcept {
+        shz_xmtrx_transform_vec4_array(dst, src, count, stride);
+    }
+
+    //! C++ wrapper around shz_xmtrx_transform_vec3_array().
+    SHZ_FORCE_INLINE static void transform(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride=0) noexcept {
+        shz_xmtrx_transform_vec3_array(dst, src, count, stride);
+    }
+
+    //! C++ wrapper around shz_xmtrx_transform_point3_array().
+    SHZ_FORCE_INLINE static void transform_point(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride=0) noexcept {
+        shz_xmtrx_transform_point3_array(dst, src, count, stride);
+    }
+
+    //! C++ wrapper around shz_xmtrx_project_point3_array().
+    SHZ_FORCE_INLINE static void project_point(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, const shz_viewport_t& viewport, size_t stride=0) noexcept {
+        shz_xmtrx_project_point3_array(dst, src, count, stride, &viewport);
+    }
+
+//! @}
+
 /*! \name  Setters
     \brief Sets the values of related XMTRX components.
     @{
@@ -757,6 +784,76 @@ struct xmtrx {
 //! @}
 
 };
+
+/*! Handle to the calling thread's XMTRX, for passing it explicitly.
+
+    This structure provides the C++ bindings to the explicit context XMTRX
+    API, resolving the calling thread's XMTRX state once upon construction,
+    rather than upon every operation, as the static members of shz::xmtrx do.
+
+    \warning
+    An xmtrx_ctx must not be shared with or used from any other thread than
+    the one which constructed it.
+
+    \sa shz::xmtrx, shz_xmtrx_ctx_t
+*/
+struct xmtrx_ctx {
+    shz_xmtrx_ctx_t* handle; //!< C context handle being wrapped.
+
+    //! Acquires a handle to the calling thread's XMTRX, via shz_xmtrx_ctx_acquire().
+    SHZ_FORCE_INLINE xmtrx_ctx() noexcept:
+        handle(shz_xmtrx_ctx_acquire()) {}
+
+    //! Wraps an existing C context handle.
+    SHZ_FORCE_INLINE explicit xmtrx_ctx(shz_xmtrx_ctx_t* ctx) noexcept:
+        handle(ctx) {}
+
+    //! Implicitly converts to the underlying C context handle.
+    SHZ_FORCE_INLINE operator shz_xmtrx_ctx_t*() const noexcept {
+        return handle;
+    }
+
+    //! C++ wrapper around shz_xmtrx_ctx_load_4x4().
+    SHZ_FORCE_INLINE void load(const shz_mat4x4_t& mat4) const noexcept {
+        shz_xmtrx_ctx_load_4x4(handle, &mat4);
+    }
+
+    //! C++ wrapper around shz_xmtrx_ctx_store_4x4().
+    SHZ_FORCE_INLINE void store(shz_mat4x4_t* mat4) const noexcept {
+        shz_xmtrx_ctx_store_4x4(handle, mat4);
+    }
+
+    //! C++ wrapper around shz_xmtrx_ctx_apply_4x4().
+    SHZ_FORCE_INLINE void apply(const shz_mat4x4_t& mat4) const noexcept {
+        shz_xmtrx_ctx_apply_4x4(handle, &mat4);
+    }
+
+    //! C++ wrapper around shz_xmtrx_ctx_load_apply_4x4().
+    SHZ_FORCE_INLINE void load_apply(const shz_mat4x4_t& mat1, const shz_mat4x4_t& mat2) const noexcept {
+        shz_xmtrx_ctx_load_apply_4x4(handle, &mat1, &mat2);
+    }
+
+    //! C++ wrapper around shz_xmtrx_ctx_apply_store_4x4().
+    SHZ_FORCE_INLINE void apply_store(shz_mat4x4_t* out, const shz_mat4x4_t& in) const noexcept {
+        shz_xmtrx_ctx_apply_store_4x4(handle, out, &in);
+    }
+
+    //! C++ wrapper around shz_xmtrx_ctx_transform_vec4().
+    SHZ_FORCE_INLINE vec4 transform(shz_vec4_t in) const noexcept {
+        return shz_xmtrx_ctx_transform_vec4(handle, in);
+    }
+
+    //! C++ wrapper around shz_xmtrx_ctx_transform_vec3().
+    SHZ_FORCE_INLINE vec3 transform(shz_vec3_t in) const noexcept {
+        return shz_xmtrx_ctx_transform_vec3(handle, in);
+    }
+
+    //! C++ wrapper around shz_xmtrx_ctx_transform_point3().
+    SHZ_FORCE_INLINE vec3 transform_point(shz_vec3_t pt) const noexcept {
+        return shz_xmtrx_ctx_transform_point3(handle, pt);
+    }
+};
+
 }
 
 #endif
@@ -80,26 +80,40 @@ SHZ_INLINE void shz_xmtrx_update_fft_butterfly(float twiddle_angle) {
 /* ====================== N-POINT BUTTERFLY SPECIALIZATIONS =========================
    The following routines are specializations of the inner-most FFT loops, which perform
    the actual 2-pt butterfly operation, unrolled for N times into N-pt butterflies.
+
+   Each one is applied across every channel of a batch while the butterfly for a given
+   twiddle factor is resident within XMTRX, so it's only updated once per batch.
    ================================================================================== */
 
+// Returns a channel of the batch, from either its pointer array or contiguous storage.
+SHZ_FORCE_INLINE shz_complex_t* shz_fft_channel(shz_complex_t* const* channels, shz_complex_t* base,
+                                                size_t channel, size_t size) {
+    return channels? channels[channel] : base + channel * size;
+}
+
 // Apply all twiddle factors for the given stage with a 2-PT butterfly DIF.
-static void shz_fft_2pt(shz_complex_t* s, size_t size, size_t stage, float factor) {
+static void shz_fft_2pt(shz_complex_t* const* channels, shz_complex_t* base, size_t count,
+                        size_t size, size_t stage, float factor) {
     float angle = 0.0f;
 
     for(size_t twiddle = 0; twiddle < stage; ++twiddle) {
         shz_xmtrx_update_fft_butterfly(angle);
 
-        for(size_t i = twiddle; i < size; i += (stage << 1)) {
-           asm volatile(R"(
-                fmov.d  @%[x], dr4
-                fmov.d  @%[y], dr6
-                ftrv    xmtrx, fv4
-                fmov.d  dr4, @%[x]
-                fmov.d  dr6, @%[y]
-            )"
-            : "+m" (s[i]), "+m" (s[i + stage])
-            : [x] "r" (&s[i]), [y] "r" (&s[i + stage])
-            : "fr4", "fr5" ,"fr6", "fr7");
+        for(size_t ch = 0; ch < count; ++ch) {
+            shz_complex_t* s = shz_fft_channel(channels, base, ch, size);
+
+            for(size_t i = twiddle; i < size; i += (stage << 1)) {
+               asm volatile(R"(
+                    fmov.d  @%[x], dr4
+                    fmov.d  @%[y], dr6
+                    ftrv    xmtrx, fv4
+                    fmov.d  dr4, @%[x]
+                    fmov.d  dr6, @%[y]
+                )"
+                : "+m" (s[i]), "+m" (s[i + stage])
+                : [x] "r" (&s[i]), [y] "r" (&s[i + stage])
+                : "fr4", "fr5" ,"fr6", "fr7");
+            }
         }
         SHZ_FSCHG();
 
@@ -108,30 +122,35 @@ static void shz_fft_2pt(shz_complex_t* s, size_t size, size_t stage, float facto
 }
 
 // Apply all twiddle factors for the given stage with an unrolled 4-PT butterfly DIF.
-static void shz_fft_4pt(shz_complex_t* s, size_t size, size_t stage, float factor) {
+static void shz_fft_4pt(shz_complex_t* const* channels, shz_complex_t* base, size_t count,
+                        size_t size, size_t stage, float factor) {
     const size_t inc = (stage << 1);
     float angle = 0.0f;
 
     for(size_t twiddle = 0; twiddle < stage; ++twiddle) {
         shz_xmtrx_update_fft_butterfly(angle);
 
-        for(size_t i = twiddle; i < size; i += (inc << 1)) {
-            asm volatile(R"(
-                fmov.d  @%[x], dr4
-                fmov.d  @%[y], dr6
-                fmov.d  @%[z], dr8
-                fmov.d  @%[w], dr10
-                ftrv    xmtrx, fv4
-                ftrv    xmtrx, fv8
-                fmov.d  dr4, @%[x]
-                fmov.d  dr6, @%[y]
-                fmov.d  dr8, @%[z]
-                fmov.d  dr10, @%[w]
-            )"
-            : "+m" (s[i]), "+m" (s[i + stage]), "+m" (s[i + inc]), "+m" (s[i + inc + stage])
-            : [x] "r" (&s[i]), [y] "r" (&s[i + stage]),
-              [z] "r" (&s[i + inc]), [w] "r" (&s[i + inc + stage])
-            : "fr4", "fr5" ,"fr6", "fr7", "fr8", "fr9", "fr10", "fr11");
+        for(size_t ch = 0; ch < count; ++ch) {
+            shz_complex_t* s = shz_fft_channel(channels, base, ch, size);
+
+            for(size_t i = twiddle; i < size; i += (inc << 1)) {
+                asm volatile(R"(
+                    fmov.d  @%[x], dr4
+                    fmov.d  @%[y], dr6
+                    fmov.d  @%[z], dr8
+                    fmov.d  @%[w], dr10
+                    ftrv    xmtrx, fv4
+                    ftrv    xmtrx, fv8
+                    fmov.d  dr4, @%[x]
+                    fmov.d  dr6, @%[y]
+                    fmov.d  dr8, @%[z]
+                    fmov.d  dr10, @%[w]
+                )"
+                : "+m" (s[i]), "+m" (s[i + stage]), "+m" (s[i + inc]), "+m" (s[i + inc + stage])
+                : [x] "r" (&s[i]), [y] "r" (&s[i + stage]),
+                  [z] "r" (&s[i + inc]), [w] "r" (&s[i + inc + stage])
+                : "fr4", "fr5" ,"fr6", "fr7", "fr8", "fr9", "fr10", "fr11");
+            }
         }
         SHZ_FSCHG();
 
@@ -140,7 +159,8 @@ static void shz_fft_4pt(shz_complex_t* s, size_t size, size_t stage, float facto
 }
 
 // Apply all twiddle factors for the given stage with an unrolled 8-PT butterfly DIF.
-static void shz_fft_8pt(shz_complex_t* s, size_t size, size_t stage, float factor) {
+static void shz_fft_8pt(shz_complex_t* const* channels, shz_complex_t* base, size_t count,
+                        size_t size, size_t stage, float factor) {
     const size_t inc1   = (stage << 1);
     const size_t inc2   = (inc1  << 1);
 
@@ -149,43 +169,47 @@ static void shz_fft_8pt(shz_complex_t* s, size_t size, size_t stage, float facto
     for(size_t twiddle = 0; twiddle < stage; ++twiddle) {
         shz_xmtrx_update_fft_butterfly(angle);
 
-        for(size_t i = twiddle; i < size; i += (inc2 << 1)) {
-            asm volatile(R"(
-                fmov.d  @%[x], dr0
-                fmov.d  @%[y], dr2
-                fmov.d  @%[z], dr4
-                ftrv    xmtrx, fv0
-
-                fmov.d  @%[w], dr6
-                fmov.d  @%[a], dr8
-                fmov.d  @%[b], dr10
-                ftrv    xmtrx, fv4
-
-                fmov.d  dr0, @%[x]
-                fmov.d  dr2, @%[y]
-                fmov.d  @%[c], dr0
-                fmov.d  @%[d], dr2
-                ftrv    xmtrx, fv8
-
-                fmov.d  dr4, @%[z]
-                fmov.d  dr6, @%[w]
-                ftrv    xmtrx, fv0
-
-                fmov.d  dr8, @%[a]
-                fmov.d  dr10, @%[b]
-                fmov.d  dr0, @%[c]
-                fmov.d  dr2, @%[d]
-            )"
-            : "+m" (s[i]), "+m" (s[i + stage]),
-              "+m" (s[i + inc1]), "+m" (s[i + inc1 + stage]),
-              "+m" (s[i + inc2]), "+m" (s[i + inc2 + stage]),
-              "+m" (s[i + inc2 + inc1]), "+m" (s[i + inc2 + inc1 + stage])
-            : [x] "r" (&s[i]), [y] "r" (&s[i + stage]),
-              [z] "r" (&s[i + inc1]), [w] "r" (&s[i + inc1 + stage]),
-              [a] "r" (&s[i + inc2]), [b] "r" (&s[i + inc2 + stage]),
-              [c] "r" (&s[i + inc2 + inc1]), [d] "r" (&s[i + inc2 + inc1 + stage])
-            : "fr0", "fr1", "fr2", "fr3", "fr4", "fr5",
-              "fr6", "fr7", "fr8", "fr9", "fr10", "fr11");
+        for(size_t ch = 0; ch < count; ++ch) {
+            shz_complex_t* s = shz_fft_channel(channels, base, ch, size);
+
+            for(size_t i = twiddle; i < size; i += (inc2 << 1)) {
+                asm volatile(R"(
+                    fmov.d  @%[x], dr0
+                    fmov.d  @%[y], dr2
+                    fmov.d  @%[z], dr4
+                    ftrv    xmtrx, fv0
+
+                    fmov.d  @%[w], dr6
+                    fmov.d  @%[a], dr8
+                    fmov.d  @%[b], dr10
+                    ftrv    xmtrx, fv4
+
+                    fmov.d  dr0, @%[x]
+                    fmov.d  dr2, @%[y]
+                    fmov.d  @%[c], dr0
+                    fmov.d  @%[d], dr2
+                    ftrv    xmtrx, fv8
+
+                    fmov.d  dr4, @%[z]
+                    fmov.d  dr6, @%[w]
+                    ftrv    xmtrx, fv0
+
+                    fmov.d  dr8, @%[a]
+                    fmov.d  dr10, @%[b]
+                    fmov.d  dr0, @%[c]
+                    fmov.d  dr2, @%[d]
+                )"
+                : "+m" (s[i]), "+m" (s[i + stage]),
+                  "+m" (s[i + inc1]), "+m" (s[i + inc1 + stage]),
+                  "+m" (s[i + inc2]), "+m" (s[i + inc2 + stage]),
+                  "+m" (s[i + inc2 + inc1]), "+m" (s[i + inc2 + inc1 + stage])
+                : [x] "r" (&s[i]), [y] "r" (&s[i + stage]),
+                  [z] "r" (&s[i + inc1]), [w] "r" (&s[i + inc1 + stage]),
+                  [a] "r" (&s[i + inc2]), [b] "r" (&s[i + inc2 + stage]),
+                  [c] "r" (&s[i + inc2 + inc1]), [d] "r" (&s[i + inc2 + inc1 + stage])
+                : "fr0", "fr1", "fr2", "fr3", "fr4", "fr5",
+                  "fr6", "fr7", "fr8", "fr9", "fr10", "fr11");
+            }
         }
 
         SHZ_FSCHG();
@@ -194,7 +218,8 @@ static void shz_fft_8pt(shz_complex_t* s, size_t size, size_t stage, float facto
 }
 
 // Apply all twiddle factors for the given stage with an unrolled 16-PT butterfly DIF.
-static void shz_fft_16pt(shz_complex_t* s, size_t size, size_t stage, float factor) {
+static void shz_fft_16pt(shz_complex_t* const* channels, shz_complex_t* base, size_t count,
+                         size_t size, size_t stage, float factor) {
     const size_t inc1   = (stage << 1);
     const size_t inc2   = (inc1  << 1);
     const size_t inc3   = (inc2  << 1);
@@ -205,66 +230,70 @@ static void shz_fft_16pt(shz_complex_t* s, size_t size, size_t stage, float fact
     for(size_t twiddle = 0; twiddle < stage; ++twiddle) {
         shz_xmtrx_update_fft_butterfly(angle);
 
-        for(size_t i = twiddle; i < size; i += stride) {
-            asm volatile(R"(
-                fmov.d  @%[x], dr0
-                fmov.d  @%[y], dr2
-                fmov.d  @%[z], dr4
-                ftrv    xmtrx, fv0
-
-                fmov.d  @%[w], dr6
-                fmov.d  @%[a], dr8
-                fmov.d  @%[b], dr10
-                ftrv    xmtrx, fv4
-
-                fmov.d  dr0, @%[x]
-                fmov.d  dr2, @%[y]
-                fmov.d  @%[c], dr0
-                fmov.d  @%[d], dr2
-                ftrv    xmtrx, fv8
-
-                fmov.d  dr4, @%[z]
-                fmov.d  dr6, @%[w]
-                fmov.d  @(r0, %[x]), dr4
-                fmov.d  @(r0, %[y]), dr6
-                ftrv    xmtrx, fv0
-
-                fmov.d  dr8, @%[a]
-                fmov.d  dr10, @%[b]
-                fmov.d  @(r0, %[z]), dr8
-                fmov.d  @(r0, %[w]), dr10
-                ftrv    xmtrx, fv4
-
-                fmov.d  dr0, @%[c]
-                fmov.d  dr2, @%[d]
-                fmov.d  @(r0, %[a]), dr0
-                fmov.d  @(r0, %[b]), dr2
-                ftrv    xmtrx, fv8
-
-                fmov.d  dr4, @(r0, %[x])
-                fmov.d  dr6, @(r0, %[y])
-                fmov.d  @(r0, %[c]), dr4
-                fmov.d  @(r0, %[d]), dr6
-                ftrv    xmtrx, fv0
-
-                fmov.d  dr8, @(r0, %[z])
-                fmov.d  dr10, @(r0, %[w])
-                ftrv    xmtrx, fv4
-
-                fmov.d  dr0, @(r0, %[a])
-                fmov.d  dr2, @(r0, %[b])
-                fmov.d  dr4, @(r0, %[c])
-                fmov.d  dr6, @(r0, %[d])
-            )"
-            :
-            : [x] "r" (&s[i]), [y] "r" (&s[i + stage]),
-              [z] "r" (&s[i + inc1]), [w] "r" (&s[i + inc1 + stage]),
-              [a] "r" (&s[i + inc2]), [b] "r" (&s[i + inc2 + stage]),
-              [c] "r" (&s[i + inc2 + inc1]), [d] "r" (&s[i + inc2 + inc1 + stage]),
-              "z" (inc3 << 3)
-            : "fr0", "fr1", "fr2", "fr3", "fr4", "fr5",
-              "fr6", "fr7", "fr8", "fr9", "fr10", "fr11",
-              "memory");
+        for(size_t ch = 0; ch < count; ++ch) {
+            shz_complex_t* s = shz_fft_channel(channels, base, ch, size);
+
+            for(size_t i = twiddle; i < size; i += stride) {
+                asm volatile(R"(
+                    fmov.d  @%[x], dr0
+                    fmov.d  @%[y], dr2
+                    fmov.d  @%[z], dr4
+                    ftrv    xmtrx, fv0
+
+                    fmov.d  @%[w], dr6
+                    fmov.d  @%[a], dr8
+                    fmov.d  @%[b], dr10
+                    ftrv    xmtrx, fv4
+
+                    fmov.d  dr0, @%[x]
+                    fmov.d  dr2, @%[y]
+                    fmov.d  @%[c], dr0
+                    fmov.d  @%[d], dr2
+                    ftrv    xmtrx, fv8
+
+                    fmov.d  dr4, @%[z]
+                    fmov.d  dr6, @%[w]
+                    fmov.d  @(r0, %[x]), dr4
+                    fmov.d  @(r0, %[y]), dr6
+                    ftrv    xmtrx, fv0
+
+                    fmov.d  dr8, @%[a]
+                    fmov.d  dr10, @%[b]
+                    fmov.d  @(r0, %[z]), dr8
+                    fmov.d  @(r0, %[w]), dr10
+                    ftrv    xmtrx, fv4
+
+                    fmov.d  dr0, @%[c]
+                    fmov.d  dr2, @%[d]
+                    fmov.d  @(r0, %[a]), dr0
+                    fmov.d  @(r0, %[b]), dr2
+                    ftrv    xmtrx, fv8
+
+                    fmov.d  dr4, @(r0, %[x])
+                    fmov.d  dr6, @(r0, %[y])
+                    fmov.d  @(r0, %[c]), dr4
+                    fmov.d  @(r0, %[d]), dr6
+                    ftrv    xmtrx, fv0
+
+                    fmov.d  dr8, @(r0, %[z])
+                    fmov.d  dr10, @(r0, %[w])
+                    ftrv    xmtrx, fv4
+
+                    fmov.d  dr0, @(r0, %[a])
+                    fmov.d  dr2, @(r0, %[b])
+                    fmov.d  dr4, @(r0, %[c])
+                    fmov.d  dr6, @(r0, %[d])
+                )"
+                :
+                : [x] "r" (&s[i]), [y] "r" (&s[i + stage]),
+                  [z] "r" (&s[i + inc1]), [w] "r" (&s[i + inc1 + stage]),
+                  [a] "r" (&s[i + inc2]), [b] "r" (&s[i + inc2 + stage]),
+                  [c] "r" (&s[i + inc2 + inc1]), [d] "r" (&s[i + inc2 + inc1 + stage]),
+                  "z" (inc3 << 3)
+                : "fr0", "fr1", "fr2", "fr3", "fr4", "fr5",
+                  "fr6", "fr7", "fr8", "fr9", "fr10", "fr11",
+                  "memory");
+            }
         }
 
         SHZ_FSCHG();
@@ -272,8 +301,8 @@ static void shz_fft_16pt(shz_complex_t* s, size_t size, size_t stage, float fact
     }
 }
 
-// Iterates over the given complex sample buffer, reversing the order of its bits.
-static void shz_fft_bit_reverse(shz_complex_t* s, size_t size) {
+// Iterates over each complex sample buffer of the batch, reversing the order of their bits.
+static void shz_fft_bit_reverse(shz_complex_t* const* channels, shz_complex_t* base, size_t count, size_t size) {
     size_t j = 0, k;
 
     SHZ_FSCHG();
@@ -288,30 +317,34 @@ static void shz_fft_bit_reverse(shz_complex_t* s, size_t size) {
         j += k;
         
         if(i < j) {
-            asm(R"(
-                fmov.d @%[i], xd0
-                fmov.d @%[j], xd2
-                fmov.d xd0, @%[j]
-                fmov.d xd2, @%[i]
-            )"
-            : "+m" (s[i]), "+m" (s[j])
-            : [i] "r" (&s[i]), [j] "r" (&s[j]));
+            for(size_t ch = 0; ch < count; ++ch) {
+                shz_complex_t* s = shz_fft_channel(channels, base, ch, size);
+
+                asm(R"(
+                    fmov.d @%[i], xd0
+                    fmov.d @%[j], xd2
+                    fmov.d xd0, @%[j]
+                    fmov.d xd2, @%[i]
+                )"
+                : "+m" (s[i]), "+m" (s[j])
+                : [i] "r" (&s[i]), [j] "r" (&s[j]));
+            }
         }
     }
     SHZ_FSCHG();
 }
 
-/* Main entry-point for performing an FFT in-place over the given buffer of the given size.
+/* Performs an FFT in-place over each buffer of the given batch, of the given size.
 
-   NOTE: Buffer must be 8-byte aligned for pairwise loads/stores into the FPU, and size must
+   NOTE: Buffers must be 8-byte aligned for pairwise loads/stores into the FPU, and size must
          be a power-of-two.
 
    This particular algorithm is a radix-2 decimation in frequency domain (DIF) FFT, where the
    innermost loops of 2-point butterfly operations have been unrolled to N-points per iteration.
 */
-void shz_fft_dc(shz_complex_t* s, size_t size) {
-    // Buffer must be 8-byte aligned and a nonzero power-of-two size.
-    assert(size && !(size & (size - 1)) && !((uintptr_t)s & 0x7));
+static void shz_fft_batch_dc(shz_complex_t* const* channels, shz_complex_t* base, size_t count, size_t size) {
+    // Buffer must be a nonzero power-of-two size.
+    assert(size && !(size & (size - 1)));
 
     // Calculate smallest angle in radians for each twiddle increment.
     const float twiddle_inc = shz_divf_fsrra(-2.0f * SHZ_F_PI, size) * SHZ_FSCA_RAD_FACTOR;
@@ -328,15 +361,36 @@ void shz_fft_dc(shz_complex_t* s, size_t size) {
            based on how many pairs are being processed at the current stage.
         */
         if(!(pairs & 7))
-            shz_fft_16pt(s, size, twiddle, twiddle_scale);  // 16-PT DIF butterfly.
+            shz_fft_16pt(channels, base, count, size, twiddle, twiddle_scale);  // 16-PT DIF butterfly.
         else  if (!(pairs & 3))
-            shz_fft_8pt(s, size, twiddle, twiddle_scale);   //  8-PT DIF butterfly.
+            shz_fft_8pt(channels, base, count, size, twiddle, twiddle_scale);   //  8-PT DIF butterfly.
         else  if (!(pairs & 1))
-            shz_fft_4pt(s, size, twiddle, twiddle_scale);   //  4-PT DIF butterfly.
+            shz_fft_4pt(channels, base, count, size, twiddle, twiddle_scale);   //  4-PT DIF butterfly.
         else
-            shz_fft_2pt(s, size, twiddle, twiddle_scale);   //  2-PT DIF butterfly.
+            shz_fft_2pt(channels, base, count, size, twiddle, twiddle_scale);   //  2-PT DIF butterfly.
     }
 
-    // Reverse the order of the bits in our buffer for the final stage of a DIF FFT.
-    shz_fft_bit_reverse(s, size);
+    // Reverse the order of the bits in our buffers for the final stage of a DIF FFT.
+    shz_fft_bit_reverse(channels, base, count, size);
+}
+
+// Main entry-point for performing an FFT in-place over the given buffer of the given size.
+void shz_fft_dc(shz_complex_t* s, size_t size) {
+    // Buffer must be 8-byte aligned.
+    assert(!((uintptr_t)s & 0x7));
+
+    shz_fft_batch_dc(&s, NULL, 1, size);
+}
+
+void shz_fft_batch(shz_complex_t* const* channels, size_t count, size_t size) SHZ_NOEXCEPT {
+    for(size_t ch = 0; ch < count; ++ch)
+        assert(!((uintptr_t)channels[ch] & 0x7));
+
+    shz_fft_batch_dc(channels, NULL, count, size);
+}
+
+void shz_fft_batch_contiguous(shz_complex_t* s, size_t count, size_t size) SHZ_NOEXCEPT {
+    assert(!((uintptr_t)s & 0x7));
+
+    shz_fft_batch_dc(NULL, s, count, size);
 }
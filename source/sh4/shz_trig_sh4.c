@@ -0,0 +1,108 @@
+/*! \file
+ *  \brief   Out-of-line SH4 implementation of trigonometry routines.
+ *  \ingroup trig
+ *
+ *  This file contains the SH4 routines which back the sin/cos array API.
+ *
+ *  Angles are processed in pairs, with the second FSCA issued before the
+ *  results of the first are read back, so the latencies of both overlap,
+ *  while the input stream is prefetched a cache line ahead.
+ *
+ *  \author     2026 Falco Girgis
+ *  \copyright  MIT License
+ */
+
+#include "sh4zam/shz_trig.h"
+
+// Calculates two sin/cos pairs from angles already scaled to FSCA units.
+SHZ_FORCE_INLINE void shz_fsca_pair_(float* sins, float* coss, float angle1, float angle2) SHZ_NOEXCEPT {
+    float s1, c1, s2, c2;
+
+    asm(R"(
+        ftrc    %[a1], fpul
+        fsca    fpul, dr8
+        ftrc    %[a2], fpul
+        fsca    fpul, dr10
+        fmov    fr8, %[s1]
+        fmov    fr9, %[c1]
+        fmov    fr10, %[s2]
+        fmov    fr11, %[c2]
+    )"
+    : [s1] "=&f" (s1), [c1] "=&f" (c1), [s2] "=&f" (s2), [c2] "=&f" (c2)
+    : [a1] "f" (angle1), [a2] "f" (angle2)
+    : "fpul", "fr8", "fr9", "fr10", "fr11");
+
+    sins[0] = s1; coss[0] = c1;
+    sins[1] = s2; coss[1] = c2;
+}
+
+// Same as above, except for raw 16-bit angles, which are transferred from integer registers.
+SHZ_FORCE_INLINE void shz_fsca_pair_u16_(float* sins, float* coss, uint32_t angle1, uint32_t angle2) SHZ_NOEXCEPT {
+    float s1, c1, s2, c2;
+
+    asm(R"(
+        lds     %[a1], fpul
+        fsca    fpul, dr8
+        lds     %[a2], fpul
+        fsca    fpul, dr10
+        fmov    fr8, %[s1]
+        fmov    fr9, %[c1]
+        fmov    fr10, %[s2]
+        fmov    fr11, %[c2]
+    )"
+    : [s1] "=&f" (s1), [c1] "=&f" (c1), [s2] "=&f" (s2), [c2] "=&f" (c2)
+    : [a1] "r" (angle1), [a2] "r" (angle2)
+    : "fpul", "fr8", "fr9", "fr10", "fr11");
+
+    sins[0] = s1; coss[0] = c1;
+    sins[1] = s2; coss[1] = c2;
+}
+
+void shz_sincosu16_array(float* sins, float* coss, const uint16_t* radians16, size_t count) SHZ_NOEXCEPT {
+    size_t i = 0;
+
+    for(; i + 1 < count; i += 2) {
+        SHZ_PREFETCH(&radians16[i + 16]);
+        shz_fsca_pair_u16_(&sins[i], &coss[i], radians16[i], radians16[i + 1]);
+    }
+
+    if(i < count) {
+        const shz_sincos_t pair = shz_sincosu16(radians16[i]);
+        sins[i] = pair.sin;
+        coss[i] = pair.cos;
+    }
+}
+
+void shz_sincosf_array(float* sins, float* coss, const float* radians, size_t count) SHZ_NOEXCEPT {
+    size_t i = 0;
+
+    for(; i + 1 < count; i += 2) {
+        SHZ_PREFETCH(&radians[i + 8]);
+        shz_fsca_pair_(&sins[i], &coss[i],
+                       radians[i]     * SHZ_FSCA_RAD_FACTOR,
+                       radians[i + 1] * SHZ_FSCA_RAD_FACTOR);
+    }
+
+    if(i < count) {
+        const shz_sincos_t pair = shz_sincosf(radians[i]);
+        sins[i] = pair.sin;
+        coss[i] = pair.cos;
+    }
+}
+
+void shz_sincosf_deg_array(float* sins, float* coss, const float* degrees, size_t count) SHZ_NOEXCEPT {
+    size_t i = 0;
+
+    for(; i + 1 < count; i += 2) {
+        SHZ_PREFETCH(&degrees[i + 8]);
+        shz_fsca_pair_(&sins[i], &coss[i],
+                       degrees[i]     * SHZ_FSCA_DEG_FACTOR,
+                       degrees[i + 1] * SHZ_FSCA_DEG_FACTOR);
+    }
+
+    if(i < count) {
+        const shz_sincos_t pair = shz_sincosf_deg(degrees[i]);
+        sins[i] = pair.sin;
+        coss[i] = pair.cos;
+    }
+}
@@ -14,6 +14,11 @@
 .globl _shz_xmtrx_load_apply_store_3x4_sh4
     .section .text._shz_xmtrx_load_apply_store_4x4_sh4, "ax", %progbits
 .globl _shz_xmtrx_load_apply_store_3x3_sh4
+    .section .text._shz_xmtrx_transform_array_sh4, "ax", %progbits
+.globl _shz_xmtrx_transform_vec4_array_sh4
+.globl _shz_xmtrx_transform_vec3_array_sh4
+.globl _shz_xmtrx_transform_point3_array_sh4
+.globl _shz_xmtrx_project_point3_array_sh4
 
 !
 ! void shz_xmtrx_load_apply_store_4x4(shz_mat4x4_t* out, const shz_mat4x4_t* matrix1, const shz_mat4x4_t* matrix2)
@@ -269,3 +274,337 @@ _shz_xmtrx_load_apply_store_3x3_sh4:
     fmov.s    fr9, @-r4
     rts
     fmov.s    fr8, @-r4
+
+
+    .section .text._shz_xmtrx_transform_array_sh4, "ax", %progbits
+
+!
+! void shz_xmtrx_transform_vec4_array(shz_vec4_t* dst, const shz_vec4_t* src, size_t count, size_t stride)
+!
+! r4: dst    : Output array to store the transformed vectors within.
+! r5: src    : Input array of vectors to transform by XMTRX.
+! r6: count  : Number of vectors to transform.
+! r7: stride : Distance in bytes between consecutive vectors of both arrays.
+!
+! The loop is software-pipelined and unrolled by two, alternating between FV0
+! and FV4, so that the next vector is loaded and the previous one is stored
+! while FTRV is still in flight. Elements are accessed with single-precision
+! moves, since they need only be 4-byte aligned.
+!
+    .align 5
+_shz_xmtrx_transform_vec4_array_sh4:
+    tst       r6, r6        ! Early-out upon no elements
+    bt        .Lvec4_array_done
+    mov       r7, r3
+    add       #-12, r3      ! r3: source increment after the last load of an element
+    mov       r7, r2
+    add       #16, r2       ! r2: dest increment after the last store of an element
+    mov       r5, r1
+    add       r7, r1        ! r1: prefetch pointer, kept one element ahead of the source
+    add       #16, r4       ! Point dest to the end of its first element for pre-decrement stores
+
+    ! Load and begin transforming the first element
+    fmov.s    @r5+, fr0
+    pref      @r1
+    fmov.s    @r5+, fr1
+    add       r7, r1
+    fmov.s    @r5+, fr2
+    fmov.s    @r5, fr3
+    add       r3, r5
+    ftrv      xmtrx, fv0
+    dt        r6
+    bt        .Lvec4_array_store0
+
+.Lvec4_array_loop:
+    ! Load the next element into FV4 while FV0 is transforming
+    fmov.s    @r5+, fr4
+    pref      @r1
+    fmov.s    @r5+, fr5
+    add       r7, r1
+    fmov.s    @r5+, fr6
+    fmov.s    @r5, fr7
+    add       r3, r5
+    ftrv      xmtrx, fv4
+
+    ! Store the previous element from FV0
+    fmov.s    fr3, @-r4
+    fmov.s    fr2, @-r4
+    fmov.s    fr1, @-r4
+    fmov.s    fr0, @-r4
+    dt        r6
+    bt/s      .Lvec4_array_store4
+    add       r2, r4
+
+    ! Load the next element into FV0 while FV4 is transforming
+    fmov.s    @r5+, fr0
+    pref      @r1
+    fmov.s    @r5+, fr1
+    add       r7, r1
+    fmov.s    @r5+, fr2
+    fmov.s    @r5, fr3
+    add       r3, r5
+    ftrv      xmtrx, fv0
+
+    ! Store the previous element from FV4
+    fmov.s    fr7, @-r4
+    fmov.s    fr6, @-r4
+    fmov.s    fr5, @-r4
+    fmov.s    fr4, @-r4
+    dt        r6
+    bf/s      .Lvec4_array_loop
+    add       r2, r4
+
+.Lvec4_array_store0:
+    ! Store the last element from FV0
+    fmov.s    fr3, @-r4
+    fmov.s    fr2, @-r4
+    fmov.s    fr1, @-r4
+    rts
+    fmov.s    fr0, @-r4
+
+.Lvec4_array_store4:
+    ! Store the last element from FV4
+    fmov.s    fr7, @-r4
+    fmov.s    fr6, @-r4
+    fmov.s    fr5, @-r4
+    rts
+    fmov.s    fr4, @-r4
+
+.Lvec4_array_done:
+    rts
+    nop
+
+!
+! void shz_xmtrx_transform_vec3_array(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride)
+! void shz_xmtrx_transform_point3_array(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride)
+!
+! r4: dst    : Output array to store the transformed vectors or points within.
+! r5: src    : Input array of vectors or points to transform by XMTRX.
+! r6: count  : Number of elements to transform.
+! r7: stride : Distance in bytes between consecutive elements of both arrays.
+!
+! Both entry points share the same pipelined loop as the 4D variant, differing
+! only by the implicit W component, which is kept within FR8.
+!
+    .align 5
+_shz_xmtrx_transform_vec3_array_sh4:
+    bra       .Lvec3_array_start
+    fldi0     fr8           ! Vectors have an implicit W of 0.0f
+
+    .align 2
+_shz_xmtrx_transform_point3_array_sh4:
+    fldi1     fr8           ! Points have an implicit W of 1.0f
+
+.Lvec3_array_start:
+    tst       r6, r6        ! Early-out upon no elements
+    bt        .Lvec3_array_done
+    mov       r7, r3
+    add       #-8, r3       ! r3: source increment after the last load of an element
+    mov       r7, r2
+    add       #12, r2       ! r2: dest increment after the last store of an element
+    mov       r5, r1
+    add       r7, r1        ! r1: prefetch pointer, kept one element ahead of the source
+    add       #12, r4       ! Point dest to the end of its first element for pre-decrement stores
+
+    ! Load and begin transforming the first element
+    fmov.s    @r5+, fr0
+    pref      @r1
+    fmov.s    @r5+, fr1
+    add       r7, r1
+    fmov.s    @r5, fr2
+    fmov      fr8, fr3
+    add       r3, r5
+    ftrv      xmtrx, fv0
+    dt        r6
+    bt        .Lvec3_array_store0
+
+.Lvec3_array_loop:
+    ! Load the next element into FV4 while FV0 is transforming
+    fmov.s    @r5+, fr4
+    pref      @r1
+    fmov.s    @r5+, fr5
+    add       r7, r1
+    fmov.s    @r5, fr6
+    fmov      fr8, fr7
+    add       r3, r5
+    ftrv      xmtrx, fv4
+
+    ! Store the previous element from FV0
+    fmov.s    fr2, @-r4
+    fmov.s    fr1, @-r4
+    fmov.s    fr0, @-r4
+    dt        r6
+    bt/s      .Lvec3_array_store4
+    add       r2, r4
+
+    ! Load the next element into FV0 while FV4 is transforming
+    fmov.s    @r5+, fr0
+    pref      @r1
+    fmov.s    @r5+, fr1
+    add       r7, r1
+    fmov.s    @r5, fr2
+    fmov      fr8, fr3
+    add       r3, r5
+    ftrv      xmtrx, fv0
+
+    ! Store the previous element from FV4
+    fmov.s    fr6, @-r4
+    fmov.s    fr5, @-r4
+    fmov.s    fr4, @-r4
+    dt        r6
+    bf/s      .Lvec3_array_loop
+    add       r2, r4
+
+.Lvec3_array_store0:
+    ! Store the last element from FV0
+    fmov.s    fr2, @-r4
+    fmov.s    fr1, @-r4
+    rts
+    fmov.s    fr0, @-r4
+
+.Lvec3_array_store4:
+    ! Store the last element from FV4
+    fmov.s    fr6, @-r4
+    fmov.s    fr5, @-r4
+    rts
+    fmov.s    fr4, @-r4
+
+.Lvec3_array_done:
+    rts
+    nop
+
+!
+! void shz_xmtrx_project_point3_array(shz_vec3_t* dst, const shz_vec3_t* src, size_t count, size_t stride, const shz_viewport_t* viewport)
+!
+! r4:    dst      : Output array to store the projected points within.
+! r5:    src      : Input array of points to transform by XMTRX.
+! r6:    count    : Number of points to project.
+! r7:    stride   : Distance in bytes between consecutive points of both arrays.
+! @r15:  viewport : Scale and offset applied to X and Y after the divide.
+!
+! Uses the same pipelined loop as the 3D variants, except that each element
+! is divided by W and mapped onto the viewport while the next one is within
+! FTRV. The X and Y scales are applied while FSRRA is still in flight, and
+! 1/W is stored in place of Z. The viewport is kept within FR8-FR11.
+!
+    .align 5
+_shz_xmtrx_project_point3_array_sh4:
+    tst       r6, r6        ! Early-out upon no elements
+    bt        .Lproject_array_done
+    mov.l     @r15, r0      ! r0: viewport, passed on the stack
+    mov       r7, r3
+    add       #-8, r3       ! r3: source increment after the last load of an element
+    mov       r7, r2
+    add       #12, r2       ! r2: dest increment after the last store of an element
+    mov       r5, r1
+    add       r7, r1        ! r1: prefetch pointer, kept one element ahead of the source
+    add       #12, r4       ! Point dest to the end of its first element for pre-decrement stores
+
+    ! Load and begin transforming the first element
+    fmov.s    @r5+, fr0
+    pref      @r1
+    fmov.s    @r5+, fr1
+    add       r7, r1
+    fmov.s    @r5, fr2
+    fldi1     fr3           ! Points have an implicit W of 1.0f
+    add       r3, r5
+    ftrv      xmtrx, fv0
+
+    ! Load the viewport while the first element is transforming
+    fmov.s    @r0+, fr8     ! fr8:  X scale
+    fmov.s    @r0+, fr9     ! fr9:  Y scale
+    fmov.s    @r0+, fr10    ! fr10: X offset
+    fmov.s    @r0, fr11     ! fr11: Y offset
+    dt        r6
+    bt        .Lproject_array_store0
+
+.Lproject_array_loop:
+    ! Load the next element into FV4 while FV0 is transforming
+    fmov.s    @r5+, fr4
+    pref      @r1
+    fmov.s    @r5+, fr5
+    add       r7, r1
+    fmov.s    @r5, fr6
+    fldi1     fr7
+    add       r3, r5
+    ftrv      xmtrx, fv4
+
+    ! Project the previous element from FV0
+    fmul      fr3, fr3      ! W * W
+    fsrra     fr3           ! 1 / |W|
+    fmul      fr8, fr0
+    fmul      fr9, fr1
+    fmul      fr3, fr0
+    fmul      fr3, fr1
+    fadd      fr10, fr0
+    fadd      fr11, fr1
+
+    ! Store the previous element from FV0
+    fmov.s    fr3, @-r4
+    fmov.s    fr1, @-r4
+    fmov.s    fr0, @-r4
+    dt        r6
+    bt/s      .Lproject_array_store4
+    add       r2, r4
+
+    ! Load the next element into FV0 while FV4 is transforming
+    fmov.s    @r5+, fr0
+    pref      @r1
+    fmov.s    @r5+, fr1
+    add       r7, r1
+    fmov.s    @r5, fr2
+    fldi1     fr3
+    add       r3, r5
+    ftrv      xmtrx, fv0
+
+    ! Project the previous element from FV4
+    fmul      fr7, fr7      ! W * W
+    fsrra     fr7           ! 1 / |W|
+    fmul      fr8, fr4
+    fmul      fr9, fr5
+    fmul      fr7, fr4
+    fmul      fr7, fr5
+    fadd      fr10, fr4
+    fadd      fr11, fr5
+
+    ! Store the previous element from FV4
+    fmov.s    fr7, @-r4
+    fmov.s    fr5, @-r4
+    fmov.s    fr4, @-r4
+    dt        r6
+    bf/s      .Lproject_array_loop
+    add       r2, r4
+
+.Lproject_array_store0:
+    ! Project and store the last element from FV0
+    fmul      fr3, fr3
+    fsrra     fr3
+    fmul      fr8, fr0
+    fmul      fr9, fr1
+    fmul      fr3, fr0
+    fmul      fr3, fr1
+    fadd      fr10, fr0
+    fadd      fr11, fr1
+    fmov.s    fr3, @-r4
+    fmov.s    fr1, @-r4
+    rts
+    fmov.s    fr0, @-r4
+
+.Lproject_array_store4:
+    ! Project and store the last element from FV4
+    fmul      fr7, fr7
+    fsrra     fr7
+    fmul      fr8, fr4
+    fmul      fr9, fr5
+    fmul      fr7, fr4
+    fmul      fr7, fr5
+    fadd      fr10, fr4
+    fadd      fr11, fr5
+    fmov.s    fr7, @-r4
+    fmov.s    fr5, @-r4
+    rts
+    fmov.s    fr4, @-r4
+
+.Lproject_array_done:
+    rts
+    nop
@@ -0,0 +1,164 @@
+/*! \file
+    \brief Keyframe sampler implementation.
+    \ingroup anim
+
+    This file contains the implementation of the animation sampling API.
+
+    Tracks are dispatched by type and interpolation once per call, into
+    loops over every instance which are specialized for both, so that the
+    per-sample work is only seeking the cursor and blending two keys.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#include "sh4zam/shz_anim.h"
+
+/* Number of keys a cursor walks forwards, before giving up and binary
+   searching the remainder of the track. */
+#ifndef SHZ_ANIM_SEEK_STEPS
+#   define SHZ_ANIM_SEEK_STEPS  4
+#endif
+
+// Returns the last key within [lo, hi] whose time is at or before t, or lo if there is none.
+SHZ_FORCE_INLINE uint32_t shz_anim_search_(const float* times, uint32_t lo, uint32_t hi, float t) SHZ_NOEXCEPT {
+    while(lo < hi) {
+        const uint32_t mid = lo + ((hi - lo + 1) >> 1);
+
+        if(times[mid] <= t)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    return lo;
+}
+
+// Returns the index of the first key of the segment containing t, starting from the cursor's segment.
+SHZ_FORCE_INLINE uint32_t shz_anim_seek_(const float* times, uint32_t keys, uint32_t cursor, float t) SHZ_NOEXCEPT {
+    const uint32_t last = keys - 2;
+
+    if(cursor > last)
+        cursor = last;
+
+    // Seeking backwards, or looping back around.
+    if(t < times[cursor])
+        return shz_anim_search_(times, 0, cursor, t);
+
+    for(unsigned s = 0; s < SHZ_ANIM_SEEK_STEPS; ++s) {
+        if(cursor == last || t < times[cursor + 1])
+            return cursor;
+
+        ++cursor;
+    }
+
+    return shz_anim_search_(times, cursor, last, t);
+}
+
+// Evaluates a single track, with the given constant component count and interpolation, for a single sample.
+SHZ_FORCE_INLINE void shz_anim_eval_(const shz_anim_track_t* track, float time, uint32_t* cursor, float* dst,
+                                     unsigned comps, shz_anim_interp_t interp) SHZ_NOEXCEPT {
+    const unsigned key_size = (interp == SHZ_ANIM_CUBIC)? 3 * comps : comps;
+    // Offset of each key's value within its packed key.
+    const unsigned value    = (interp == SHZ_ANIM_CUBIC)? comps : 0;
+
+    if(track->keys == 1) {
+        for(unsigned c = 0; c < comps; ++c)
+            dst[c] = track->values[value + c];
+
+        return;
+    }
+
+    const uint32_t k  = *cursor = shz_anim_seek_(track->times, track->keys, *cursor, time);
+    const float    t0 = track->times[k];
+    const float    dt = track->times[k + 1] - t0;
+    const float    u  = shz_clampf(shz_divf(time - t0, dt), 0.0f, 1.0f);
+    const float*   k0 = &track->values[k * key_size];
+    const float*   k1 = k0 + key_size;
+
+    if(interp == SHZ_ANIM_STEP) {
+        // Only the last key of a track is ever reached, once the time passes it.
+        const float* key = (time >= track->times[k + 1])? k1 : k0;
+
+        for(unsigned c = 0; c < comps; ++c)
+            dst[c] = key[c];
+    } else if(interp == SHZ_ANIM_LINEAR) {
+        float w1 = u;
+
+        // Interpolate rotations along the shorter arc.
+        if(comps == 4 && shz_dot8f(k0[0], k0[1], k0[2], k0[3], k1[0], k1[1], k1[2], k1[3]) < 0.0f)
+            w1 = -u;
+
+        for(unsigned c = 0; c < comps; ++c)
+            dst[c] = shz_fmaf(k1[c], w1, k0[c] * (1.0f - u));
+    } else {
+        const float u2  = u * u;
+        const float u3  = u2 * u;
+        const float h00 = 2.0f * u3 - 3.0f * u2 + 1.0f;
+        const float h10 = (u3 - 2.0f * u2 + u) * dt;
+        const float h01 = 3.0f * u2 - 2.0f * u3;
+        const float h11 = (u3 - u2) * dt;
+
+        // Blends the outgoing tangent of k0 and the incoming tangent of k1.
+        for(unsigned c = 0; c < comps; ++c)
+            dst[c] = h00 * k0[comps + c] + h10 * k0[2 * comps + c] +
+                     h01 * k1[comps + c] + h11 * k1[c];
+    }
+
+    if(comps == 4 && interp != SHZ_ANIM_STEP) {
+        const float inv = shz_inv_sqrtf_fsrra(shz_mag_sqr4f(dst[0], dst[1], dst[2], dst[3]));
+
+        for(unsigned c = 0; c < 4; ++c)
+            dst[c] *= inv;
+    }
+}
+
+// Evaluates a single track for every instance.
+SHZ_FORCE_INLINE void shz_anim_track_(const shz_anim_clip_t* clip, size_t index, const float* times,
+                                      uint32_t* cursors, float* const* dsts, size_t instances,
+                                      unsigned comps, shz_anim_interp_t interp) SHZ_NOEXCEPT {
+    const shz_anim_track_t* track = &clip->tracks[index];
+
+    for(size_t i = 0; i < instances; ++i)
+        shz_anim_eval_(track, times[i], &cursors[i * clip->track_count + index],
+                       dsts[i] + track->offset, comps, interp);
+}
+
+// Instantiates the track loop for each interpolation of a given component count.
+SHZ_FORCE_INLINE void shz_anim_track_interp_(const shz_anim_clip_t* clip, size_t index, const float* times,
+                                             uint32_t* cursors, float* const* dsts, size_t instances,
+                                             unsigned comps) SHZ_NOEXCEPT {
+    switch(clip->tracks[index].interp) {
+        case SHZ_ANIM_STEP:
+            shz_anim_track_(clip, index, times, cursors, dsts, instances, comps, SHZ_ANIM_STEP);
+            break;
+        case SHZ_ANIM_LINEAR:
+            shz_anim_track_(clip, index, times, cursors, dsts, instances, comps, SHZ_ANIM_LINEAR);
+            break;
+        case SHZ_ANIM_CUBIC:
+            shz_anim_track_(clip, index, times, cursors, dsts, instances, comps, SHZ_ANIM_CUBIC);
+            break;
+    }
+}
+
+void shz_anim_sample_instances(const shz_anim_clip_t* clip, const float* times, uint32_t* cursors,
+                               float* const* dsts, size_t instances) SHZ_NOEXCEPT {
+    for(size_t t = 0; t < clip->track_count; ++t) {
+        switch(clip->tracks[t].type) {
+            case SHZ_ANIM_SCALAR:
+                shz_anim_track_interp_(clip, t, times, cursors, dsts, instances, 1);
+                break;
+            case SHZ_ANIM_VEC3:
+                shz_anim_track_interp_(clip, t, times, cursors, dsts, instances, 3);
+                break;
+            case SHZ_ANIM_QUAT:
+                shz_anim_track_interp_(clip, t, times, cursors, dsts, instances, 4);
+                break;
+        }
+    }
+}
+
+void shz_anim_sample(const shz_anim_clip_t* clip, float time, uint32_t* cursors, float* dst) SHZ_NOEXCEPT {
+    shz_anim_sample_instances(clip, &time, cursors, &dst, 1);
+}
@@ -0,0 +1,242 @@
+/*! \file
+    \brief Transform chain implementation.
+    \ingroup chain
+
+    This file contains the implementation of the chain recording and
+    compilation API.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#include "sh4zam/shz_chain.h"
+#include "sh4zam/shz_xmtrx.h"
+#include "sh4zam/shz_trig.h"
+
+#include <assert.h>
+
+// Resets the given matrix to identity, without going through XMTRX.
+SHZ_FORCE_INLINE void shz_chain_identity_(shz_mat4x4_t* mat) {
+    mat->col[0] = shz_vec4_init(1.0f, 0.0f, 0.0f, 0.0f);
+    mat->col[1] = shz_vec4_init(0.0f, 1.0f, 0.0f, 0.0f);
+    mat->col[2] = shz_vec4_init(0.0f, 0.0f, 1.0f, 0.0f);
+    mat->col[3] = shz_vec4_init(0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+// Claims the next operation, dirtying the chain when the one previously recorded in its place had another type.
+SHZ_FORCE_INLINE shz_chain_op_t* shz_chain_record_(shz_chain_t* chain, shz_chain_op_type_t type) {
+    assert(chain->count < chain->capacity);
+
+    shz_chain_op_t* op = &chain->ops[chain->count];
+
+    if(chain->count++ >= chain->compiled || op->type != type)
+        chain->dirty = true;
+
+    op->type = type;
+
+    return op;
+}
+
+// Records an operation taking up to four arguments, dirtying the chain when any of them have changed.
+SHZ_FORCE_INLINE void shz_chain_record_args_(shz_chain_t* chain, shz_chain_op_type_t type,
+                                             float a0, float a1, float a2, float a3) {
+    shz_chain_op_t* op = shz_chain_record_(chain, type);
+
+    chain->dirty |= op->args[0] != a0 || op->args[1] != a1 ||
+                    op->args[2] != a2 || op->args[3] != a3;
+
+    op->args[0] = a0;
+    op->args[1] = a1;
+    op->args[2] = a2;
+    op->args[3] = a3;
+}
+
+void shz_chain_init(shz_chain_t* chain, shz_chain_op_t* ops, size_t capacity) SHZ_NOEXCEPT {
+    shz_chain_identity_(&chain->matrix);
+    chain->ops      = ops;
+    chain->capacity = capacity;
+    chain->count    = 0;
+    chain->compiled = 0;
+    chain->dirty    = false;
+}
+
+void shz_chain_begin(shz_chain_t* chain) SHZ_NOEXCEPT {
+    chain->count = 0;
+}
+
+void shz_chain_invalidate(shz_chain_t* chain) SHZ_NOEXCEPT {
+    chain->dirty = true;
+}
+
+void shz_chain_translate(shz_chain_t* chain, float x, float y, float z) SHZ_NOEXCEPT {
+    shz_chain_record_args_(chain, SHZ_CHAIN_TRANSLATE, x, y, z, 0.0f);
+}
+
+void shz_chain_scale(shz_chain_t* chain, float x, float y, float z) SHZ_NOEXCEPT {
+    shz_chain_record_args_(chain, SHZ_CHAIN_SCALE, x, y, z, 0.0f);
+}
+
+void shz_chain_rotate_x(shz_chain_t* chain, float radians) SHZ_NOEXCEPT {
+    shz_chain_record_args_(chain, SHZ_CHAIN_ROTATE_X, radians, 0.0f, 0.0f, 0.0f);
+}
+
+void shz_chain_rotate_y(shz_chain_t* chain, float radians) SHZ_NOEXCEPT {
+    shz_chain_record_args_(chain, SHZ_CHAIN_ROTATE_Y, radians, 0.0f, 0.0f, 0.0f);
+}
+
+void shz_chain_rotate_z(shz_chain_t* chain, float radians) SHZ_NOEXCEPT {
+    shz_chain_record_args_(chain, SHZ_CHAIN_ROTATE_Z, radians, 0.0f, 0.0f, 0.0f);
+}
+
+void shz_chain_rotate_quat(shz_chain_t* chain, shz_quat_t q) SHZ_NOEXCEPT {
+    shz_chain_record_args_(chain, SHZ_CHAIN_ROTATE_QUAT, q.w, q.x, q.y, q.z);
+}
+
+void shz_chain_apply_screen(shz_chain_t* chain, float width, float height) SHZ_NOEXCEPT {
+    shz_chain_record_args_(chain, SHZ_CHAIN_SCREEN, width, height, 0.0f, 0.0f);
+}
+
+void shz_chain_apply_perspective(shz_chain_t* chain, float fov, float aspect, float znear) SHZ_NOEXCEPT {
+    shz_chain_record_args_(chain, SHZ_CHAIN_PERSPECTIVE, fov, aspect, znear, 0.0f);
+}
+
+void shz_chain_apply_4x4(shz_chain_t* chain, const shz_mat4x4_t* matrix) SHZ_NOEXCEPT {
+    shz_chain_op_t* op = shz_chain_record_(chain, SHZ_CHAIN_MATRIX);
+
+    chain->dirty |= op->matrix != matrix;
+    op->matrix    = matrix;
+}
+
+// Post-multiplies the accumulated transform by a translation, which only affects its last column.
+SHZ_FORCE_INLINE void shz_chain_fold_translate_(shz_mat4x4_t* acc, float x, float y, float z) {
+    acc->pos = shz_vec4_add(acc->pos, shz_vec4_add(shz_vec4_scale(acc->col[0], x),
+                                                   shz_vec4_add(shz_vec4_scale(acc->col[1], y),
+                                                                shz_vec4_scale(acc->col[2], z))));
+}
+
+// Post-multiplies the accumulated transform by a scale, which only affects its basis columns.
+SHZ_FORCE_INLINE void shz_chain_fold_scale_(shz_mat4x4_t* acc, float x, float y, float z) {
+    acc->col[0] = shz_vec4_scale(acc->col[0], x);
+    acc->col[1] = shz_vec4_scale(acc->col[1], y);
+    acc->col[2] = shz_vec4_scale(acc->col[2], z);
+}
+
+// Post-multiplies the accumulated transform by an axis rotation, which mixes the two columns about it.
+SHZ_FORCE_INLINE void shz_chain_fold_rotate_(shz_vec4_t* a, shz_vec4_t* b, float radians) {
+    const shz_sincos_t sc = shz_sincosf(radians);
+    const shz_vec4_t   c0 = *a;
+    const shz_vec4_t   c1 = *b;
+
+    *a = shz_vec4_add(shz_vec4_scale(c0, sc.cos), shz_vec4_scale(c1, sc.sin));
+    *b = shz_vec4_sub(shz_vec4_scale(c1, sc.cos), shz_vec4_scale(c0, sc.sin));
+}
+
+// Post-multiplies the accumulated transform by the rotation matrix of a quaternion.
+static void shz_chain_fold_quat_(shz_mat4x4_t* acc, shz_quat_t q) {
+    shz_mat4x4_t     rot;
+    const shz_vec4_t c0 = acc->col[0];
+    const shz_vec4_t c1 = acc->col[1];
+    const shz_vec4_t c2 = acc->col[2];
+
+    shz_mat4x4_set_rotation_quat(&rot, q);
+
+    for(unsigned c = 0; c < 3; ++c)
+        acc->col[c] = shz_vec4_add(shz_vec4_scale(c0, rot.col[c].x),
+                                   shz_vec4_add(shz_vec4_scale(c1, rot.col[c].y),
+                                                shz_vec4_scale(c2, rot.col[c].z)));
+}
+
+/* Post-multiplies the accumulated transform by a perspective projection,
+   which only scales and swaps its columns. */
+SHZ_FORCE_INLINE void shz_chain_fold_perspective_(shz_mat4x4_t* acc, float fov, float aspect, float znear) {
+    const shz_sincos_t sc  = shz_sincosf(fov * 0.5f);
+    const float        cot = shz_divf(sc.cos, sc.sin);
+    const shz_vec4_t   c2  = acc->col[2];
+
+    acc->col[0] = shz_vec4_scale(acc->col[0], shz_divf(cot, aspect));
+    acc->col[1] = shz_vec4_scale(acc->col[1], cot);
+    acc->col[2] = shz_vec4_scale(acc->col[3], -1.0f);
+    acc->col[3] = shz_vec4_scale(c2, znear);
+}
+
+const shz_mat4x4_t* shz_chain_compile(shz_chain_t* chain) SHZ_NOEXCEPT {
+    if(!chain->dirty && chain->count == chain->compiled)
+        return &chain->matrix;
+
+    shz_mat4x4_t acc;
+    bool         identity = true; // Whether nothing has been accumulated yet.
+
+    shz_chain_identity_(&acc);
+
+    for(size_t o = 0; o < chain->count; ++o) {
+        const shz_chain_op_t* op = &chain->ops[o];
+
+        switch(op->type) {
+        case SHZ_CHAIN_TRANSLATE:
+            shz_chain_fold_translate_(&acc, op->args[0], op->args[1], op->args[2]);
+            break;
+        case SHZ_CHAIN_SCALE:
+            shz_chain_fold_scale_(&acc, op->args[0], op->args[1], op->args[2]);
+            break;
+        case SHZ_CHAIN_ROTATE_X:
+            shz_chain_fold_rotate_(&acc.col[1], &acc.col[2], op->args[0]);
+            break;
+        case SHZ_CHAIN_ROTATE_Y:
+            shz_chain_fold_rotate_(&acc.col[2], &acc.col[0], op->args[0]);
+            break;
+        case SHZ_CHAIN_ROTATE_Z:
+            shz_chain_fold_rotate_(&acc.col[0], &acc.col[1], op->args[0]);
+            break;
+        case SHZ_CHAIN_ROTATE_QUAT:
+            shz_chain_fold_quat_(&acc, shz_quat_init(op->args[0], op->args[1], op->args[2], op->args[3]));
+            break;
+        case SHZ_CHAIN_SCREEN: {
+            // Offsets by half of the viewport, then scales by it, flipping Y.
+            const float hw = op->args[0] * 0.5f;
+            const float hh = op->args[1] * 0.5f;
+
+            shz_chain_fold_translate_(&acc, hw, hh, 0.0f);
+            shz_chain_fold_scale_(&acc, hw, -hh, 1.0f);
+            break;
+        }
+        case SHZ_CHAIN_PERSPECTIVE:
+            shz_chain_fold_perspective_(&acc, op->args[0], op->args[1], op->args[2]);
+            break;
+        case SHZ_CHAIN_MATRIX:
+            // Only arbitrary matrices require a full multiplication.
+            if(identity)
+                acc = *op->matrix;
+            else {
+                shz_xmtrx_load_apply_4x4(&acc, op->matrix);
+                shz_xmtrx_store_4x4(&acc);
+            }
+            break;
+        }
+
+        identity = false;
+    }
+
+    chain->matrix   = acc;
+    chain->compiled = chain->count;
+    chain->dirty    = false;
+
+    return &chain->matrix;
+}
+
+void shz_chain_load(shz_chain_t* chain) SHZ_NOEXCEPT {
+    shz_xmtrx_load_4x4(shz_chain_compile(chain));
+}
+
+void shz_chain_apply(shz_chain_t* chain) SHZ_NOEXCEPT {
+    if(!chain->dirty && chain->count == chain->compiled) {
+        shz_xmtrx_apply_4x4(&chain->matrix);
+        return;
+    }
+
+    // Compiling may clobber XMTRX, so its current contents are saved beforehand.
+    shz_mat4x4_t saved;
+
+    shz_xmtrx_store_4x4(&saved);
+    shz_xmtrx_load_apply_4x4(&saved, shz_chain_compile(chain));
+}
@@ -0,0 +1,269 @@
+/*! \file
+    \brief Clipping implementation.
+    \ingroup clip
+
+    This file contains the implementation of the out-of-line routines
+    within the Clipping API.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#include "sh4zam/shz_clip.h"
+#include "sh4zam/shz_color.h"
+
+#include <string.h>
+
+// Maximum number of vertices within a triangle clipped against every plane.
+#define SHZ_CLIP_POLYGON_MAX_   (3 + 6)
+
+// Maximum number of vertices created while clipping a triangle against every plane.
+#define SHZ_CLIP_CREATED_MAX_   (2 * 6)
+
+// Loads the clip-space position of a vertex.
+SHZ_FORCE_INLINE shz_vec4_t shz_clip_position_(const shz_clip_layout_t* layout, const uint8_t* vertex) {
+    shz_vec4_t pos;
+
+    memcpy(&pos, vertex + layout->position, sizeof(pos));
+
+    return pos;
+}
+
+// Returns the signed distance of a position from the plane at bit \p p, which is negative outside of it.
+SHZ_FORCE_INLINE float shz_clip_distance_(shz_vec4_t pos, unsigned p) {
+    const float axis = pos.e[p >> 1];
+
+    return (p & 1)? pos.w - axis : pos.w + axis;
+}
+
+// Writes the vertex \p t of the way from \p from to \p to into \p dst, copying anything not within the layout from \p from.
+static void shz_clip_interpolate_(const shz_clip_layout_t* layout,
+                                  uint8_t*                 dst,
+                                  const uint8_t*           from,
+                                  const uint8_t*           to,
+                                  float                    t)
+{
+    const shz_vec4_t pos = shz_vec4_lerp(shz_clip_position_(layout, from), shz_clip_position_(layout, to), t);
+
+    memcpy(dst, from, layout->stride);
+    memcpy(dst + layout->position, &pos, sizeof(pos));
+
+    for(size_t a = 0; a < layout->attrib_count; ++a) {
+        const shz_clip_attrib_t* attrib = &layout->attribs[a];
+
+        for(size_t c = 0; c < attrib->count; ++c) {
+            const size_t offset = attrib->offset + c * 4;
+
+            if(attrib->type == SHZ_CLIP_ATTRIB_FLOAT) {
+                float f[2];
+
+                memcpy(&f[0], from + offset, sizeof(float));
+                memcpy(&f[1], to + offset, sizeof(float));
+                f[0] = shz_lerpf(f[0], f[1], t);
+                memcpy(dst + offset, &f[0], sizeof(float));
+            } else {
+                uint32_t argb[2];
+
+                memcpy(&argb[0], from + offset, sizeof(uint32_t));
+                memcpy(&argb[1], to + offset, sizeof(uint32_t));
+                argb[0] = shz_color_lerp(argb[0], argb[1], t);
+                memcpy(dst + offset, &argb[0], sizeof(uint32_t));
+            }
+        }
+    }
+}
+
+// Clips a triangle straddling the given planes, fanning what remains of it into \p out, and returns the number of vertices written.
+static size_t shz_clip_polygon_(const shz_clip_layout_t* layout,
+                                const uint8_t*           v0,
+                                const uint8_t*           v1,
+                                const uint8_t*           v2,
+                                uint8_t                  planes,
+                                uint8_t*                 out)
+{
+    SHZ_ALIGNAS(8) uint8_t created[SHZ_CLIP_CREATED_MAX_][SHZ_CLIP_VERTEX_SIZE_MAX];
+    const uint8_t*         polygon[2][SHZ_CLIP_POLYGON_MAX_];
+    unsigned               count   = 3;
+    unsigned               current = 0;
+    unsigned               used    = 0;
+
+    polygon[0][0] = v0;
+    polygon[0][1] = v1;
+    polygon[0][2] = v2;
+
+    for(unsigned p = 0; p < 6; ++p) {
+        if(!(planes & (1u << p)))
+            continue;
+
+        const uint8_t** src  = polygon[current];
+        const uint8_t** dst  = polygon[current ^ 1];
+        unsigned        kept = 0;
+        float           dist[SHZ_CLIP_POLYGON_MAX_];
+
+        for(unsigned v = 0; v < count; ++v)
+            dist[v] = shz_clip_distance_(shz_clip_position_(layout, src[v]), p);
+
+        // Sutherland-Hodgman, interpolating from the inside vertex so shared edges clip identically.
+        for(unsigned v = 0; v < count; ++v) {
+            const unsigned n = (v + 1 == count)? 0 : v + 1;
+
+            if(dist[v] >= 0.0f)
+                dst[kept++] = src[v];
+
+            if((dist[v] >= 0.0f) != (dist[n] >= 0.0f)) {
+                uint8_t* vertex = created[used++];
+
+                if(dist[v] >= 0.0f)
+                    shz_clip_interpolate_(layout, vertex, src[v], src[n], shz_divf(dist[v], dist[v] - dist[n]));
+                else
+                    shz_clip_interpolate_(layout, vertex, src[n], src[v], shz_divf(dist[n], dist[n] - dist[v]));
+
+                dst[kept++] = vertex;
+            }
+        }
+
+        if(kept < 3)
+            return 0;
+
+        count    = kept;
+        current ^= 1;
+    }
+
+    const uint8_t** src = polygon[current];
+
+    for(unsigned v = 1; v + 1 < count; ++v) {
+        memcpy(out, src[0], layout->stride);
+        out += layout->stride;
+        memcpy(out, src[v], layout->stride);
+        out += layout->stride;
+        memcpy(out, src[v + 1], layout->stride);
+        out += layout->stride;
+    }
+
+    return (count - 2) * 3;
+}
+
+// Clips a single triangle given its outcodes, returning the number of vertices written to \p out.
+SHZ_FORCE_INLINE size_t shz_clip_triangle_(const shz_clip_layout_t* layout,
+                                           const uint8_t*           v0,
+                                           const uint8_t*           v1,
+                                           const uint8_t*           v2,
+                                           uint8_t                  c0,
+                                           uint8_t                  c1,
+                                           uint8_t                  c2,
+                                           uint8_t                  planes,
+                                           uint8_t*                 out)
+{
+    if(c0 & c1 & c2)
+        return 0;
+
+    const uint8_t straddled = (c0 | c1 | c2) & planes;
+
+    if(!straddled) {
+        memcpy(out, v0, layout->stride);
+        memcpy(out + layout->stride, v1, layout->stride);
+        memcpy(out + layout->stride * 2, v2, layout->stride);
+
+        return 3;
+    }
+
+    return shz_clip_polygon_(layout, v0, v1, v2, straddled, out);
+}
+
+SHZ_HOT
+uint8_t shz_clip_outcodes(const shz_clip_layout_t* layout,
+                          const void*              vertices,
+                          size_t                   count,
+                          uint8_t*                 outcodes) SHZ_NOEXCEPT
+{
+    const uint8_t* vertex   = (const uint8_t*)vertices + layout->position;
+    const size_t   stride   = layout->stride;
+    uint8_t        combined = 0;
+
+    for(size_t v = 0; v < count; ++v) {
+        SHZ_PREFETCH(vertex + stride * 2);
+
+        shz_vec4_t pos;
+        memcpy(&pos, vertex, sizeof(pos));
+
+        const uint8_t code = shz_clip_outcode(pos);
+
+        outcodes[v] = code;
+        combined   |= code;
+        vertex     += stride;
+    }
+
+    return combined;
+}
+
+SHZ_HOT
+size_t shz_clip_triangles(const shz_clip_layout_t* layout,
+                          const void*              vertices,
+                          const uint8_t*           outcodes,
+                          size_t                   count,
+                          uint8_t                  planes,
+                          void*                    out) SHZ_NOEXCEPT
+{
+    const uint8_t* vertex  = (const uint8_t*)vertices;
+    uint8_t*       dst     = (uint8_t*)out;
+    const size_t   stride  = layout->stride;
+    size_t         run     = 0;
+    size_t         written = 0;
+
+    // Runs of consecutive accepted triangles are left contiguous, to be copied over all at once.
+    for(size_t t = 0; t + 2 < count; t += 3) {
+        const uint8_t c0 = outcodes[t], c1 = outcodes[t + 1], c2 = outcodes[t + 2];
+
+        if(!(c0 & c1 & c2) && !((c0 | c1 | c2) & planes)) {
+            run += 3;
+            continue;
+        }
+
+        memcpy(dst, vertex + (t - run) * stride, run * stride);
+        dst += run * stride;
+        written += run;
+        run = 0;
+
+        const size_t added = shz_clip_triangle_(layout,
+                                                vertex + t * stride, vertex + (t + 1) * stride, vertex + (t + 2) * stride,
+                                                c0, c1, c2, planes, dst);
+
+        dst     += added * stride;
+        written += added;
+    }
+
+    memcpy(dst, vertex + (count - count % 3 - run) * stride, run * stride);
+
+    return written + run;
+}
+
+SHZ_HOT
+size_t shz_clip_strip(const shz_clip_layout_t* layout,
+                      const void*              vertices,
+                      const uint8_t*           outcodes,
+                      size_t                   count,
+                      uint8_t                  planes,
+                      void*                    out) SHZ_NOEXCEPT
+{
+    const uint8_t* vertex  = (const uint8_t*)vertices;
+    uint8_t*       dst     = (uint8_t*)out;
+    const size_t   stride  = layout->stride;
+    size_t         written = 0;
+
+    for(size_t t = 0; t + 2 < count; ++t) {
+        // Every odd triangle within a strip has its first two vertices swapped to keep the same winding.
+        const size_t  a     = (t & 1)? 1 : 0;
+        const size_t  b     = a ^ 1;
+        const size_t  added = shz_clip_triangle_(layout,
+                                                 vertex + stride * a, vertex + stride * b, vertex + stride * 2,
+                                                 outcodes[t + a], outcodes[t + b], outcodes[t + 2],
+                                                 planes, dst);
+
+        dst     += added * stride;
+        written += added;
+        vertex  += stride;
+    }
+
+    return written;
+}
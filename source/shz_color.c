@@ -0,0 +1,270 @@
+/*! \file
+    \brief Color implementation.
+    \ingroup color
+
+    This file contains the implementation of the out-of-line routines
+    within the Color API.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#include "sh4zam/shz_color.h"
+
+// 4x4 Bayer matrix, with thresholds from 0 to 15.
+static const uint8_t shz_color_bayer_[4][4] = {
+    {  0,  8,  2, 10 },
+    { 12,  4, 14,  6 },
+    {  3, 11,  1,  9 },
+    { 15,  7, 13,  5 }
+};
+
+#if SHZ_BACKEND == SHZ_X86
+
+// Swaps between <R, G, B, A> and the <B, G, R, A> byte order of ARGB8888 in memory.
+SHZ_FORCE_INLINE __m128 shz_color_swizzle_(__m128 v) {
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 1, 2));
+}
+
+void shz_color_pack_array(uint32_t* dst, const shz_vec4_t* src, size_t count) SHZ_NOEXCEPT {
+    const __m128 scale = _mm_set1_ps(255.0f);
+    size_t       i     = 0;
+
+    // Packing down to 16 then 8 bits with saturation clamps each channel for free.
+    for(; i + 4 <= count; i += 4) {
+        const __m128i c0 = _mm_cvtps_epi32(_mm_mul_ps(shz_color_swizzle_(_mm_loadu_ps(src[i + 0].e)), scale));
+        const __m128i c1 = _mm_cvtps_epi32(_mm_mul_ps(shz_color_swizzle_(_mm_loadu_ps(src[i + 1].e)), scale));
+        const __m128i c2 = _mm_cvtps_epi32(_mm_mul_ps(shz_color_swizzle_(_mm_loadu_ps(src[i + 2].e)), scale));
+        const __m128i c3 = _mm_cvtps_epi32(_mm_mul_ps(shz_color_swizzle_(_mm_loadu_ps(src[i + 3].e)), scale));
+
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_packus_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3)));
+    }
+
+    for(; i < count; ++i)
+        dst[i] = shz_color_pack(src[i]);
+}
+
+void shz_color_unpack_array(shz_vec4_t* dst, const uint32_t* src, size_t count) SHZ_NOEXCEPT {
+    const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+    size_t       i     = 0;
+
+    for(; i + 4 <= count; i += 4) {
+        const __m128i c = _mm_loadu_si128((const __m128i*)&src[i]);
+
+        _mm_storeu_ps(dst[i + 0].e, shz_color_swizzle_(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(c)), scale)));
+        _mm_storeu_ps(dst[i + 1].e, shz_color_swizzle_(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(c, 4))), scale)));
+        _mm_storeu_ps(dst[i + 2].e, shz_color_swizzle_(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(c, 8))), scale)));
+        _mm_storeu_ps(dst[i + 3].e, shz_color_swizzle_(_mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(c, 12))), scale)));
+    }
+
+    for(; i < count; ++i)
+        dst[i] = shz_color_unpack(src[i]);
+}
+
+void shz_color_lerp_array(uint32_t* dst, const uint32_t* a, const uint32_t* b, size_t count, float t) SHZ_NOEXCEPT {
+    const uint32_t tb   = shz_color_weight_(t);
+    const __m128i  wa   = _mm_set1_epi16((short)(256 - tb));
+    const __m128i  wb   = _mm_set1_epi16((short)tb);
+    const __m128i  zero = _mm_setzero_si128();
+    size_t         i    = 0;
+
+    // Each channel is widened to 16 bits, which holds a full 8.8 product without overflowing.
+    for(; i + 4 <= count; i += 4) {
+        const __m128i va = _mm_loadu_si128((const __m128i*)&a[i]);
+        const __m128i vb = _mm_loadu_si128((const __m128i*)&b[i]);
+        const __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(va, zero), wa),
+                                                        _mm_mullo_epi16(_mm_unpacklo_epi8(vb, zero), wb)), 8);
+        const __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(va, zero), wa),
+                                                        _mm_mullo_epi16(_mm_unpackhi_epi8(vb, zero), wb)), 8);
+
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_packus_epi16(lo, hi));
+    }
+
+    for(; i < count; ++i)
+        dst[i] = shz_color_lerp_fixed_(a[i], b[i], tb);
+}
+
+// Exactly rounds x * y / 255 for each 16-bit lane.
+SHZ_FORCE_INLINE __m128i shz_color_modulate_epi16_(__m128i x, __m128i y) {
+    const __m128i p = _mm_add_epi16(_mm_mullo_epi16(x, y), _mm_set1_epi16(128));
+
+    return _mm_srli_epi16(_mm_add_epi16(p, _mm_srli_epi16(p, 8)), 8);
+}
+
+void shz_color_modulate_array(uint32_t* dst, const uint32_t* a, const uint32_t* b, size_t count) SHZ_NOEXCEPT {
+    const __m128i zero = _mm_setzero_si128();
+    size_t        i    = 0;
+
+    for(; i + 4 <= count; i += 4) {
+        const __m128i va = _mm_loadu_si128((const __m128i*)&a[i]);
+        const __m128i vb = _mm_loadu_si128((const __m128i*)&b[i]);
+        const __m128i lo = shz_color_modulate_epi16_(_mm_unpacklo_epi8(va, zero), _mm_unpacklo_epi8(vb, zero));
+        const __m128i hi = shz_color_modulate_epi16_(_mm_unpackhi_epi8(va, zero), _mm_unpackhi_epi8(vb, zero));
+
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_packus_epi16(lo, hi));
+    }
+
+    for(; i < count; ++i)
+        dst[i] = shz_color_modulate(a[i], b[i]);
+}
+
+void shz_color_add_array(uint32_t* dst, const uint32_t* a, const uint32_t* b, size_t count) SHZ_NOEXCEPT {
+    size_t i = 0;
+
+    for(; i + 4 <= count; i += 4)
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_adds_epu8(_mm_loadu_si128((const __m128i*)&a[i]),
+                                                          _mm_loadu_si128((const __m128i*)&b[i])));
+
+    for(; i < count; ++i)
+        dst[i] = shz_color_add(a[i], b[i]);
+}
+
+#else
+
+/* Without SIMD, each color is blended within a single integer register,
+   with the blends which are cheap enough unrolled by two so the loads of
+   one color overlap the arithmetic of the other. */
+void shz_color_pack_array(uint32_t* dst, const shz_vec4_t* src, size_t count) SHZ_NOEXCEPT {
+    for(size_t i = 0; i < count; ++i) {
+        SHZ_PREFETCH(&src[i + 2]);
+        dst[i] = shz_color_pack(src[i]);
+    }
+}
+
+void shz_color_unpack_array(shz_vec4_t* dst, const uint32_t* src, size_t count) SHZ_NOEXCEPT {
+    for(size_t i = 0; i < count; ++i) {
+        SHZ_PREFETCH(&src[i + 8]);
+        dst[i] = shz_color_unpack(src[i]);
+    }
+}
+
+void shz_color_lerp_array(uint32_t* dst, const uint32_t* a, const uint32_t* b, size_t count, float t) SHZ_NOEXCEPT {
+    const uint32_t tb = shz_color_weight_(t);
+    size_t         i  = 0;
+
+    for(; i + 2 <= count; i += 2) {
+        SHZ_PREFETCH(&a[i + 8]);
+        SHZ_PREFETCH(&b[i + 8]);
+
+        const uint32_t a0 = a[i], a1 = a[i + 1], b0 = b[i], b1 = b[i + 1];
+
+        dst[i]     = shz_color_lerp_fixed_(a0, b0, tb);
+        dst[i + 1] = shz_color_lerp_fixed_(a1, b1, tb);
+    }
+
+    if(i < count)
+        dst[i] = shz_color_lerp_fixed_(a[i], b[i], tb);
+}
+
+void shz_color_modulate_array(uint32_t* dst, const uint32_t* a, const uint32_t* b, size_t count) SHZ_NOEXCEPT {
+    for(size_t i = 0; i < count; ++i) {
+        SHZ_PREFETCH(&a[i + 8]);
+        SHZ_PREFETCH(&b[i + 8]);
+        dst[i] = shz_color_modulate(a[i], b[i]);
+    }
+}
+
+void shz_color_add_array(uint32_t* dst, const uint32_t* a, const uint32_t* b, size_t count) SHZ_NOEXCEPT {
+    size_t i = 0;
+
+    for(; i + 2 <= count; i += 2) {
+        SHZ_PREFETCH(&a[i + 8]);
+        SHZ_PREFETCH(&b[i + 8]);
+
+        const uint32_t a0 = a[i], a1 = a[i + 1], b0 = b[i], b1 = b[i + 1];
+
+        dst[i]     = shz_color_add(a0, b0);
+        dst[i + 1] = shz_color_add(a1, b1);
+    }
+
+    if(i < count)
+        dst[i] = shz_color_add(a[i], b[i]);
+}
+
+#endif
+
+// The 16-bit conversions are plain shifts and masks, which compilers vectorize on their own.
+void shz_color_to16_array(uint16_t* dst, const uint32_t* src, size_t count, shz_color_format_t format) SHZ_NOEXCEPT {
+    switch(format) {
+    case SHZ_COLOR_ARGB1555:
+        for(size_t i = 0; i < count; ++i)
+            dst[i] = shz_color_to1555_(src[i]);
+        break;
+    case SHZ_COLOR_RGB565:
+        for(size_t i = 0; i < count; ++i)
+            dst[i] = shz_color_to565_(src[i]);
+        break;
+    default:
+        for(size_t i = 0; i < count; ++i)
+            dst[i] = shz_color_to4444_(src[i]);
+        break;
+    }
+}
+
+void shz_color_from16_array(uint32_t* dst, const uint16_t* src, size_t count, shz_color_format_t format) SHZ_NOEXCEPT {
+    switch(format) {
+    case SHZ_COLOR_ARGB1555:
+        for(size_t i = 0; i < count; ++i)
+            dst[i] = shz_color_from1555_(src[i]);
+        break;
+    case SHZ_COLOR_RGB565:
+        for(size_t i = 0; i < count; ++i)
+            dst[i] = shz_color_from565_(src[i]);
+        break;
+    default:
+        for(size_t i = 0; i < count; ++i)
+            dst[i] = shz_color_from4444_(src[i]);
+        break;
+    }
+}
+
+// Quantizes an 8-bit channel down to \p max, adding the 16.16 fixed-point threshold \p bias before truncating.
+SHZ_FORCE_INLINE uint32_t shz_color_quantize_(uint32_t c, unsigned shift, uint32_t max, uint32_t bias) SHZ_NOEXCEPT {
+    return (((c >> shift) & 0xff) * max * 257 + bias) >> 16;
+}
+
+void shz_color_dither16(uint16_t* dst, const uint32_t* src, size_t width, size_t height, shz_color_format_t format) SHZ_NOEXCEPT {
+    for(size_t y = 0; y < height; ++y) {
+        uint32_t bias[4];
+
+        // Thresholds sit at the middle of each of the 16 intervals, so a flat color averages out to itself.
+        for(unsigned x = 0; x < 4; ++x)
+            bias[x] = (shz_color_bayer_[y & 3][x] * 2u + 1u) << 11;
+
+        switch(format) {
+        case SHZ_COLOR_ARGB1555:
+            for(size_t x = 0; x < width; ++x) {
+                const uint32_t c = src[x], b = bias[x & 3];
+
+                dst[x] = (uint16_t)(((c >> 16) & 0x8000) |
+                                    (shz_color_quantize_(c, 16, 31, b) << 10) |
+                                    (shz_color_quantize_(c,  8, 31, b) <<  5) |
+                                    (shz_color_quantize_(c,  0, 31, b) <<  0));
+            }
+            break;
+        case SHZ_COLOR_RGB565:
+            for(size_t x = 0; x < width; ++x) {
+                const uint32_t c = src[x], b = bias[x & 3];
+
+                dst[x] = (uint16_t)((shz_color_quantize_(c, 16, 31, b) << 11) |
+                                    (shz_color_quantize_(c,  8, 63, b) <<  5) |
+                                    (shz_color_quantize_(c,  0, 31, b) <<  0));
+            }
+            break;
+        default:
+            for(size_t x = 0; x < width; ++x) {
+                const uint32_t c = src[x], b = bias[x & 3];
+
+                dst[x] = (uint16_t)((shz_color_quantize_(c, 24, 15, b) << 12) |
+                                    (shz_color_quantize_(c, 16, 15, b) <<  8) |
+                                    (shz_color_quantize_(c,  8, 15, b) <<  4) |
+                                    (shz_color_quantize_(c,  0, 15, b) <<  0));
+            }
+            break;
+        }
+
+        dst += width;
+        src += width;
+    }
+}
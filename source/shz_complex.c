@@ -0,0 +1,760 @@
+/*! \file
+    \brief Non-inlined Complex API implementations.
+    \ingroup complex
+
+    This file contains the non-inlined functions implementing the FFT plan,
+    DCT, STFT, and FIR filter APIs, which are shared between every back-end.
+
+    Each transform is a radix-2 decimation-in-time FFT. The inputs are first
+    permuted by the plan's bit-reversal table, either while copying them into
+    the destination or by swapping them in-place, then every butterfly looks
+    its twiddle factor up from the plan's table, which holds half a revolution
+    of `e^(-2*PI*i*k / size)` values for the largest stage. Smaller stages
+    stride through the same table, and inverse transforms conjugate it.
+
+    Real transforms of size N pack their samples into a complex signal of
+    size N / 2, whose spectrum is then separated into those of the even and
+    odd samples and recombined, so they share the tables of the full plan.
+
+    DCTs reorder their input so that a real FFT of the same size, or a
+    complex FFT of half the size in the case of the DCT-IV, produces a
+    spectrum which only needs to be rotated by a quarter-wave twiddle table
+    to become the cosine transform. MDCTs fold their input into a DCT-IV.
+
+    STFTs keep the last frame of samples in a ring buffer, so producing a
+    frame never shifts samples around: the window is applied while reading
+    the ring in two contiguous runs, starting from its oldest sample, then
+    the frame's real FFT is converted into the output scale in one batch.
+
+    FIR filters carve all of their buffers out of a single block of caller
+    storage. Direct-form filters keep the last `taps - 1` input samples in
+    front of the current block, so every output tile is a run of contiguous
+    multiply-accumulates against the time-reversed coefficients. FFT filters
+    transform each block of input once, then multiply-accumulate its
+    spectrum against the spectra of every partition of the impulse response.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#include "sh4zam/shz_complex.h"
+
+// Number of twiddle factors generated per batch when initializing plans.
+#define SHZ_FFT_PLAN_TWIDDLE_BATCH  32
+
+void shz_fft_plan_init(shz_fft_plan_t* plan, size_t size, void* storage) SHZ_NOEXCEPT {
+    // Size must be a power-of-two which still fits within the 16-bit tables.
+    assert(size >= 2 && size <= 65536 && !(size & (size - 1)));
+
+    shz_complex_t* twiddles = (shz_complex_t*)storage;
+    uint16_t*      bitrev   = (uint16_t*)(twiddles + size / 2);
+    const uint32_t step     = 65536 / size;
+    unsigned       bits     = 0;
+
+    while((1u << bits) < size)
+        ++bits;
+
+    plan->size     = size;
+    plan->twiddles = twiddles;
+    plan->bitrev   = bitrev;
+
+    // Angles are whole multiples of 1/65536th of a revolution, which are exact for 16-bit angles.
+    for(size_t k = 0; k < size / 2; k += SHZ_FFT_PLAN_TWIDDLE_BATCH) {
+        uint16_t angles[SHZ_FFT_PLAN_TWIDDLE_BATCH];
+        float    sins[SHZ_FFT_PLAN_TWIDDLE_BATCH];
+        float    coss[SHZ_FFT_PLAN_TWIDDLE_BATCH];
+        size_t   count = size / 2 - k;
+
+        if(count > SHZ_FFT_PLAN_TWIDDLE_BATCH)
+            count = SHZ_FFT_PLAN_TWIDDLE_BATCH;
+
+        for(size_t i = 0; i < count; ++i)
+            angles[i] = (uint16_t)(0u - (uint32_t)(k + i) * step);
+
+        shz_sincosu16_array(sins, coss, angles, count);
+
+        for(size_t i = 0; i < count; ++i)
+            twiddles[k + i] = shz_cinitf(coss[i], sins[i]);
+    }
+
+    for(size_t i = 0; i < size; ++i) {
+        uint32_t rev = 0;
+
+        for(unsigned b = 0; b < bits; ++b)
+            rev |= ((i >> b) & 1u) << (bits - 1 - b);
+
+        bitrev[i] = (uint16_t)rev;
+    }
+}
+
+// Runs a complex FFT of the given size, which may be a fraction of the plan's size.
+static void shz_fft_execute_(const shz_fft_plan_t* plan, shz_complex_t* dst, const shz_complex_t* src,
+                             size_t size, unsigned rev_shift, bool inverse) SHZ_NOEXCEPT {
+    const uint16_t*      bitrev   = plan->bitrev;
+    const shz_complex_t* twiddles = plan->twiddles;
+    // Conjugating the twiddle factors flips the direction of the transform.
+    const float          sign     = inverse? 1.0f : -1.0f;
+
+    if(dst != src) {
+        for(size_t i = 0; i < size; ++i)
+            dst[i] = src[bitrev[i] >> rev_shift];
+    } else {
+        for(size_t i = 0; i < size; ++i) {
+            const size_t j = bitrev[i] >> rev_shift;
+
+            if(i < j) {
+                const shz_complex_t tmp = dst[i];
+                dst[i] = dst[j];
+                dst[j] = tmp;
+            }
+        }
+    }
+
+    // The first stage only ever multiplies by 1.
+    SHZ_IVDEP
+    for(size_t i = 0; i < size; i += 2) {
+        const shz_complex_t even = dst[i];
+        const shz_complex_t odd  = dst[i + 1];
+
+        dst[i]     = shz_cinitf(even.real + odd.real, even.imag + odd.imag);
+        dst[i + 1] = shz_cinitf(even.real - odd.real, even.imag - odd.imag);
+    }
+
+    // The second stage only ever multiplies by 1 or -i, or by i when inverting.
+    SHZ_IVDEP
+    for(size_t i = 0; i + 3 < size; i += 4) {
+        const shz_complex_t e0 = dst[i],     e1 = dst[i + 1];
+        const shz_complex_t o0 = dst[i + 2], o1 = dst[i + 3];
+        const shz_complex_t t1 = shz_cinitf(-sign * o1.imag, sign * o1.real);
+
+        dst[i]     = shz_cinitf(e0.real + o0.real, e0.imag + o0.imag);
+        dst[i + 2] = shz_cinitf(e0.real - o0.real, e0.imag - o0.imag);
+        dst[i + 1] = shz_cinitf(e1.real + t1.real, e1.imag + t1.imag);
+        dst[i + 3] = shz_cinitf(e1.real - t1.real, e1.imag - t1.imag);
+    }
+
+    for(size_t len = 8; len <= size; len <<= 1) {
+        const size_t half   = len / 2;
+        const size_t stride = plan->size / len;
+
+        for(size_t i = 0; i < size; i += len) {
+            shz_complex_t* even = &dst[i];
+            shz_complex_t* odd  = &dst[i + half];
+
+            SHZ_IVDEP
+            for(size_t k = 0; k < half; ++k) {
+                const float         w_real = twiddles[k * stride].real;
+                const float         w_imag = twiddles[k * stride].imag * -sign;
+                const shz_complex_t e      = even[k];
+                const shz_complex_t o      = odd[k];
+                const float         t_real = o.real * w_real - o.imag * w_imag;
+                const float         t_imag = o.real * w_imag + o.imag * w_real;
+
+                even[k] = shz_cinitf(e.real + t_real, e.imag + t_imag);
+                odd[k]  = shz_cinitf(e.real - t_real, e.imag - t_imag);
+            }
+        }
+    }
+
+    if(inverse) {
+        const float scale = 1.0f / (float)size;
+
+        SHZ_IVDEP
+        for(size_t i = 0; i < size; ++i)
+            dst[i] = shz_cinitf(dst[i].real * scale, dst[i].imag * scale);
+    }
+}
+
+void shz_fft_forward(const shz_fft_plan_t* plan, shz_complex_t* dst, const shz_complex_t* src) SHZ_NOEXCEPT {
+    shz_fft_execute_(plan, dst, src, plan->size, 0, false);
+}
+
+void shz_fft_inverse(const shz_fft_plan_t* plan, shz_complex_t* dst, const shz_complex_t* src) SHZ_NOEXCEPT {
+    shz_fft_execute_(plan, dst, src, plan->size, 0, true);
+}
+
+void shz_fft_real_forward(const shz_fft_plan_t* plan, shz_complex_t* dst, const float* src) SHZ_NOEXCEPT {
+    const shz_complex_t* twiddles = plan->twiddles;
+    const size_t         half     = plan->size / 2;
+
+    assert(plan->size >= 4);
+
+    // Even samples become the real components, odd samples the imaginary ones.
+    shz_fft_execute_(plan, dst, (const shz_complex_t*)src, half, 1, false);
+
+    const shz_complex_t z0 = dst[0];
+    dst[0]    = shz_cinitf(z0.real + z0.imag, 0.0f);
+    dst[half] = shz_cinitf(z0.real - z0.imag, 0.0f);
+
+    for(size_t k = 1; k <= half / 2; ++k) {
+        const shz_complex_t a = dst[k];
+        const shz_complex_t b = dst[half - k];
+        const shz_complex_t w = twiddles[k];
+        // Spectra of the even and odd samples, separated by conjugate symmetry.
+        const float even_real = (a.real + b.real) * 0.5f;
+        const float even_imag = (a.imag - b.imag) * 0.5f;
+        const float odd_real  = (a.imag + b.imag) * 0.5f;
+        const float odd_imag  = (b.real - a.real) * 0.5f;
+        const float t_real    = odd_real * w.real - odd_imag * w.imag;
+        const float t_imag    = odd_real * w.imag + odd_imag * w.real;
+
+        dst[k]        = shz_cinitf(even_real + t_real, even_imag + t_imag);
+        dst[half - k] = shz_cinitf(even_real - t_real, t_imag - even_imag);
+    }
+}
+
+void shz_fft_real_inverse(const shz_fft_plan_t* plan, float* dst, const shz_complex_t* src) SHZ_NOEXCEPT {
+    const shz_complex_t* twiddles = plan->twiddles;
+    const size_t         half     = plan->size / 2;
+    shz_complex_t*       z        = (shz_complex_t*)dst;
+
+    assert(plan->size >= 4);
+
+    z[0] = shz_cinitf((src[0].real + src[half].real) * 0.5f,
+                      (src[0].real - src[half].real) * 0.5f);
+
+    for(size_t k = 1; k <= half / 2; ++k) {
+        const shz_complex_t a = src[k];
+        const shz_complex_t b = src[half - k];
+        const shz_complex_t w = twiddles[k];
+        const float even_real = (a.real + b.real) * 0.5f;
+        const float even_imag = (a.imag - b.imag) * 0.5f;
+        const float d_real    = (a.real - b.real) * 0.5f;
+        const float d_imag    = (a.imag + b.imag) * 0.5f;
+        // Multiplying by the conjugate twiddle undoes the forward recombination.
+        const float odd_real  = d_real * w.real + d_imag * w.imag;
+        const float odd_imag  = d_imag * w.real - d_real * w.imag;
+
+        z[k]        = shz_cinitf(even_real - odd_imag, even_imag + odd_real);
+        z[half - k] = shz_cinitf(even_real + odd_imag, odd_real - even_imag);
+    }
+
+    shz_fft_execute_(plan, z, z, half, 1, true);
+}
+
+// Number of twiddle factors generated per batch when initializing DCT plans.
+#define SHZ_DCT_PLAN_TWIDDLE_BATCH  32
+
+// Fills the table with e^(-i * (offset + step * k)) for each index, k.
+static void shz_dct_twiddles_(shz_complex_t* table, size_t count, float offset, float step) SHZ_NOEXCEPT {
+    for(size_t k = 0; k < count; k += SHZ_DCT_PLAN_TWIDDLE_BATCH) {
+        float  angles[SHZ_DCT_PLAN_TWIDDLE_BATCH];
+        float  sins[SHZ_DCT_PLAN_TWIDDLE_BATCH];
+        float  coss[SHZ_DCT_PLAN_TWIDDLE_BATCH];
+        size_t batch = count - k;
+
+        if(batch > SHZ_DCT_PLAN_TWIDDLE_BATCH)
+            batch = SHZ_DCT_PLAN_TWIDDLE_BATCH;
+
+        for(size_t i = 0; i < batch; ++i)
+            angles[i] = offset + step * (float)(k + i);
+
+        shz_sincosf_array(sins, coss, angles, batch);
+
+        for(size_t i = 0; i < batch; ++i)
+            table[k + i] = shz_cinitf(coss[i], -sins[i]);
+    }
+}
+
+void shz_dct_plan_init(shz_dct_plan_t* plan, size_t size, void* storage) SHZ_NOEXCEPT {
+    assert(size >= 4);
+
+    const size_t   half = size / 2;
+    shz_complex_t* base = (shz_complex_t*)((char*)storage + SHZ_FFT_PLAN_STORAGE_SIZE(size));
+
+    shz_fft_plan_init(&plan->fft, size, storage);
+
+    plan->size     = size;
+    plan->twiddles = base;
+    plan->pre      = plan->twiddles + half + 1;
+    plan->post     = plan->pre + half;
+    plan->spectrum = plan->post + half;
+    plan->samples  = (float*)(plan->spectrum + half + 1);
+
+    shz_dct_twiddles_(plan->twiddles, half + 1, 0.0f,                        SHZ_F_PI / (float)(2 * size));
+    shz_dct_twiddles_(plan->pre,      half,     SHZ_F_PI / (float)(4 * size), SHZ_F_PI / (float)size);
+    shz_dct_twiddles_(plan->post,     half,     0.0f,                        SHZ_F_PI / (float)size);
+}
+
+void shz_dct2(shz_dct_plan_t* plan, float* dst, const float* src) SHZ_NOEXCEPT {
+    const size_t         size     = plan->size;
+    const size_t         half     = size / 2;
+    const shz_complex_t* twiddles = plan->twiddles;
+    shz_complex_t*       spectrum = plan->spectrum;
+    float*               samples  = plan->samples;
+
+    // Even samples ascend through the first half while odd samples descend through the second.
+    for(size_t n = 0; n < half; ++n) {
+        samples[n]            = src[2 * n];
+        samples[size - 1 - n] = src[2 * n + 1];
+    }
+
+    shz_fft_real_forward(&plan->fft, spectrum, samples);
+
+    dst[0]    = spectrum[0].real;
+    dst[half] = spectrum[half].real * twiddles[half].real;
+
+    for(size_t k = 1; k < half; ++k) {
+        const shz_complex_t c = shz_cmulf(spectrum[k], twiddles[k]);
+
+        dst[k]        =  c.real;
+        dst[size - k] = -c.imag;
+    }
+}
+
+void shz_dct3(shz_dct_plan_t* plan, float* dst, const float* src) SHZ_NOEXCEPT {
+    const size_t         size     = plan->size;
+    const size_t         half     = size / 2;
+    const shz_complex_t* twiddles = plan->twiddles;
+    shz_complex_t*       spectrum = plan->spectrum;
+    float*               samples  = plan->samples;
+
+    // Undoes the rotation applied by shz_dct2(), rebuilding the spectrum of the reordered samples.
+    spectrum[0]    = shz_cinitf(src[0], 0.0f);
+    spectrum[half] = shz_cinitf(src[half] / twiddles[half].real, 0.0f);
+
+    for(size_t k = 1; k < half; ++k)
+        spectrum[k] = shz_cmulf(shz_cinitf(src[k], -src[size - k]), shz_conjf(twiddles[k]));
+
+    shz_fft_real_inverse(&plan->fft, samples, spectrum);
+
+    for(size_t n = 0; n < half; ++n) {
+        dst[2 * n]     = samples[n];
+        dst[2 * n + 1] = samples[size - 1 - n];
+    }
+}
+
+void shz_dct4(shz_dct_plan_t* plan, float* dst, const float* src) SHZ_NOEXCEPT {
+    const size_t         size     = plan->size;
+    const size_t         half     = size / 2;
+    const shz_complex_t* pre      = plan->pre;
+    const shz_complex_t* post     = plan->post;
+    shz_complex_t*       spectrum = plan->spectrum;
+
+    // Pairs samples from both ends into a rotated complex signal of half the size.
+    for(size_t n = 0; n < half; ++n)
+        spectrum[n] = shz_cmulf(shz_cinitf(src[2 * n], src[size - 1 - 2 * n]), pre[n]);
+
+    shz_fft_execute_(&plan->fft, spectrum, spectrum, half, 1, false);
+
+    for(size_t k = 0; k < half; ++k) {
+        const shz_complex_t c = shz_cmulf(spectrum[k], post[k]);
+
+        dst[2 * k]            =  c.real;
+        dst[size - 1 - 2 * k] = -c.imag;
+    }
+}
+
+void shz_mdct(shz_dct_plan_t* plan, float* dst, const float* src) SHZ_NOEXCEPT {
+    const size_t size    = plan->size;
+    const size_t half    = size / 2;
+    float*       samples = plan->samples;
+
+    // Folds the four quarters of the input, (a, b, c, d), into (-c_r - d, a - b_r).
+    for(size_t n = 0; n < half; ++n) {
+        samples[n]        = -src[3 * half - 1 - n] - src[3 * half + n];
+        samples[half + n] =  src[n] - src[size - 1 - n];
+    }
+
+    shz_dct4(plan, dst, samples);
+}
+
+void shz_imdct(shz_dct_plan_t* plan, float* dst, const float* src) SHZ_NOEXCEPT {
+    const size_t size    = plan->size;
+    const size_t half    = size / 2;
+    const float  scale   = 2.0f / (float)size;
+    float*       samples = plan->samples;
+
+    shz_dct4(plan, samples, src);
+
+    // Unfolds the two halves of the result, (y1, y2), into (y2, -y2_r, -y1_r, -y1).
+    for(size_t n = 0; n < half; ++n) {
+        dst[n]            =  samples[half + n]     * scale;
+        dst[half + n]     = -samples[size - 1 - n] * scale;
+        dst[size + n]     = -samples[half - 1 - n] * scale;
+        dst[3 * half + n] = -samples[n]            * scale;
+    }
+}
+
+void shz_cabsf_array(float* dst, const shz_complex_t* src, size_t count) SHZ_NOEXCEPT {
+    SHZ_IVDEP
+    for(size_t i = 0; i < count; ++i) {
+        const float norm = src[i].real * src[i].real + src[i].imag * src[i].imag;
+        const float mag  = shz_sqrtf_fsrra(norm);
+        // Equivalent to shz_sqrtf(), but evaluated unconditionally so the select is branchless.
+        dst[i] = (norm == 0.0f)? 0.0f : mag;
+    }
+}
+
+void shz_cnormf_array(float* dst, const shz_complex_t* src, size_t count) SHZ_NOEXCEPT {
+    SHZ_IVDEP
+    for(size_t i = 0; i < count; ++i)
+        dst[i] = src[i].real * src[i].real + src[i].imag * src[i].imag;
+}
+
+// Power corresponding to the -200dB floor of shz_cdbf_array().
+#define SHZ_CDBF_POWER_FLOOR    1e-20f
+
+void shz_cdbf_array(float* dst, const shz_complex_t* src, size_t count) SHZ_NOEXCEPT {
+    SHZ_IVDEP
+    for(size_t i = 0; i < count; ++i) {
+        const float norm = src[i].real * src[i].real + src[i].imag * src[i].imag;
+        // 20 * log10(|z|) == 10 * log10(|z|^2), which saves the square root.
+        dst[i] = 10.0f * shz_log10f_tier((norm < SHZ_CDBF_POWER_FLOOR)? SHZ_CDBF_POWER_FLOOR : norm,
+                                         SHZ_PRECISION_BALANCED);
+    }
+}
+
+// Number of window coefficients generated per batch.
+#define SHZ_WINDOW_BATCH    32
+
+void shz_window_init(float* dst, size_t size, shz_window_t window) SHZ_NOEXCEPT {
+    // Every supported window is a sum of cosines, a0 - a1 * cos(x) + a2 * cos(2x).
+    float a0 = 1.0f, a1 = 0.0f, a2 = 0.0f;
+
+    switch(window) {
+    case SHZ_WINDOW_HANN:     a0 = 0.5f;  a1 = 0.5f;  break;
+    case SHZ_WINDOW_HAMMING:  a0 = 0.54f; a1 = 0.46f; break;
+    case SHZ_WINDOW_BLACKMAN: a0 = 0.42f; a1 = 0.5f;  a2 = 0.08f; break;
+    default: break;
+    }
+
+    const float step = 2.0f * SHZ_F_PI / (float)size;
+
+    for(size_t n = 0; n < size; n += SHZ_WINDOW_BATCH) {
+        float  angles[SHZ_WINDOW_BATCH];
+        float  sins[SHZ_WINDOW_BATCH];
+        float  coss[SHZ_WINDOW_BATCH];
+        size_t batch = size - n;
+
+        if(batch > SHZ_WINDOW_BATCH)
+            batch = SHZ_WINDOW_BATCH;
+
+        for(size_t i = 0; i < batch; ++i)
+            angles[i] = step * (float)(n + i);
+
+        shz_sincosf_array(sins, coss, angles, batch);
+
+        // cos(2x) == 2 * cos(x)^2 - 1
+        for(size_t i = 0; i < batch; ++i)
+            dst[n + i] = a0 - a1 * coss[i] + a2 * (2.0f * coss[i] * coss[i] - 1.0f);
+    }
+}
+
+void shz_stft_init(shz_stft_t* stft, size_t size, size_t hop, shz_window_t window,
+                   shz_stft_scale_t scale, void* storage) SHZ_NOEXCEPT {
+    assert(hop >= 1 && hop <= size);
+
+    shz_fft_plan_init(&stft->plan, size, storage);
+
+    stft->size     = size;
+    stft->hop      = hop;
+    stft->scale    = scale;
+    stft->spectrum = (shz_complex_t*)((char*)storage + SHZ_FFT_PLAN_STORAGE_SIZE(size));
+    stft->ring     = (float*)(stft->spectrum + size / 2 + 1);
+    stft->window   = stft->ring + size;
+    stft->frame    = stft->window + size;
+
+    shz_window_init(stft->window, size, window);
+    shz_stft_reset(stft);
+}
+
+void shz_stft_reset(shz_stft_t* stft) SHZ_NOEXCEPT {
+    stft->head  = 0;
+    stft->until = stft->size;
+
+    for(size_t i = 0; i < stft->size; ++i)
+        stft->ring[i] = 0.0f;
+}
+
+// Windows and transforms the samples within the ring buffer, writing one frame in the output scale.
+static void shz_stft_frame_(shz_stft_t* stft, float* dst) SHZ_NOEXCEPT {
+    const size_t size   = stft->size;
+    const size_t head   = stft->head;
+    const size_t tail   = size - head;
+    const float* ring   = stft->ring;
+    const float* window = stft->window;
+    float*       frame  = stft->frame;
+
+    SHZ_IVDEP
+    for(size_t i = 0; i < tail; ++i)
+        frame[i] = ring[head + i] * window[i];
+
+    SHZ_IVDEP
+    for(size_t i = 0; i < head; ++i)
+        frame[tail + i] = ring[i] * window[tail + i];
+
+    shz_fft_real_forward(&stft->plan, stft->spectrum, frame);
+
+    switch(stft->scale) {
+    case SHZ_STFT_SCALE_POWER:
+        shz_cnormf_array(dst, stft->spectrum, size / 2 + 1);
+        break;
+    case SHZ_STFT_SCALE_DECIBELS:
+        shz_cdbf_array(dst, stft->spectrum, size / 2 + 1);
+        break;
+    default:
+        shz_cabsf_array(dst, stft->spectrum, size / 2 + 1);
+        break;
+    }
+}
+
+size_t shz_stft_process(shz_stft_t* stft, float* frames, const float* src, size_t count) SHZ_NOEXCEPT {
+    const size_t size    = stft->size;
+    float*       ring    = stft->ring;
+    size_t       written = 0;
+
+    while(count) {
+        // Never runs past the next frame, which is at most one ring buffer away.
+        const size_t n     = (count < stft->until)? count : stft->until;
+        const size_t first = (n < size - stft->head)? n : size - stft->head;
+
+        for(size_t i = 0; i < first; ++i)
+            ring[stft->head + i] = src[i];
+
+        for(size_t i = first; i < n; ++i)
+            ring[i - first] = src[i];
+
+        stft->head  = (stft->head + n) & (size - 1);
+        stft->until -= n;
+
+        if(!stft->until) {
+            shz_stft_frame_(stft, &frames[written++ * (size / 2 + 1)]);
+            stft->until = stft->hop;
+        }
+
+        src   += n;
+        count -= n;
+    }
+
+    return written;
+}
+
+// Number of outputs accumulated at once by direct-form filters, which fits within the registers of every back-end.
+#define SHZ_FIR_DIRECT_TILE     8
+
+// Carves each of the filter's buffers out of storage, returning the total size. Only sizes are computed without storage.
+static size_t shz_fir_layout_(shz_fir_t* fir, size_t taps, size_t block_size,
+                              shz_fir_method_t method, char* storage) SHZ_NOEXCEPT {
+    size_t offset = 0;
+
+#define SHZ_FIR_CARVE_(member, type, count) \
+    do { \
+        if(storage) fir->member = (type*)(storage + offset); \
+        offset += ((count) * sizeof(type) + 7) & ~(size_t)7; \
+    } while(0)
+
+    if(method == SHZ_FIR_METHOD_DIRECT) {
+        SHZ_FIR_CARVE_(coeffs, float, taps);
+        SHZ_FIR_CARVE_(input,  float, taps - 1 + block_size);
+    } else {
+        const size_t partitions = (taps + block_size - 1) / block_size;
+        const size_t bins       = block_size + 1;
+
+        if(storage) fir->plan.twiddles = (shz_complex_t*)(storage + offset);
+        offset += SHZ_FFT_PLAN_STORAGE_SIZE(2 * block_size);
+
+        SHZ_FIR_CARVE_(responses, shz_complex_t, partitions * bins);
+        SHZ_FIR_CARVE_(history,   shz_complex_t, partitions * bins);
+        SHZ_FIR_CARVE_(accum,     shz_complex_t, bins);
+        SHZ_FIR_CARVE_(input,     float,         2 * block_size);
+        SHZ_FIR_CARVE_(output,    float,         block_size);
+        SHZ_FIR_CARVE_(frame,     float,         2 * block_size);
+    }
+
+#undef SHZ_FIR_CARVE_
+
+    return offset;
+}
+
+SHZ_FORCE_INLINE shz_fir_method_t shz_fir_method_(size_t taps, shz_fir_method_t method) SHZ_NOEXCEPT {
+    if(method == SHZ_FIR_METHOD_AUTO)
+        return (taps >= SHZ_FIR_FFT_MIN_TAPS)? SHZ_FIR_METHOD_FFT : SHZ_FIR_METHOD_DIRECT;
+
+    return method;
+}
+
+size_t shz_fir_storage_size(size_t taps, size_t block_size, shz_fir_method_t method) SHZ_NOEXCEPT {
+    shz_fir_t fir;
+
+    return shz_fir_layout_(&fir, taps, block_size, shz_fir_method_(taps, method), NULL);
+}
+
+void shz_fir_init(shz_fir_t* fir, const float* coeffs, size_t taps, size_t block_size,
+                  shz_fir_method_t method, void* storage) SHZ_NOEXCEPT {
+    assert(taps && block_size >= 2 && block_size <= 32768 && !(block_size & (block_size - 1)));
+
+    fir->method     = shz_fir_method_(taps, method);
+    fir->taps       = taps;
+    fir->block_size = block_size;
+    fir->partitions = 0;
+    fir->coeffs     = NULL;
+    fir->output     = NULL;
+    fir->frame      = NULL;
+    fir->responses  = NULL;
+    fir->history    = NULL;
+    fir->accum      = NULL;
+
+    shz_fir_layout_(fir, taps, block_size, fir->method, (char*)storage);
+
+    if(fir->method == SHZ_FIR_METHOD_DIRECT) {
+        for(size_t t = 0; t < taps; ++t)
+            fir->coeffs[t] = coeffs[taps - 1 - t];
+    } else {
+        const size_t bins = block_size + 1;
+
+        fir->partitions = (taps + block_size - 1) / block_size;
+        shz_fft_plan_init(&fir->plan, 2 * block_size, fir->plan.twiddles);
+
+        // Each partition is zero-padded to twice the block size, so its linear convolution with a frame doesn't wrap.
+        for(size_t p = 0; p < fir->partitions; ++p) {
+            const size_t first = p * block_size;
+
+            for(size_t i = 0; i < 2 * block_size; ++i)
+                fir->frame[i] = (i < block_size && first + i < taps)? coeffs[first + i] : 0.0f;
+
+            shz_fft_real_forward(&fir->plan, &fir->responses[p * bins], fir->frame);
+        }
+    }
+
+    shz_fir_reset(fir);
+}
+
+void shz_fir_reset(shz_fir_t* fir) SHZ_NOEXCEPT {
+    fir->fill     = 0;
+    fir->position = 0;
+
+    if(fir->method == SHZ_FIR_METHOD_DIRECT) {
+        for(size_t i = 0; i < fir->taps - 1; ++i)
+            fir->input[i] = 0.0f;
+    } else {
+        const size_t bins = fir->block_size + 1;
+
+        for(size_t i = 0; i < 2 * fir->block_size; ++i)
+            fir->input[i] = 0.0f;
+
+        for(size_t i = 0; i < fir->block_size; ++i)
+            fir->output[i] = 0.0f;
+
+        for(size_t i = 0; i < fir->partitions * bins; ++i)
+            fir->history[i] = shz_cinitf(0.0f, 0.0f);
+    }
+}
+
+// Filters up to one block, whose samples have already been appended to the input history.
+static void shz_fir_direct_(shz_fir_t* fir, float* dst, size_t count) SHZ_NOEXCEPT {
+    const float* coeffs = fir->coeffs;
+    const float* input  = fir->input;
+    const size_t taps   = fir->taps;
+    size_t       i      = 0;
+
+    for(; i + SHZ_FIR_DIRECT_TILE <= count; i += SHZ_FIR_DIRECT_TILE) {
+        float acc[SHZ_FIR_DIRECT_TILE] = { 0.0f };
+
+        for(size_t t = 0; t < taps; ++t) {
+            const float  coeff  = coeffs[t];
+            const float* window = &input[i + t];
+
+            SHZ_IVDEP
+            for(size_t o = 0; o < SHZ_FIR_DIRECT_TILE; ++o)
+                acc[o] = shz_fmaf(coeff, window[o], acc[o]);
+        }
+
+        for(size_t o = 0; o < SHZ_FIR_DIRECT_TILE; ++o)
+            dst[i + o] = acc[o];
+    }
+
+    for(; i < count; ++i) {
+        float acc = 0.0f;
+
+        for(size_t t = 0; t < taps; ++t)
+            acc = shz_fmaf(coeffs[t], input[i + t], acc);
+
+        dst[i] = acc;
+    }
+}
+
+// Convolves the completed input block, leaving its filtered output within the output buffer.
+static void shz_fir_fft_block_(shz_fir_t* fir) SHZ_NOEXCEPT {
+    const size_t         block      = fir->block_size;
+    const size_t         bins       = block + 1;
+    const size_t         partitions = fir->partitions;
+    shz_complex_t*       accum      = fir->accum;
+    shz_complex_t*       spectrum   = &fir->history[fir->position * bins];
+
+    shz_fft_real_forward(&fir->plan, spectrum, fir->input);
+
+    for(size_t k = 0; k < bins; ++k)
+        accum[k] = shz_cinitf(0.0f, 0.0f);
+
+    // Partition p of the response meets the input spectrum from p blocks ago.
+    for(size_t p = 0, slot = fir->position; p < partitions; ++p, slot = slot? slot - 1 : partitions - 1) {
+        const shz_complex_t* response = &fir->responses[p * bins];
+        const shz_complex_t* input    = &fir->history[slot * bins];
+
+        SHZ_IVDEP
+        for(size_t k = 0; k < bins; ++k) {
+            const shz_complex_t a = response[k];
+            const shz_complex_t b = input[k];
+
+            accum[k].real += a.real * b.real - a.imag * b.imag;
+            accum[k].imag += a.real * b.imag + a.imag * b.real;
+        }
+    }
+
+    shz_fft_real_inverse(&fir->plan, fir->frame, accum);
+
+    // Only the second half of each frame is free of circular wrap-around.
+    for(size_t i = 0; i < block; ++i) {
+        fir->output[i] = fir->frame[block + i];
+        fir->input[i]  = fir->input[block + i];
+    }
+
+    fir->position = (fir->position + 1 == partitions)? 0 : fir->position + 1;
+}
+
+void shz_fir_process(shz_fir_t* fir, float* dst, const float* src, size_t count) SHZ_NOEXCEPT {
+    const size_t block = fir->block_size;
+
+    if(fir->method == SHZ_FIR_METHOD_DIRECT) {
+        const size_t history = fir->taps - 1;
+
+        while(count) {
+            const size_t n = (count < block)? count : block;
+
+            for(size_t i = 0; i < n; ++i)
+                fir->input[history + i] = src[i];
+
+            shz_fir_direct_(fir, dst, n);
+
+            // Slide the most recent samples back to the front for the next block.
+            for(size_t i = 0; i < history; ++i)
+                fir->input[i] = fir->input[n + i];
+
+            dst   += n;
+            src   += n;
+            count -= n;
+        }
+    } else {
+        while(count) {
+            const size_t n = (count < block - fir->fill)? count : block - fir->fill;
+
+            for(size_t i = 0; i < n; ++i) {
+                fir->input[block + fir->fill + i] = src[i];
+                dst[i] = fir->output[fir->fill + i];
+            }
+
+            fir->fill += n;
+
+            if(fir->fill == block) {
+                shz_fir_fft_block_(fir);
+                fir->fill = 0;
+            }
+
+            dst   += n;
+            src   += n;
+            count -= n;
+        }
+    }
+}
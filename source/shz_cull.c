@@ -0,0 +1,135 @@
+/*! \file
+    \brief Culling implementation.
+    \ingroup cull
+
+    This file contains the implementation of the out-of-line routines
+    within the Culling API.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#include "sh4zam/shz_cull.h"
+#include "sh4zam/shz_xmtrx.h"
+
+// Scales a plane so that its normal is of unit length, leaving degenerate planes untouched.
+SHZ_FORCE_INLINE shz_vec4_t shz_frustum_plane_normalize_(shz_vec4_t plane) {
+    const float mag_sqr = shz_vec3_dot(plane.xyz, plane.xyz);
+
+    return (mag_sqr != 0.0f)? shz_vec4_scale(plane, shz_inv_sqrtf(mag_sqr)) : plane;
+}
+
+void shz_frustum_init_mat4x4(shz_frustum_t* frustum, const shz_mat4x4_t* mat) SHZ_NOEXCEPT {
+    shz_vec4_t row[4];
+
+    for(unsigned r = 0; r < 4; ++r)
+        row[r] = shz_vec4_init(mat->col[0].e[r], mat->col[1].e[r], mat->col[2].e[r], mat->col[3].e[r]);
+
+    // Each pair of planes bounds a clip-space axis, as in -w <= axis <= w.
+    for(unsigned a = 0; a < 3; ++a) {
+        frustum->planes[a * 2 + 0] = shz_frustum_plane_normalize_(shz_vec4_add(row[3], row[a]));
+        frustum->planes[a * 2 + 1] = shz_frustum_plane_normalize_(shz_vec4_sub(row[3], row[a]));
+    }
+}
+
+void shz_frustum_init_xmtrx(shz_frustum_t* frustum) SHZ_NOEXCEPT {
+    shz_mat4x4_t mat;
+
+    shz_xmtrx_store_4x4(&mat);
+    shz_frustum_init_mat4x4(frustum, &mat);
+}
+
+// Returns the first plane rejecting the sphere, beginning from plane \p first, or SHZ_FRUSTUM_PLANE_COUNT if none do.
+SHZ_FORCE_INLINE unsigned shz_frustum_reject_sphere_(const shz_frustum_t* frustum, shz_sphere_t sphere, unsigned first) {
+    const shz_vec4_t center = shz_vec3_vec4(sphere.center, 1.0f);
+    unsigned         p      = first;
+
+    do {
+        if(shz_frustum_plane_rejects_sphere_(frustum->planes[p], center, sphere.radius))
+            return p;
+
+        if(++p == SHZ_FRUSTUM_PLANE_COUNT)
+            p = 0;
+    } while(p != first);
+
+    return SHZ_FRUSTUM_PLANE_COUNT;
+}
+
+// Returns the first plane rejecting the box, beginning from plane \p first, or SHZ_FRUSTUM_PLANE_COUNT if none do.
+SHZ_FORCE_INLINE unsigned shz_frustum_reject_aabb_(const shz_frustum_t* frustum, const shz_aabb_t* aabb, unsigned first) {
+    const shz_vec4_t center = shz_vec3_vec4(aabb->center, 1.0f);
+    unsigned         p      = first;
+
+    do {
+        if(shz_frustum_plane_rejects_aabb_(frustum->planes[p], center, aabb->extents))
+            return p;
+
+        if(++p == SHZ_FRUSTUM_PLANE_COUNT)
+            p = 0;
+    } while(p != first);
+
+    return SHZ_FRUSTUM_PLANE_COUNT;
+}
+
+SHZ_HOT
+size_t shz_frustum_cull_spheres(const shz_frustum_t* frustum,
+                                const shz_sphere_t*  spheres,
+                                size_t               count,
+                                uint32_t*            visible,
+                                uint8_t*             cache) SHZ_NOEXCEPT
+{
+    size_t total = 0;
+
+    for(size_t base = 0; base < count; base += 32) {
+        const size_t end  = (count - base < 32)? count : base + 32;
+        uint32_t     bits = 0;
+
+        for(size_t i = base; i < end; ++i) {
+            SHZ_PREFETCH(&spheres[i + 2]);
+
+            const unsigned plane = shz_frustum_reject_sphere_(frustum, spheres[i], cache? cache[i] : 0);
+
+            if(plane == SHZ_FRUSTUM_PLANE_COUNT) {
+                bits |= 1u << (i - base);
+                ++total;
+            } else if(cache)
+                cache[i] = (uint8_t)plane;
+        }
+
+        visible[base / 32] = bits;
+    }
+
+    return total;
+}
+
+SHZ_HOT
+size_t shz_frustum_cull_aabbs(const shz_frustum_t* frustum,
+                              const shz_aabb_t*    aabbs,
+                              size_t               count,
+                              uint32_t*            visible,
+                              uint8_t*             cache) SHZ_NOEXCEPT
+{
+    size_t total = 0;
+
+    for(size_t base = 0; base < count; base += 32) {
+        const size_t end  = (count - base < 32)? count : base + 32;
+        uint32_t     bits = 0;
+
+        for(size_t i = base; i < end; ++i) {
+            SHZ_PREFETCH(&aabbs[i + 2]);
+
+            const unsigned plane = shz_frustum_reject_aabb_(frustum, &aabbs[i], cache? cache[i] : 0);
+
+            if(plane == SHZ_FRUSTUM_PLANE_COUNT) {
+                bits |= 1u << (i - base);
+                ++total;
+            } else if(cache)
+                cache[i] = (uint8_t)plane;
+        }
+
+        visible[base / 32] = bits;
+    }
+
+    return total;
+}
@@ -0,0 +1,111 @@
+/*! \file
+    \brief Non-inlined Dual Quaternion API implementations.
+    \ingroup dualquat
+
+    This file contains the non-inlined functions implementing the dual
+    quaternion C API, namely screw interpolation and skinning.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#include "sh4zam/shz_dualquat.h"
+#include "shz_skin.h"
+
+// Sine of the half angle below which a relative transform is treated as a pure translation.
+#define SHZ_DUALQUAT_SCLERP_EPSILON 1e-4f
+
+shz_dualquat_t shz_dualquat_sclerp(shz_dualquat_t a, shz_dualquat_t b, float t) SHZ_NOEXCEPT {
+    // Return the endpoints as-is, since the approximate sine and cosine below cannot land on them exactly.
+    if(t == 0.0f)
+        return a;
+    if(t == 1.0f)
+        return b;
+
+    // Negate one of the inputs when they're in opposite hemispheres, to take the shorter screw.
+    if(shz_dualquat_dot(a, b) < 0.0f)
+        b = shz_dualquat_neg(b);
+
+    // Relative transform from a to b, which is raised to the power of t.
+    const shz_dualquat_t d        = shz_dualquat_mult(shz_dualquat_conjugate(a), b);
+    const shz_vec3_t     offset   = shz_dualquat_translation(d);
+    const float          sin_sqr  = shz_vec3_magnitude_sqr(d.real.axis);
+
+    if(sin_sqr < SHZ_DUALQUAT_SCLERP_EPSILON * SHZ_DUALQUAT_SCLERP_EPSILON) {
+        // Without a rotation axis the screw degenerates into a straight line.
+        return shz_dualquat_mult(a,
+                                 shz_dualquat_from_rotation_translation(
+                                    shz_quat_nlerp(shz_quat_identity(), d.real, t),
+                                    shz_vec3_scale(offset, t)));
+    }
+
+    /* Decompose into screw parameters: axis direction, moment, half angle and pitch.
+       Anything coarser than the PRECISE arctangent visibly drifts from b as t nears 1.0f. */
+    const float      inv_sin = shz_inv_sqrtf(sin_sqr);
+    const float      half    = shz_atan2f_tier(sin_sqr * inv_sin, d.real.w, SHZ_PRECISION_PRECISE);
+    const shz_vec3_t axis    = shz_vec3_scale(d.real.axis, inv_sin);
+    const float      pitch   = shz_vec3_dot(offset, axis);
+    const shz_vec3_t moment  = shz_vec3_scale(shz_vec3_add(shz_vec3_cross(offset, axis),
+                                                           shz_vec3_scale(shz_vec3_sub(offset, shz_vec3_scale(axis, pitch)),
+                                                                          d.real.w * inv_sin)),
+                                              0.5f);
+
+    // Scaling both the angle and the pitch by t yields d^t.
+    const shz_sincos_t sc         = shz_sincosf(half * t);
+    const float        half_pitch = 0.5f * pitch * t;
+    const shz_vec3_t   real       = shz_vec3_scale(axis, sc.sin);
+    const shz_vec3_t   dual       = shz_vec3_add(shz_vec3_scale(moment, sc.sin),
+                                                 shz_vec3_scale(axis, half_pitch * sc.cos));
+
+    return shz_dualquat_mult(a,
+                             shz_dualquat_init(shz_quat_init(sc.cos, real.x, real.y, real.z),
+                                               shz_quat_init(-half_pitch * sc.sin, dual.x, dual.y, dual.z)));
+}
+
+SHZ_FORCE_INLINE void shz_skin_load_dualquat_(const void* palette, size_t bone) {
+    shz_mat3x4_t m;
+
+    shz_dualquat_to_mat3x4(((const shz_dualquat_t*)palette)[bone], &m);
+    shz_xmtrx_load_3x4(&m);
+}
+
+SHZ_FORCE_INLINE void shz_skin_single_dualquat_(const void* palette, const shz_skin_influence_t* inf,
+                                                shz_vec3_t* dst_position, const shz_vec3_t* src_position,
+                                                shz_vec3_t* dst_normal, const shz_vec3_t* src_normal) {
+    shz_mat3x4_t m;
+
+    shz_dualquat_to_mat3x4(((const shz_dualquat_t*)palette)[inf->bones[0]], &m);
+    shz_skin_vertex_(m.elem, 3, dst_position, src_position, dst_normal, src_normal);
+}
+
+SHZ_FORCE_INLINE void shz_skin_blend_dualquat_(const void* palette, const shz_skin_influence_t* inf,
+                                               shz_vec3_t* dst_position, const shz_vec3_t* src_position,
+                                               shz_vec3_t* dst_normal, const shz_vec3_t* src_normal) {
+    const shz_dualquat_t* dqs = (const shz_dualquat_t*)palette;
+
+    // Accumulate the weighted bones, flipping those in the opposite hemisphere from the first.
+    const shz_dualquat_t first = dqs[inf->bones[0]];
+    shz_dualquat_t       blend = shz_dualquat_scale(first, inf->weights[0]);
+    shz_mat3x4_t         m;
+
+    for(unsigned b = 1; b < SHZ_SKIN_MAX_INFLUENCES && inf->weights[b] != 0.0f; ++b) {
+        const shz_dualquat_t dq = dqs[inf->bones[b]];
+        const float          w  = (shz_dualquat_dot(first, dq) < 0.0f)? -inf->weights[b] : inf->weights[b];
+
+        blend = shz_dualquat_add(blend, shz_dualquat_scale(dq, w));
+    }
+
+    /* Dividing both parts by the magnitude of the real part is enough, since any
+       component of the dual part parallel to the real part has no effect on translation. */
+    shz_dualquat_to_mat3x4(shz_dualquat_scale(blend, shz_quat_magnitude_inv(blend.real)), &m);
+    shz_skin_vertex_(m.elem, 3, dst_position, src_position, dst_normal, src_normal);
+}
+
+void shz_skin_dualquat(const shz_dualquat_t* palette, const shz_skin_influence_t* influences,
+                       shz_vec3_t* dst_positions, const shz_vec3_t* src_positions,
+                       shz_vec3_t* dst_normals, const shz_vec3_t* src_normals,
+                       size_t count, size_t stride) SHZ_NOEXCEPT {
+    shz_skin_(palette, shz_skin_load_dualquat_, shz_skin_single_dualquat_, shz_skin_blend_dualquat_,
+              influences, dst_positions, src_positions, dst_normals, src_normals, count, stride);
+}
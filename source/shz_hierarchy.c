@@ -0,0 +1,199 @@
+/*! \file
+    \brief Transform hierarchy implementation.
+    \ingroup hierarchy
+
+    This file contains the implementation of the hierarchy update API.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#include "sh4zam/shz_hierarchy.h"
+#include "sh4zam/shz_xmtrx.h"
+
+#include <string.h>
+
+/* Workers require their own XMTRX, so they're only spawned when it's held
+   within thread-specific storage, for host builds. */
+#if SHZ_BACKEND != SHZ_SH4 && SHZ_TLS_MODEL == SHZ_TLS_PTHREAD
+#   include <pthread.h>
+#   define SHZ_HIERARCHY_THREADS_ 1
+#elif SHZ_BACKEND != SHZ_SH4 && SHZ_TLS_MODEL == SHZ_TLS_CTHREAD
+#   include <threads.h>
+#   define SHZ_HIERARCHY_THREADS_ 1
+#else
+#   define SHZ_HIERARCHY_THREADS_ 0
+#endif
+
+//! Maximum number of threads used to update a single hierarchy.
+#ifndef SHZ_HIERARCHY_MAX_THREADS
+#   define SHZ_HIERARCHY_MAX_THREADS        16
+#endif
+
+//! Minimum number of nodes given to each thread, below which spawning it costs more than it saves.
+#ifndef SHZ_HIERARCHY_THREAD_MIN_NODES
+#   define SHZ_HIERARCHY_THREAD_MIN_NODES   1024
+#endif
+
+// Updates the nodes within [begin, end), none of which may descend from a node outside of it.
+static size_t shz_hierarchy_update_range_(const shz_hierarchy_t* hierarchy, size_t begin, size_t end) {
+    shz_xmtrx_ctx_t*    ctx     = shz_xmtrx_ctx_acquire();
+    const uint32_t*     parents = hierarchy->parents;
+    const shz_mat4x4_t* locals  = hierarchy->locals;
+    shz_mat4x4_t*       worlds  = hierarchy->worlds;
+    uint8_t*            dirty   = hierarchy->dirty;
+    uint32_t            loaded  = SHZ_HIERARCHY_ROOT;
+    size_t              updated = 0;
+
+    for(size_t n = begin; n < end; ++n) {
+        const uint32_t parent = parents[n];
+
+        if(parent == SHZ_HIERARCHY_ROOT) {
+            if(!dirty[n])
+                continue;
+
+            worlds[n] = locals[n];
+        } else {
+            // Parents precede their children, so their flags have already been propagated.
+            if(!(dirty[n] |= dirty[parent]))
+                continue;
+
+            // Siblings share the parent transform already resident within XMTRX.
+            if(parent != loaded) {
+                shz_xmtrx_ctx_load_4x4(ctx, &worlds[parent]);
+                loaded = parent;
+            }
+
+            shz_xmtrx_ctx_apply_store_4x4(ctx, &worlds[n], &locals[n]);
+        }
+
+        ++updated;
+    }
+
+    memset(&dirty[begin], 0, end - begin);
+
+    return updated;
+}
+
+size_t shz_hierarchy_update(const shz_hierarchy_t* hierarchy) SHZ_NOEXCEPT {
+    return shz_hierarchy_update_range_(hierarchy, 0, hierarchy->count);
+}
+
+#if SHZ_HIERARCHY_THREADS_
+
+typedef struct shz_hierarchy_worker_ {
+    const shz_hierarchy_t* hierarchy;
+    size_t                 begin;
+    size_t                 end;
+    size_t                 updated;
+} shz_hierarchy_worker_t_;
+
+#   if SHZ_TLS_MODEL == SHZ_TLS_PTHREAD
+typedef pthread_t shz_hierarchy_thread_t_;
+
+static void* shz_hierarchy_worker_(void* arg) {
+    shz_hierarchy_worker_t_* worker = (shz_hierarchy_worker_t_*)arg;
+
+    worker->updated = shz_hierarchy_update_range_(worker->hierarchy, worker->begin, worker->end);
+
+    return NULL;
+}
+
+static bool shz_hierarchy_spawn_(shz_hierarchy_thread_t_* thread, shz_hierarchy_worker_t_* worker) {
+    return pthread_create(thread, NULL, shz_hierarchy_worker_, worker) == 0;
+}
+
+static void shz_hierarchy_join_(shz_hierarchy_thread_t_ thread) {
+    pthread_join(thread, NULL);
+}
+#   else
+typedef thrd_t shz_hierarchy_thread_t_;
+
+static int shz_hierarchy_worker_(void* arg) {
+    shz_hierarchy_worker_t_* worker = (shz_hierarchy_worker_t_*)arg;
+
+    worker->updated = shz_hierarchy_update_range_(worker->hierarchy, worker->begin, worker->end);
+
+    return 0;
+}
+
+static bool shz_hierarchy_spawn_(shz_hierarchy_thread_t_* thread, shz_hierarchy_worker_t_* worker) {
+    return thrd_create(thread, shz_hierarchy_worker_, worker) == thrd_success;
+}
+
+static void shz_hierarchy_join_(shz_hierarchy_thread_t_ thread) {
+    thrd_join(thread, NULL);
+}
+#   endif
+
+size_t shz_hierarchy_update_parallel(const shz_hierarchy_t* hierarchy, unsigned threads) SHZ_NOEXCEPT {
+    const size_t            count = hierarchy->count;
+    size_t                  splits[SHZ_HIERARCHY_MAX_THREADS + 1];
+    shz_hierarchy_worker_t_ workers[SHZ_HIERARCHY_MAX_THREADS];
+    shz_hierarchy_thread_t_ handles[SHZ_HIERARCHY_MAX_THREADS];
+    bool                    spawned[SHZ_HIERARCHY_MAX_THREADS] = { false };
+    size_t                  updated;
+
+    if(threads > SHZ_HIERARCHY_MAX_THREADS)
+        threads = SHZ_HIERARCHY_MAX_THREADS;
+
+    if(threads > count / SHZ_HIERARCHY_THREAD_MIN_NODES)
+        threads = count / SHZ_HIERARCHY_THREAD_MIN_NODES;
+
+    if(threads <= 1)
+        return shz_hierarchy_update(hierarchy);
+
+    /* Scanning backwards while tracking the lowest parent index seen, every
+       node which no later node descends from begins an independent range.
+       Each evenly spaced target is moved forwards to the nearest of them. */
+    uint32_t lowest  = SHZ_HIERARCHY_ROOT;
+    size_t   nearest = count;
+    unsigned target  = threads - 1;
+
+    splits[0]       = 0;
+    splits[threads] = count;
+
+    for(size_t n = count - 1; target; --n) {
+        if(hierarchy->parents[n] < lowest)
+            lowest = hierarchy->parents[n];
+
+        if(lowest >= n)
+            nearest = n;
+
+        if(n == target * count / threads)
+            splits[target--] = nearest;
+    }
+
+    for(unsigned t = 1; t < threads; ++t) {
+        workers[t] = (shz_hierarchy_worker_t_){ hierarchy, splits[t], splits[t + 1], 0 };
+
+        if(splits[t] != splits[t + 1])
+            spawned[t] = shz_hierarchy_spawn_(&handles[t], &workers[t]);
+
+        // Update the range on this thread when a worker is unavailable.
+        if(!spawned[t])
+            workers[t].updated = shz_hierarchy_update_range_(hierarchy, workers[t].begin, workers[t].end);
+    }
+
+    updated = shz_hierarchy_update_range_(hierarchy, splits[0], splits[1]);
+
+    for(unsigned t = 1; t < threads; ++t) {
+        if(spawned[t])
+            shz_hierarchy_join_(handles[t]);
+
+        updated += workers[t].updated;
+    }
+
+    return updated;
+}
+
+#else
+
+size_t shz_hierarchy_update_parallel(const shz_hierarchy_t* hierarchy, unsigned threads) SHZ_NOEXCEPT {
+    (void)threads;
+
+    return shz_hierarchy_update(hierarchy);
+}
+
+#endif
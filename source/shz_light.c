@@ -0,0 +1,178 @@
+/*! \file
+    \brief Lighting implementation.
+    \ingroup light
+
+    This file contains the implementation of the out-of-line routines
+    within the Lighting API.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#include "sh4zam/shz_light.h"
+
+#include <string.h>
+
+// Maximum number of groups of three directional lights.
+#define SHZ_LIGHT_GROUPS_MAX_   ((SHZ_LIGHTS_MAX + 2) / 3)
+
+// Three directional lights, padded with black lights facing nowhere, evaluated with a single shz_vec3_dot3().
+typedef struct shz_light_group_ {
+    shz_vec3_t to_light[3];
+    shz_vec3_t color[3];
+} shz_light_group_t_;
+
+// Point or spot light, with point lights given no axis, so their cone term is skipped.
+typedef struct shz_light_local_ {
+    shz_vec3_t position;
+    shz_vec3_t axis;
+    shz_vec3_t color;
+    shz_vec3_t attenuation;
+    float      cos_outer;
+    float      inv_cone;
+    bool       spot;
+} shz_light_local_t_;
+
+// Clamps to [0.0f, 1.0f] with plain comparisons, which never become calls to fminf() or fmaxf().
+SHZ_FORCE_INLINE float shz_light_saturate_(float x) {
+    x = (x > 0.0f)? x : 0.0f;
+    return (x < 1.0f)? x : 1.0f;
+}
+
+// Packs an RGB color, already saturated, with the given alpha byte into ARGB8888.
+SHZ_FORCE_INLINE uint32_t shz_light_pack_(shz_vec3_t rgb, uint32_t alpha) {
+    return (alpha << 24) |
+           ((uint32_t)(rgb.x * 255.0f + 0.5f) << 16) |
+           ((uint32_t)(rgb.y * 255.0f + 0.5f) <<  8) |
+           ((uint32_t)(rgb.z * 255.0f + 0.5f) <<  0);
+}
+
+SHZ_HOT
+void shz_lighting_apply(const shz_lighting_t* lighting,
+                        const shz_vec3_t*     positions,
+                        const shz_vec3_t*     normals,
+                        size_t                count,
+                        size_t                stride,
+                        uint32_t*             colors,
+                        size_t                color_stride) SHZ_NOEXCEPT
+{
+    shz_light_group_t_ groups[SHZ_LIGHT_GROUPS_MAX_];
+    shz_light_local_t_ locals[SHZ_LIGHTS_MAX];
+    unsigned           directional = 0;
+    unsigned           local_count = 0;
+
+    memset(groups, 0, sizeof(groups));
+
+    // Sort the lights by type up-front, so the loop over vertices only ever runs the kernel each needs.
+    for(size_t l = 0; l < lighting->light_count && l < SHZ_LIGHTS_MAX; ++l) {
+        const shz_light_t* light = &lighting->lights[l];
+
+        if(light->type == SHZ_LIGHT_DIRECTIONAL) {
+            shz_light_group_t_* group = &groups[directional / 3];
+
+            group->to_light[directional % 3] = shz_vec3_neg(light->direction);
+            group->color[directional % 3]    = light->color;
+            ++directional;
+        } else {
+            shz_light_local_t_* local = &locals[local_count++];
+
+            local->position    = light->position;
+            local->color       = light->color;
+            local->attenuation = light->attenuation;
+            local->spot        = (light->type == SHZ_LIGHT_SPOT);
+
+            if(local->spot) {
+                local->axis      = light->direction;
+                local->cos_outer = light->cos_outer;
+                local->inv_cone  = shz_divf(1.0f, shz_fmaxf(light->cos_inner - light->cos_outer, 1e-6f));
+            } else {
+                local->axis      = shz_vec3_init(0.0f, 0.0f, 0.0f);
+                local->cos_outer = 0.0f;
+                local->inv_cone  = 0.0f;
+            }
+        }
+    }
+
+    const unsigned   group_count = (directional + 2) / 3;
+    const shz_fog_t* fog         = &lighting->fog;
+    const shz_vec3_t fog_color   = shz_vec3_clamp(fog->color, 0.0f, 1.0f);
+    float            fog_scale   = 0.0f;
+    float            fog_bias    = 1.0f;
+    const uint32_t   alpha       = (uint32_t)(shz_saturatef(lighting->alpha) * 255.0f + 0.5f);
+    const uint8_t*   position    = (const uint8_t*)positions;
+    const uint8_t*   normal      = (const uint8_t*)normals;
+    uint8_t*         color       = (uint8_t*)colors;
+
+    // Linear fog becomes a single multiply-add per vertex, while exponential fog is prescaled by its density.
+    if(fog->mode == SHZ_FOG_LINEAR) {
+        fog_scale = shz_divf(-1.0f, fog->end - fog->start);
+        fog_bias  = -fog->end * fog_scale;
+    } else if(fog->mode == SHZ_FOG_EXP) {
+        fog_scale = -fog->density;
+    }
+
+    if(!stride)
+        stride = sizeof(shz_vec3_t);
+
+    if(!color_stride)
+        color_stride = sizeof(uint32_t);
+
+    for(size_t v = 0; v < count; ++v) {
+        SHZ_PREFETCH(normal + stride * 2);
+
+        shz_vec3_t p, n;
+        memcpy(&p, position, sizeof(p));
+        memcpy(&n, normal, sizeof(n));
+
+        shz_vec3_t rgb = lighting->ambient;
+
+        for(unsigned g = 0; g < group_count; ++g) {
+            const shz_light_group_t_* group = &groups[g];
+            const shz_vec3_t          ndl   = shz_vec3_dot3(n, group->to_light[0], group->to_light[1], group->to_light[2]);
+
+            rgb = shz_vec3_add(rgb, shz_vec3_scale(group->color[0], (ndl.x > 0.0f)? ndl.x : 0.0f));
+            rgb = shz_vec3_add(rgb, shz_vec3_scale(group->color[1], (ndl.y > 0.0f)? ndl.y : 0.0f));
+            rgb = shz_vec3_add(rgb, shz_vec3_scale(group->color[2], (ndl.z > 0.0f)? ndl.z : 0.0f));
+        }
+
+        for(unsigned l = 0; l < local_count; ++l) {
+            const shz_light_local_t_* local = &locals[l];
+            const shz_vec3_t          d     = shz_vec3_sub(local->position, p);
+
+            // <N . D, D . D, D . axis> from one multi-dot, with D left unnormalized until the end.
+            const shz_vec3_t dots = shz_vec3_dot3(d, n, d, local->axis);
+
+            if(dots.x <= 0.0f)
+                continue;
+
+            const float inv_dist  = shz_inv_sqrtf(dots.y);
+            float       intensity = dots.x * inv_dist * shz_invf(local->attenuation.x +
+                                                                 local->attenuation.y * dots.y * inv_dist +
+                                                                 local->attenuation.z * dots.y);
+
+            if(local->spot)
+                intensity *= shz_light_saturate_((-dots.z * inv_dist - local->cos_outer) * local->inv_cone);
+
+            rgb = shz_vec3_add(rgb, shz_vec3_scale(local->color, intensity));
+        }
+
+        rgb = shz_vec3_init(shz_light_saturate_(rgb.x), shz_light_saturate_(rgb.y), shz_light_saturate_(rgb.z));
+
+        if(fog->mode != SHZ_FOG_NONE) {
+            const float depth  = shz_vec3_dot(fog->plane.xyz, p) + fog->plane.w;
+            const float factor = (fog->mode == SHZ_FOG_LINEAR)?
+                                     shz_light_saturate_(shz_fmaf(depth, fog_scale, fog_bias)) :
+                                     shz_light_exp_(((depth > 0.0f)? depth : 0.0f) * fog_scale);
+
+            rgb = shz_vec3_lerp(fog_color, rgb, factor);
+        }
+
+        const uint32_t argb = shz_light_pack_(rgb, alpha);
+        memcpy(color, &argb, sizeof(argb));
+
+        position += stride;
+        normal   += stride;
+        color    += color_stride;
+    }
+}
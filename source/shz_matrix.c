@@ -12,6 +12,7 @@
 
 #include "sh4zam/shz_matrix.h"
 #include "sh4zam/shz_mem.h"
+#include "shz_skin.h"
 
 void shz_mat4x4_inverse_block_triangular(const shz_mat4x4_t* mtrx, shz_mat4x4_t* out) {
     alignas(32) shz_mat3x3_t invM;
@@ -81,7 +82,7 @@ void shz_mat4x4_inverse(const shz_mat4x4_t* SHZ_RESTRICT mtrx, shz_mat4x4_t* SHZ
                                    shz_dot6f(c[1], -c[11], -c[5], c[6], c[4], c[10]));
 
     shz_vec2_t c1c5c9 =
-        shz_vec3_dot2(shz_vec3_init(c[0], c[4], c[8]),
+        shz_vec3_dot2(shz_vec3_init(c[0], -c[4], c[8]),
                       shz_vec3_init(mtrx->elem2D[1][1], mtrx->elem2D[1][2], mtrx->elem2D[1][3]),
                       shz_vec3_init(mtrx->elem2D[0][1], mtrx->elem2D[0][2], mtrx->elem2D[0][3]));
 
@@ -89,7 +90,7 @@ void shz_mat4x4_inverse(const shz_mat4x4_t* SHZ_RESTRICT mtrx, shz_mat4x4_t* SHZ
     out->elem2D[0][1] = -c1c5c9.y * inv_det;
 
     shz_vec2_t c2c6c10 =
-        shz_vec3_dot2(shz_vec3_init(c[1], c[5], c[9]),
+        shz_vec3_dot2(shz_vec3_init(c[1], -c[5], c[9]),
                       shz_vec3_init(mtrx->elem2D[3][1], mtrx->elem2D[3][2], mtrx->elem2D[3][3]),
                       shz_vec3_init(mtrx->elem2D[2][1], mtrx->elem2D[2][2], mtrx->elem2D[2][3]));
 
@@ -97,7 +98,7 @@ void shz_mat4x4_inverse(const shz_mat4x4_t* SHZ_RESTRICT mtrx, shz_mat4x4_t* SHZ
     out->elem2D[0][3] = -c2c6c10.y * inv_det;
 
     shz_vec2_t c1c3c11 =
-        shz_vec3_dot2(shz_vec3_init(c[0], c[2], c[10]),
+        shz_vec3_dot2(shz_vec3_init(c[0], -c[2], c[10]),
                       shz_vec3_init(mtrx->elem2D[1][0], mtrx->elem2D[1][2], mtrx->elem2D[1][3]),
                       shz_vec3_init(mtrx->elem2D[0][0], mtrx->elem2D[0][2], mtrx->elem2D[0][3]));
 
@@ -105,7 +106,7 @@ void shz_mat4x4_inverse(const shz_mat4x4_t* SHZ_RESTRICT mtrx, shz_mat4x4_t* SHZ
     out->elem2D[1][1] = +c1c3c11.y * inv_det;
 
     shz_vec2_t c2c4c12 =
-        shz_vec3_dot2(shz_vec3_init(c[1], c[3], c[11]),
+        shz_vec3_dot2(shz_vec3_init(c[1], -c[3], c[11]),
                       shz_vec3_init(mtrx->elem2D[3][0], mtrx->elem2D[3][2], mtrx->elem2D[3][3]),
                       shz_vec3_init(mtrx->elem2D[2][0], mtrx->elem2D[2][2], mtrx->elem2D[2][3]));
 
@@ -113,7 +114,7 @@ void shz_mat4x4_inverse(const shz_mat4x4_t* SHZ_RESTRICT mtrx, shz_mat4x4_t* SHZ
     out->elem2D[1][3] = +c2c4c12.y * inv_det;
 
     shz_vec2_t c5c3c7 =
-        shz_vec3_dot2(shz_vec3_init(c[4], c[2], c[6]),
+        shz_vec3_dot2(shz_vec3_init(c[4], -c[2], c[6]),
                       shz_vec3_init(mtrx->elem2D[1][0], mtrx->elem2D[1][1], mtrx->elem2D[1][3]),
                       shz_vec3_init(mtrx->elem2D[0][0], mtrx->elem2D[0][1], mtrx->elem2D[0][3]));
 
@@ -121,7 +122,7 @@ void shz_mat4x4_inverse(const shz_mat4x4_t* SHZ_RESTRICT mtrx, shz_mat4x4_t* SHZ
     out->elem2D[2][1] = -c5c3c7.y * inv_det;
 
     shz_vec2_t c6c4c8 =
-        shz_vec3_dot2(shz_vec3_init(c[5], c[3], c[7]),
+        shz_vec3_dot2(shz_vec3_init(c[5], -c[3], c[7]),
                       shz_vec3_init(mtrx->elem2D[3][0], mtrx->elem2D[3][1], mtrx->elem2D[3][3]),
                       shz_vec3_init(mtrx->elem2D[2][0], mtrx->elem2D[2][1], mtrx->elem2D[2][3]));
 
@@ -129,7 +130,7 @@ void shz_mat4x4_inverse(const shz_mat4x4_t* SHZ_RESTRICT mtrx, shz_mat4x4_t* SHZ
     out->elem2D[2][3] = -c6c4c8.y * inv_det;
 
     shz_vec2_t c9c11c7 =
-        shz_vec3_dot2(shz_vec3_init(c[8], c[10], c[6]),
+        shz_vec3_dot2(shz_vec3_init(c[8], -c[10], c[6]),
                       shz_vec3_init(mtrx->elem2D[1][0], mtrx->elem2D[1][1], mtrx->elem2D[1][2]),
                       shz_vec3_init(mtrx->elem2D[0][0], mtrx->elem2D[0][1], mtrx->elem2D[0][2]));
 
@@ -137,7 +138,7 @@ void shz_mat4x4_inverse(const shz_mat4x4_t* SHZ_RESTRICT mtrx, shz_mat4x4_t* SHZ
     out->elem2D[3][1] = +c9c11c7.y * inv_det;
 
     shz_vec2_t c10c12c8 =
-        shz_vec3_dot2(shz_vec3_init(c[9], c[11], c[7]),
+        shz_vec3_dot2(shz_vec3_init(c[9], -c[11], c[7]),
                       shz_vec3_init(mtrx->elem2D[3][0], mtrx->elem2D[3][1], mtrx->elem2D[3][2]),
                       shz_vec3_init(mtrx->elem2D[2][0], mtrx->elem2D[2][1], mtrx->elem2D[2][2]));
 
@@ -180,3 +181,79 @@ void shz_mat4x4_decompose(const shz_mat4x4_t* mat,
         *rotation = shz_mat4x4_to_quat(&norm);
     }
 }
+
+// Blends the upper 3x4 of each influencing matrix, each holding 4 columns of the given number of rows.
+SHZ_FORCE_INLINE void shz_skin_blend_(const float* palette, size_t rows, const shz_skin_influence_t* inf,
+                                      shz_vec3_t* dst_position, const shz_vec3_t* src_position,
+                                      shz_vec3_t* dst_normal, const shz_vec3_t* src_normal) {
+    const float* mat = &palette[inf->bones[0] * rows * 4];
+    float        m[12];
+
+    for(unsigned c = 0; c < 4; ++c)
+        for(unsigned r = 0; r < 3; ++r)
+            m[c * 3 + r] = mat[c * rows + r] * inf->weights[0];
+
+    for(unsigned b = 1; b < SHZ_SKIN_MAX_INFLUENCES && inf->weights[b] != 0.0f; ++b) {
+        const float w = inf->weights[b];
+
+        mat = &palette[inf->bones[b] * rows * 4];
+
+        for(unsigned c = 0; c < 4; ++c)
+            for(unsigned r = 0; r < 3; ++r)
+                m[c * 3 + r] = shz_fmaf(mat[c * rows + r], w, m[c * 3 + r]);
+    }
+
+    shz_skin_vertex_(m, 3, dst_position, src_position, dst_normal, src_normal);
+}
+
+SHZ_FORCE_INLINE void shz_skin_load_mat4x4_(const void* palette, size_t bone) {
+    shz_xmtrx_load_4x4(&((const shz_mat4x4_t*)palette)[bone]);
+}
+
+SHZ_FORCE_INLINE void shz_skin_single_mat4x4_(const void* palette, const shz_skin_influence_t* inf,
+                                              shz_vec3_t* dst_position, const shz_vec3_t* src_position,
+                                              shz_vec3_t* dst_normal, const shz_vec3_t* src_normal) {
+    shz_skin_vertex_(((const shz_mat4x4_t*)palette)[inf->bones[0]].elem, 4,
+                     dst_position, src_position, dst_normal, src_normal);
+}
+
+SHZ_FORCE_INLINE void shz_skin_blend_mat4x4_(const void* palette, const shz_skin_influence_t* inf,
+                                             shz_vec3_t* dst_position, const shz_vec3_t* src_position,
+                                             shz_vec3_t* dst_normal, const shz_vec3_t* src_normal) {
+    shz_skin_blend_(((const shz_mat4x4_t*)palette)->elem, 4, inf,
+                    dst_position, src_position, dst_normal, src_normal);
+}
+
+SHZ_FORCE_INLINE void shz_skin_load_mat3x4_(const void* palette, size_t bone) {
+    shz_xmtrx_load_3x4(&((const shz_mat3x4_t*)palette)[bone]);
+}
+
+SHZ_FORCE_INLINE void shz_skin_single_mat3x4_(const void* palette, const shz_skin_influence_t* inf,
+                                              shz_vec3_t* dst_position, const shz_vec3_t* src_position,
+                                              shz_vec3_t* dst_normal, const shz_vec3_t* src_normal) {
+    shz_skin_vertex_(((const shz_mat3x4_t*)palette)[inf->bones[0]].elem, 3,
+                     dst_position, src_position, dst_normal, src_normal);
+}
+
+SHZ_FORCE_INLINE void shz_skin_blend_mat3x4_(const void* palette, const shz_skin_influence_t* inf,
+                                             shz_vec3_t* dst_position, const shz_vec3_t* src_position,
+                                             shz_vec3_t* dst_normal, const shz_vec3_t* src_normal) {
+    shz_skin_blend_(((const shz_mat3x4_t*)palette)->elem, 3, inf,
+                    dst_position, src_position, dst_normal, src_normal);
+}
+
+void shz_skin_mat4x4(const shz_mat4x4_t* palette, const shz_skin_influence_t* influences,
+                     shz_vec3_t* dst_positions, const shz_vec3_t* src_positions,
+                     shz_vec3_t* dst_normals, const shz_vec3_t* src_normals,
+                     size_t count, size_t stride) {
+    shz_skin_(palette, shz_skin_load_mat4x4_, shz_skin_single_mat4x4_, shz_skin_blend_mat4x4_,
+              influences, dst_positions, src_positions, dst_normals, src_normals, count, stride);
+}
+
+void shz_skin_mat3x4(const shz_mat3x4_t* palette, const shz_skin_influence_t* influences,
+                     shz_vec3_t* dst_positions, const shz_vec3_t* src_positions,
+                     shz_vec3_t* dst_normals, const shz_vec3_t* src_normals,
+                     size_t count, size_t stride) {
+    shz_skin_(palette, shz_skin_load_mat3x4_, shz_skin_single_mat3x4_, shz_skin_blend_mat3x4_,
+              influences, dst_positions, src_positions, dst_normals, src_normals, count, stride);
+}
@@ -22,3 +22,201 @@ shz_quat_t shz_quat_from_look_axis(shz_vec3_t forward, shz_vec3_t up) SHZ_NOEXCE
 
     return shz_mat4x4_to_quat(&mat);
 }
+
+/* Coefficients of Eberly's polynomial approximation of the SLERP weights
+   ("A Fast and Accurate Algorithm for Computing SLERP"), with
+   u[i] = 1 / (i(2i + 1)) and v[i] = i / (2i + 1), except for the last
+   term, which is scaled by mu to compensate for truncating the series. */
+#define SHZ_QUAT_SLERP_TERMS    8
+#define SHZ_QUAT_SLERP_MU       1.85298109240830f
+
+static const float shz_quat_slerp_u_[SHZ_QUAT_SLERP_TERMS] = {
+    1.0f / (1.0f * 3.0f), 1.0f / (2.0f * 5.0f),  1.0f / (3.0f * 7.0f),  1.0f / (4.0f * 9.0f),
+    1.0f / (5.0f * 11.0f), 1.0f / (6.0f * 13.0f), 1.0f / (7.0f * 15.0f),
+    SHZ_QUAT_SLERP_MU / (8.0f * 17.0f)
+};
+
+static const float shz_quat_slerp_v_[SHZ_QUAT_SLERP_TERMS] = {
+    1.0f / 3.0f,  2.0f / 5.0f,  3.0f / 7.0f,  4.0f / 9.0f,
+    5.0f / 11.0f, 6.0f / 13.0f, 7.0f / 15.0f,
+    SHZ_QUAT_SLERP_MU * 8.0f / 17.0f
+};
+
+// Folds the constant interpolation factor into the coefficients for either endpoint's weight.
+SHZ_FORCE_INLINE void shz_quat_slerp_coeffs_(float coeffs[SHZ_QUAT_SLERP_TERMS], float t) SHZ_NOEXCEPT {
+    const float t2 = t * t;
+
+    for(unsigned i = 0; i < SHZ_QUAT_SLERP_TERMS; ++i)
+        coeffs[i] = shz_fmaf(shz_quat_slerp_u_[i], t2, -shz_quat_slerp_v_[i]);
+}
+
+// Evaluates the nested polynomial 1 + c0 x (1 + c1 x (1 + ... (1 + c7 x))), with x = cos(theta) - 1.
+SHZ_FORCE_INLINE float shz_quat_slerp_poly_(const float coeffs[SHZ_QUAT_SLERP_TERMS], float xm1) SHZ_NOEXCEPT {
+    float p = 1.0f;
+
+    for(int i = SHZ_QUAT_SLERP_TERMS - 1; i >= 0; --i)
+        p = shz_fmaf(coeffs[i] * xm1, p, 1.0f);
+
+    return p;
+}
+
+SHZ_FORCE_INLINE shz_vec3_t shz_pose_lerp_vec3_(shz_vec3_t a, shz_vec3_t b, float t) SHZ_NOEXCEPT {
+    return shz_vec3_init(shz_lerpf(a.x, b.x, t), shz_lerpf(a.y, b.y, t), shz_lerpf(a.z, b.z, t));
+}
+
+/* Shared implementation of the two-pose interpolations. Every flag is a
+   compile-time constant within each caller, so that no bone branches. */
+SHZ_FORCE_INLINE void shz_pose_interp_(const shz_pose_t* dst, const shz_pose_t* a, const shz_pose_t* b,
+                                       float t, size_t bones,
+                                       bool spherical, bool translations, bool scales) SHZ_NOEXCEPT {
+    float coeffs_a[SHZ_QUAT_SLERP_TERMS], coeffs_b[SHZ_QUAT_SLERP_TERMS];
+    const float s = 1.0f - t;
+
+    if(spherical) {
+        shz_quat_slerp_coeffs_(coeffs_a, s);
+        shz_quat_slerp_coeffs_(coeffs_b, t);
+    }
+
+    SHZ_IVDEP
+    for(size_t i = 0; i < bones; ++i) {
+        const shz_quat_t qa = a->rotations[i];
+        const shz_quat_t qb = b->rotations[i];
+        const float      c  = shz_quat_dot(qa, qb);
+        // Flipping the sign of b's weight, rather than b itself, takes the shorter arc.
+        const float      sign = (c < 0.0f)? -1.0f : 1.0f;
+        shz_quat_t       q;
+
+        if(spherical) {
+            const float xm1 = c * sign - 1.0f;
+            const float wa  = s * shz_quat_slerp_poly_(coeffs_a, xm1);
+            const float wb  = t * shz_quat_slerp_poly_(coeffs_b, xm1) * sign;
+
+            q = shz_quat_add(shz_quat_scale(qa, wa), shz_quat_scale(qb, wb));
+        } else {
+            q = shz_quat_normalize(shz_quat_add(shz_quat_scale(qa, s), shz_quat_scale(qb, t * sign)));
+        }
+
+        dst->rotations[i] = q;
+
+        if(translations)
+            dst->translations[i] = shz_pose_lerp_vec3_(a->translations[i], b->translations[i], t);
+
+        if(scales)
+            dst->scales[i] = shz_pose_lerp_vec3_(a->scales[i], b->scales[i], t);
+    }
+}
+
+// Instantiates the two-pose interpolation for whichever optional streams are present.
+SHZ_FORCE_INLINE void shz_pose_interp_dispatch_(const shz_pose_t* dst, const shz_pose_t* a, const shz_pose_t* b,
+                                                float t, size_t bones, bool spherical) SHZ_NOEXCEPT {
+    const bool translations = dst->translations && a->translations && b->translations;
+    const bool scales       = dst->scales && a->scales && b->scales;
+
+    if(translations && scales)
+        shz_pose_interp_(dst, a, b, t, bones, spherical, true, true);
+    else if(translations)
+        shz_pose_interp_(dst, a, b, t, bones, spherical, true, false);
+    else if(scales)
+        shz_pose_interp_(dst, a, b, t, bones, spherical, false, true);
+    else
+        shz_pose_interp_(dst, a, b, t, bones, spherical, false, false);
+}
+
+void shz_pose_slerp(const shz_pose_t* dst, const shz_pose_t* a, const shz_pose_t* b, float t, size_t bones) SHZ_NOEXCEPT {
+    shz_pose_interp_dispatch_(dst, a, b, t, bones, true);
+}
+
+void shz_pose_nlerp(const shz_pose_t* dst, const shz_pose_t* a, const shz_pose_t* b, float t, size_t bones) SHZ_NOEXCEPT {
+    shz_pose_interp_dispatch_(dst, a, b, t, bones, false);
+}
+
+void shz_quat_slerp_array(shz_quat_t* dst, const shz_quat_t* a, const shz_quat_t* b, float t, size_t count) SHZ_NOEXCEPT {
+    const shz_pose_t dst_pose = { dst, NULL, NULL };
+    const shz_pose_t a_pose   = { (shz_quat_t*)a, NULL, NULL };
+    const shz_pose_t b_pose   = { (shz_quat_t*)b, NULL, NULL };
+
+    shz_pose_interp_(&dst_pose, &a_pose, &b_pose, t, count, true, false, false);
+}
+
+void shz_quat_nlerp_array(shz_quat_t* dst, const shz_quat_t* a, const shz_quat_t* b, float t, size_t count) SHZ_NOEXCEPT {
+    const shz_pose_t dst_pose = { dst, NULL, NULL };
+    const shz_pose_t a_pose   = { (shz_quat_t*)a, NULL, NULL };
+    const shz_pose_t b_pose   = { (shz_quat_t*)b, NULL, NULL };
+
+    shz_pose_interp_(&dst_pose, &a_pose, &b_pose, t, count, false, false, false);
+}
+
+// Shared implementation of the n-way blends, with the same constant flags as shz_pose_interp_().
+SHZ_FORCE_INLINE void shz_pose_blend_(const shz_pose_t* dst, const shz_pose_t* srcs, const float* weights,
+                                      size_t sources, size_t bones,
+                                      bool translations, bool scales) SHZ_NOEXCEPT {
+    for(size_t i = 0; i < bones; ++i) {
+        const shz_quat_t first = srcs[0].rotations[i];
+        shz_quat_t       q     = shz_quat_scale(first, weights[0]);
+        shz_vec3_t       tr    = shz_vec3_fill(0.0f);
+        shz_vec3_t       sc    = shz_vec3_fill(0.0f);
+
+        if(translations)
+            tr = shz_vec3_scale(srcs[0].translations[i], weights[0]);
+
+        if(scales)
+            sc = shz_vec3_scale(srcs[0].scales[i], weights[0]);
+
+        for(size_t s = 1; s < sources; ++s) {
+            const shz_quat_t r = srcs[s].rotations[i];
+            const float      w = (shz_quat_dot(first, r) < 0.0f)? -weights[s] : weights[s];
+
+            q = shz_quat_add(q, shz_quat_scale(r, w));
+
+            if(translations)
+                tr = shz_vec3_add(tr, shz_vec3_scale(srcs[s].translations[i], weights[s]));
+
+            if(scales)
+                sc = shz_vec3_add(sc, shz_vec3_scale(srcs[s].scales[i], weights[s]));
+        }
+
+        dst->rotations[i] = shz_quat_normalize(q);
+
+        if(translations)
+            dst->translations[i] = tr;
+
+        if(scales)
+            dst->scales[i] = sc;
+    }
+}
+
+void shz_pose_blend(const shz_pose_t* dst, const shz_pose_t* srcs, const float* weights,
+                    size_t sources, size_t bones) SHZ_NOEXCEPT {
+    bool translations = dst->translations != NULL;
+    bool scales       = dst->scales != NULL;
+
+    for(size_t s = 0; s < sources; ++s) {
+        translations = translations && srcs[s].translations;
+        scales       = scales && srcs[s].scales;
+    }
+
+    if(translations && scales)
+        shz_pose_blend_(dst, srcs, weights, sources, bones, true, true);
+    else if(translations)
+        shz_pose_blend_(dst, srcs, weights, sources, bones, true, false);
+    else if(scales)
+        shz_pose_blend_(dst, srcs, weights, sources, bones, false, true);
+    else
+        shz_pose_blend_(dst, srcs, weights, sources, bones, false, false);
+}
+
+void shz_quat_blend_array(shz_quat_t* dst, const shz_quat_t* const* srcs, const float* weights,
+                          size_t sources, size_t count) SHZ_NOEXCEPT {
+    for(size_t i = 0; i < count; ++i) {
+        const shz_quat_t first = srcs[0][i];
+        shz_quat_t       q     = shz_quat_scale(first, weights[0]);
+
+        for(size_t s = 1; s < sources; ++s) {
+            const shz_quat_t r = srcs[s][i];
+
+            q = shz_quat_add(q, shz_quat_scale(r, (shz_quat_dot(first, r) < 0.0f)? -weights[s] : weights[s]));
+        }
+
+        dst[i] = shz_quat_normalize(q);
+    }
+}
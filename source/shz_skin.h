@@ -0,0 +1,120 @@
+//! \cond INTERNAL
+/*! \file
+    \brief Internal skinning driver shared by every palette type.
+    \ingroup matrix
+
+    This file contains the loop which walks the vertices being skinned,
+    gathering runs influenced by a single bone so that they can be
+    transformed as arrays within XMTRX. Each palette type supplies its
+    own routines for loading a bone and for transforming a lone or
+    blended vertex, which are constant-folded into its copy of the loop.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#ifndef SHZ_SKIN_H
+#define SHZ_SKIN_H
+
+#include "sh4zam/shz_matrix.h"
+#include "sh4zam/shz_xmtrx.h"
+
+// Returns a pointer to the element at the given index of a strided per-vertex array.
+#define SHZ_SKIN_AT_(type, base, stride, index) \
+    ((type*)((char*)(base) + (stride) * (index)))
+
+/* Shortest run of vertices sharing a single bone for which loading its matrix
+   into XMTRX pays off, rather than transforming each vertex directly. */
+#ifndef SHZ_SKIN_XMTRX_MIN_RUN
+#   define SHZ_SKIN_XMTRX_MIN_RUN   2
+#endif
+
+// Loads the matrix of the given bone within a palette into XMTRX.
+typedef void (*shz_skin_load_fn_)(const void* palette, size_t bone);
+
+// Transforms a single vertex by the bones of the palette which influence it, leaving XMTRX untouched.
+typedef void (*shz_skin_vertex_fn_)(const void* palette, const shz_skin_influence_t* influence,
+                                    shz_vec3_t* dst_position, const shz_vec3_t* src_position,
+                                    shz_vec3_t* dst_normal, const shz_vec3_t* src_normal);
+
+// Transforms a single vertex by a column-major matrix of 4 columns with the given number of rows.
+SHZ_FORCE_INLINE void shz_skin_vertex_(const float* m, size_t rows,
+                                       shz_vec3_t* dst_position, const shz_vec3_t* src_position,
+                                       shz_vec3_t* dst_normal, const shz_vec3_t* src_normal) {
+    const shz_vec3_t p = *src_position;
+    const float*     c0 = &m[0], *c1 = &m[rows], *c2 = &m[2 * rows], *c3 = &m[3 * rows];
+
+    *dst_position = shz_vec3_init(c0[0] * p.x + c1[0] * p.y + c2[0] * p.z + c3[0],
+                                  c0[1] * p.x + c1[1] * p.y + c2[1] * p.z + c3[1],
+                                  c0[2] * p.x + c1[2] * p.y + c2[2] * p.z + c3[2]);
+
+    if(dst_normal) {
+        const shz_vec3_t n = *src_normal;
+
+        *dst_normal = shz_vec3_init(c0[0] * n.x + c1[0] * n.y + c2[0] * n.z,
+                                    c0[1] * n.x + c1[1] * n.y + c2[1] * n.z,
+                                    c0[2] * n.x + c1[2] * n.y + c2[2] * n.z);
+    }
+}
+
+/* Skins each vertex by its influences, using \p single for a short run of
+   vertices sharing one bone and \p blend for those with several. */
+SHZ_FORCE_INLINE void shz_skin_(const void* palette,
+                                shz_skin_load_fn_ load, shz_skin_vertex_fn_ single, shz_skin_vertex_fn_ blend,
+                                const shz_skin_influence_t* influences,
+                                shz_vec3_t* dst_positions, const shz_vec3_t* src_positions,
+                                shz_vec3_t* dst_normals, const shz_vec3_t* src_normals,
+                                size_t count, size_t stride) {
+    const size_t inf_stride = stride? stride : sizeof(shz_skin_influence_t);
+    const size_t vec_stride = stride? stride : sizeof(shz_vec3_t);
+    size_t       loaded     = SIZE_MAX;
+    size_t       i          = 0;
+
+    while(i < count) {
+        const shz_skin_influence_t* inf = SHZ_SKIN_AT_(const shz_skin_influence_t, influences, inf_stride, i);
+        shz_vec3_t*       dst_position = SHZ_SKIN_AT_(shz_vec3_t, dst_positions, vec_stride, i);
+        const shz_vec3_t* src_position = SHZ_SKIN_AT_(const shz_vec3_t, src_positions, vec_stride, i);
+        shz_vec3_t*       dst_normal   = dst_normals? SHZ_SKIN_AT_(shz_vec3_t, dst_normals, vec_stride, i) : NULL;
+        const shz_vec3_t* src_normal   = dst_normals? SHZ_SKIN_AT_(const shz_vec3_t, src_normals, vec_stride, i) : NULL;
+
+        if(inf->weights[1] == 0.0f) {
+            const uint8_t bone = inf->bones[0];
+            size_t        run  = 1;
+
+            // Gather the run of vertices which only share this bone.
+            while(i + run < count) {
+                const shz_skin_influence_t* next =
+                    SHZ_SKIN_AT_(const shz_skin_influence_t, influences, inf_stride, i + run);
+
+                if(next->weights[1] != 0.0f || next->bones[0] != bone)
+                    break;
+
+                ++run;
+            }
+
+            if(run < SHZ_SKIN_XMTRX_MIN_RUN && bone != loaded) {
+                single(palette, inf, dst_position, src_position, dst_normal, src_normal);
+            } else {
+                if(bone != loaded) {
+                    load(palette, bone);
+                    loaded = bone;
+                }
+
+                shz_xmtrx_transform_point3_array(dst_position, src_position, run, vec_stride);
+
+                if(dst_normals)
+                    shz_xmtrx_transform_vec3_array(dst_normal, src_normal, run, vec_stride);
+            }
+
+            i += run;
+        } else {
+            blend(palette, inf, dst_position, src_position, dst_normal, src_normal);
+            ++i;
+        }
+    }
+}
+
+#endif // SHZ_SKIN_H
+
+//! \endcond
@@ -0,0 +1,198 @@
+/*! \file
+    \brief Transform implementation.
+    \ingroup transform
+
+    This file contains the implementation of the out-of-line routines
+    within the Transform API.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#include "sh4zam/shz_transform.h"
+
+void shz_transform_init_mat4x4(shz_transform_t* xf, const shz_mat4x4_t* mat) SHZ_NOEXCEPT {
+    const shz_mat4x4_t* m = mat;
+
+    xf->matrix = *mat;
+
+    if(m->col[0].w != 0.0f || m->col[1].w != 0.0f || m->col[2].w != 0.0f || m->col[3].w != 1.0f)
+        xf->kind = SHZ_TRANSFORM_PROJECTIVE;
+    else if(m->col[0].y != 0.0f || m->col[0].z != 0.0f ||
+            m->col[1].x != 0.0f || m->col[1].z != 0.0f ||
+            m->col[2].x != 0.0f || m->col[2].y != 0.0f)
+        xf->kind = SHZ_TRANSFORM_AFFINE;
+    else if(m->col[0].x == 1.0f && m->col[1].y == 1.0f && m->col[2].z == 1.0f)
+        xf->kind = (m->pos.x == 0.0f && m->pos.y == 0.0f && m->pos.z == 0.0f)?
+                        SHZ_TRANSFORM_IDENTITY : SHZ_TRANSFORM_TRANSLATION;
+    else
+        xf->kind = (m->pos.x == 0.0f && m->pos.y == 0.0f && m->pos.z == 0.0f)?
+                        SHZ_TRANSFORM_DIAGONAL : SHZ_TRANSFORM_AFFINE;
+}
+
+void shz_transform_translate(shz_transform_t* xf, float x, float y, float z) SHZ_NOEXCEPT {
+    shz_mat4x4_t* m = &xf->matrix;
+
+    if(xf->kind == SHZ_TRANSFORM_PROJECTIVE)
+        m->pos = shz_vec4_add(m->pos, shz_mat4x4_transform_vec4(m, shz_vec4_init(x, y, z, 0.0f)));
+    else // Only the last column is offset, by the translation as transformed by the 3x3 basis.
+        m->pos.xyz = shz_vec3_add(m->pos.xyz, shz_transform_vec3(xf, shz_vec3_init(x, y, z)));
+
+    xf->kind = shz_transform_kind_mult(xf->kind, SHZ_TRANSFORM_TRANSLATION);
+}
+
+void shz_transform_scale(shz_transform_t* xf, float x, float y, float z) SHZ_NOEXCEPT {
+    shz_mat4x4_t* m = &xf->matrix;
+
+    if(xf->kind == SHZ_TRANSFORM_IDENTITY || xf->kind == SHZ_TRANSFORM_DIAGONAL) {
+        m->col[0].x *= x;
+        m->col[1].y *= y;
+        m->col[2].z *= z;
+    } else {
+        m->col[0] = shz_vec4_scale(m->col[0], x);
+        m->col[1] = shz_vec4_scale(m->col[1], y);
+        m->col[2] = shz_vec4_scale(m->col[2], z);
+    }
+
+    xf->kind = shz_transform_kind_mult(xf->kind, SHZ_TRANSFORM_DIAGONAL);
+}
+
+// Post-multiplies the given transform by an axis rotation, which only mixes the two columns about the axis.
+static void shz_transform_rotate_(shz_transform_t* xf, shz_vec4_t* a, shz_vec4_t* b, float radians) {
+    const shz_sincos_t sc = shz_sincosf(radians);
+    const shz_vec4_t   c0 = *a;
+    const shz_vec4_t   c1 = *b;
+
+    *a = shz_vec4_add(shz_vec4_scale(c0, sc.cos), shz_vec4_scale(c1, sc.sin));
+    *b = shz_vec4_sub(shz_vec4_scale(c1, sc.cos), shz_vec4_scale(c0, sc.sin));
+
+    xf->kind = shz_transform_kind_mult(xf->kind, SHZ_TRANSFORM_RIGID);
+}
+
+void shz_transform_rotate_x(shz_transform_t* xf, float radians) SHZ_NOEXCEPT {
+    shz_transform_rotate_(xf, &xf->matrix.col[1], &xf->matrix.col[2], radians);
+}
+
+void shz_transform_rotate_y(shz_transform_t* xf, float radians) SHZ_NOEXCEPT {
+    shz_transform_rotate_(xf, &xf->matrix.col[2], &xf->matrix.col[0], radians);
+}
+
+void shz_transform_rotate_z(shz_transform_t* xf, float radians) SHZ_NOEXCEPT {
+    shz_transform_rotate_(xf, &xf->matrix.col[0], &xf->matrix.col[1], radians);
+}
+
+void shz_transform_rotate_quat(shz_transform_t* xf, shz_quat_t q) SHZ_NOEXCEPT {
+    shz_mat4x4_t rot;
+    shz_vec4_t   basis[3];
+
+    // The rotation only replaces the first three columns with combinations of themselves.
+    shz_mat4x4_init_rotation_quat(&rot, q);
+
+    for(unsigned c = 0; c < 3; ++c)
+        basis[c] = shz_mat4x4_transform_vec4(&xf->matrix, rot.col[c]);
+
+    for(unsigned c = 0; c < 3; ++c)
+        xf->matrix.col[c] = basis[c];
+
+    xf->kind = shz_transform_kind_mult(xf->kind, SHZ_TRANSFORM_RIGID);
+}
+
+// Multiplies the upper-left 3x3 portion of an affine matrix by a direction, whose W component is preserved as 0.
+SHZ_FORCE_INLINE shz_vec4_t shz_transform_linear_(const shz_mat4x4_t* mat, shz_vec3_t v) {
+    shz_vec4_t out = shz_vec4_scale(mat->col[0], v.x);
+
+    out = shz_vec4_add(out, shz_vec4_scale(mat->col[1], v.y));
+
+    return shz_vec4_add(out, shz_vec4_scale(mat->col[2], v.z));
+}
+
+SHZ_HOT
+void shz_transform_mult(shz_transform_t* out, const shz_transform_t* lhs, const shz_transform_t* rhs) SHZ_NOEXCEPT {
+    const shz_transform_kind_t kind = shz_transform_kind_mult(lhs->kind, rhs->kind);
+    shz_mat4x4_t               m;
+
+    if(lhs->kind == SHZ_TRANSFORM_IDENTITY) {
+        *out = *rhs;
+        return;
+    }
+
+    if(rhs->kind == SHZ_TRANSFORM_IDENTITY) {
+        *out = *lhs;
+        return;
+    }
+
+    if(kind == SHZ_TRANSFORM_PROJECTIVE)
+        shz_mat4x4_mult(&m, &lhs->matrix, &rhs->matrix);
+    else if(rhs->kind == SHZ_TRANSFORM_TRANSLATION) {
+        // Offsets the last column of the left-hand side by the translation, as transformed by its basis.
+        m         = lhs->matrix;
+        m.pos.xyz = shz_vec3_add(m.pos.xyz, shz_transform_vec3(lhs, rhs->matrix.pos.xyz));
+    } else if(lhs->kind == SHZ_TRANSFORM_TRANSLATION) {
+        // Offsets the last column of the right-hand side by the translation.
+        m         = rhs->matrix;
+        m.pos.xyz = shz_vec3_add(m.pos.xyz, lhs->matrix.pos.xyz);
+    } else if(rhs->kind == SHZ_TRANSFORM_DIAGONAL) {
+        // Scales each basis column of the left-hand side.
+        m        = lhs->matrix;
+        m.col[0] = shz_vec4_scale(m.col[0], rhs->matrix.col[0].x);
+        m.col[1] = shz_vec4_scale(m.col[1], rhs->matrix.col[1].y);
+        m.col[2] = shz_vec4_scale(m.col[2], rhs->matrix.col[2].z);
+    } else if(lhs->kind == SHZ_TRANSFORM_DIAGONAL) {
+        // Scales each row of the right-hand side.
+        const shz_vec4_t diag = shz_vec4_init(lhs->matrix.col[0].x, lhs->matrix.col[1].y, lhs->matrix.col[2].z, 1.0f);
+
+        m        = rhs->matrix;
+        m.col[0] = shz_vec4_mul(m.col[0], diag);
+        m.col[1] = shz_vec4_mul(m.col[1], diag);
+        m.col[2] = shz_vec4_mul(m.col[2], diag);
+        m.col[3] = shz_vec4_mul(m.col[3], diag);
+    } else {
+        // Both sides are affine, so only their 3x4 upper portions must be multiplied.
+        for(unsigned c = 0; c < 3; ++c)
+            m.col[c] = shz_transform_linear_(&lhs->matrix, rhs->matrix.col[c].xyz);
+
+        m.pos = shz_vec4_add(shz_transform_linear_(&lhs->matrix, rhs->matrix.pos.xyz), lhs->matrix.pos);
+    }
+
+    out->matrix = m;
+    out->kind   = kind;
+}
+
+void shz_transform_inverse(shz_transform_t* out, const shz_transform_t* xf) SHZ_NOEXCEPT {
+    const shz_mat4x4_t* src = &xf->matrix;
+    shz_mat4x4_t        m;
+
+    switch(xf->kind) {
+    case SHZ_TRANSFORM_IDENTITY:
+        m = *src;
+        break;
+    case SHZ_TRANSFORM_TRANSLATION:
+        m         = *src;
+        m.pos.xyz = shz_vec3_neg(src->pos.xyz);
+        break;
+    case SHZ_TRANSFORM_DIAGONAL:
+        m          = *src;
+        m.col[0].x = shz_invf(src->col[0].x);
+        m.col[1].y = shz_invf(src->col[1].y);
+        m.col[2].z = shz_invf(src->col[2].z);
+        break;
+    case SHZ_TRANSFORM_RIGID: {
+        // The inverse of an orthonormal basis is its transpose.
+        m.col[0] = shz_vec4_init(src->col[0].x, src->col[1].x, src->col[2].x, 0.0f);
+        m.col[1] = shz_vec4_init(src->col[0].y, src->col[1].y, src->col[2].y, 0.0f);
+        m.col[2] = shz_vec4_init(src->col[0].z, src->col[1].z, src->col[2].z, 0.0f);
+        m.pos    = shz_vec4_sub(shz_vec4_init(0.0f, 0.0f, 0.0f, 1.0f), shz_transform_linear_(&m, src->pos.xyz));
+        break;
+    }
+    case SHZ_TRANSFORM_AFFINE:
+        shz_mat4x4_inverse_block_triangular(src, &m);
+        break;
+    default:
+        shz_mat4x4_inverse(src, &m);
+        break;
+    }
+
+    out->matrix = m;
+    out->kind   = xf->kind;
+}
@@ -0,0 +1,219 @@
+/*! \file
+    \brief Twiddle implementation.
+    \ingroup twiddle
+
+    This file contains the implementation of the texture routines within
+    the Twiddle API.
+
+    Textures are converted one 32-byte chunk of twiddled texels at a time.
+    Each chunk is made of 2x2 quads of texels, which take two texels from
+    one row and two from the next, interleaving them within registers.
+
+    \author 2026 Falco Girgis
+
+    \copyright MIT License
+*/
+
+#include "sh4zam/shz_twiddle.h"
+
+// Interleaves two rows of two texels, each \p bits wide, into the order of a twiddled 2x2 quad.
+SHZ_FORCE_INLINE uint32_t shz_twiddle_quad_(uint32_t a, uint32_t b, unsigned bits) SHZ_NOEXCEPT {
+    const uint32_t lo = (1u << bits) - 1;
+    const uint32_t hi = lo << bits;
+
+    return (a & lo) | ((b & lo) << bits) | ((a & hi) << bits) | ((b & hi) << (bits * 2));
+}
+
+// Returns the first row of two texels within a twiddled 2x2 quad, undoing shz_twiddle_quad_().
+SHZ_FORCE_INLINE uint32_t shz_untwiddle_row0_(uint32_t quad, unsigned bits) SHZ_NOEXCEPT {
+    const uint32_t lo = (1u << bits) - 1;
+
+    return (quad & lo) | ((quad >> bits) & (lo << bits));
+}
+
+// Returns the second row of two texels within a twiddled 2x2 quad, undoing shz_twiddle_quad_().
+SHZ_FORCE_INLINE uint32_t shz_untwiddle_row1_(uint32_t quad, unsigned bits) SHZ_NOEXCEPT {
+    const uint32_t lo = (1u << bits) - 1;
+
+    return ((quad >> bits) & lo) | ((quad >> (bits * 2)) & (lo << bits));
+}
+
+// Fills in the byte offset of each quad within a chunk, relative to its top-left texel, returning how many there are.
+SHZ_FORCE_INLINE size_t shz_twiddle_offsets_(uint32_t* offsets, size_t pitch, unsigned bpp) SHZ_NOEXCEPT {
+    const size_t quads = 64 / bpp;
+
+    for(size_t q = 0; q < quads; ++q)
+        offsets[q] = shz_morton_decode_y(q) * 2 * pitch + shz_morton_decode_x(q) * 2 * bpp / 8;
+
+    return quads;
+}
+
+// Tracks where each chunk of a twiddled texture begins in a linear one, by position within the current square block.
+typedef struct shz_twiddle_cursor_ {
+    size_t width;
+    size_t height;
+    size_t pitch;
+    size_t size;
+    size_t texels;
+    size_t local;
+    size_t block;
+} shz_twiddle_cursor_t_;
+
+SHZ_FORCE_INLINE shz_twiddle_cursor_t_ shz_twiddle_cursor_(size_t width, size_t height, unsigned bpp) SHZ_NOEXCEPT {
+    return SHZ_INIT(shz_twiddle_cursor_t_,
+        .width  = width,
+        .height = height,
+        .pitch  = width * bpp / 8,
+        .size   = (width < height)? width : height,
+        .texels = 256 / bpp,
+        .local  = 0,
+        .block  = 0
+    );
+}
+
+// Returns the byte offset of the next chunk's top-left texel within a linear texture, stepping blocks without dividing.
+SHZ_FORCE_INLINE size_t shz_twiddle_next_(shz_twiddle_cursor_t_* cursor, unsigned bpp) SHZ_NOEXCEPT {
+    const size_t x = shz_morton_decode_x(cursor->local) + ((cursor->width  > cursor->height)? cursor->block : 0);
+    const size_t y = shz_morton_decode_y(cursor->local) + ((cursor->height > cursor->width)?  cursor->block : 0);
+
+    if((cursor->local += cursor->texels) == cursor->size * cursor->size) {
+        cursor->local  = 0;
+        cursor->block += cursor->size;
+    }
+
+    return y * cursor->pitch + x * bpp / 8;
+}
+
+SHZ_FORCE_INLINE void shz_twiddle_(uint8_t* SHZ_RESTRICT dst, const uint8_t* SHZ_RESTRICT src,
+                                   size_t width, size_t height, unsigned bpp) SHZ_NOEXCEPT {
+    const size_t          pitch  = width * bpp / 8;
+    const size_t          chunks = width * height * bpp / 256;
+    uint32_t              offsets[16];
+    const size_t          quads  = shz_twiddle_offsets_(offsets, pitch, bpp);
+    shz_twiddle_cursor_t_ cursor = shz_twiddle_cursor_(width, height, bpp);
+
+    assert(width >= 8 && height >= 8 && !(width & (width - 1)) && !(height & (height - 1)));
+    assert(!((uintptr_t)dst & 31) && !((uintptr_t)src & 3));
+
+    for(size_t c = 0; c < chunks; ++c) {
+        const uint8_t*           corner = src + shz_twiddle_next_(&cursor, bpp);
+        SHZ_ALIGNAS(32) uint32_t chunk[8];
+
+        for(size_t q = 0; q < quads; ++q) {
+            const uint8_t* row0 = corner + offsets[q];
+            const uint8_t* row1 = row0 + pitch;
+
+            switch(bpp) {
+            case 4:
+                ((shz_alias_uint16_t*)chunk)[q] = (uint16_t)shz_twiddle_quad_(row0[0], row1[0], 4);
+                break;
+            case 8:
+                chunk[q] = shz_twiddle_quad_(*(const shz_alias_uint16_t*)row0, *(const shz_alias_uint16_t*)row1, 8);
+                break;
+            case 16: {
+                const uint32_t a = *(const shz_alias_uint32_t*)row0;
+                const uint32_t b = *(const shz_alias_uint32_t*)row1;
+
+                chunk[q * 2 + 0] = (a & 0x0000ffff) | (b << 16);
+                chunk[q * 2 + 1] = (a >> 16) | (b & 0xffff0000);
+                break;
+            }
+            default:
+                chunk[q * 4 + 0] = ((const shz_alias_uint32_t*)row0)[0];
+                chunk[q * 4 + 1] = ((const shz_alias_uint32_t*)row1)[0];
+                chunk[q * 4 + 2] = ((const shz_alias_uint32_t*)row0)[1];
+                chunk[q * 4 + 3] = ((const shz_alias_uint32_t*)row1)[1];
+                break;
+            }
+        }
+
+        shz_memcpy32(dst, chunk, sizeof(chunk));
+        dst += sizeof(chunk);
+    }
+}
+
+SHZ_FORCE_INLINE void shz_untwiddle_(uint8_t* SHZ_RESTRICT dst, const uint8_t* SHZ_RESTRICT src,
+                                     size_t width, size_t height, unsigned bpp) SHZ_NOEXCEPT {
+    const size_t          pitch  = width * bpp / 8;
+    const size_t          chunks = width * height * bpp / 256;
+    uint32_t              offsets[16];
+    const size_t          quads  = shz_twiddle_offsets_(offsets, pitch, bpp);
+    shz_twiddle_cursor_t_ cursor = shz_twiddle_cursor_(width, height, bpp);
+
+    assert(width >= 8 && height >= 8 && !(width & (width - 1)) && !(height & (height - 1)));
+    assert(!((uintptr_t)src & 7));
+
+    for(size_t c = 0; c < chunks; ++c) {
+        uint8_t*                  corner = dst + shz_twiddle_next_(&cursor, bpp);
+        const shz_alias_uint32_t* chunk  = (const shz_alias_uint32_t*)src;
+
+        SHZ_PREFETCH(src + 32);
+
+        for(size_t q = 0; q < quads; ++q) {
+            uint8_t* row0 = corner + offsets[q];
+            uint8_t* row1 = row0 + pitch;
+
+            switch(bpp) {
+            case 4: {
+                const uint32_t quad = ((const shz_alias_uint16_t*)chunk)[q];
+
+                row0[0] = (uint8_t)shz_untwiddle_row0_(quad, 4);
+                row1[0] = (uint8_t)shz_untwiddle_row1_(quad, 4);
+                break;
+            }
+            case 8:
+                *(shz_alias_uint16_t*)row0 = (uint16_t)shz_untwiddle_row0_(chunk[q], 8);
+                *(shz_alias_uint16_t*)row1 = (uint16_t)shz_untwiddle_row1_(chunk[q], 8);
+                break;
+            case 16: {
+                const uint32_t a = chunk[q * 2 + 0];
+                const uint32_t b = chunk[q * 2 + 1];
+
+                *(shz_alias_uint32_t*)row0 = (a & 0x0000ffff) | (b << 16);
+                *(shz_alias_uint32_t*)row1 = (a >> 16) | (b & 0xffff0000);
+                break;
+            }
+            default:
+                ((shz_alias_uint32_t*)row0)[0] = chunk[q * 4 + 0];
+                ((shz_alias_uint32_t*)row1)[0] = chunk[q * 4 + 1];
+                ((shz_alias_uint32_t*)row0)[1] = chunk[q * 4 + 2];
+                ((shz_alias_uint32_t*)row1)[1] = chunk[q * 4 + 3];
+                break;
+            }
+        }
+
+        src += 32;
+    }
+}
+
+void shz_twiddle4(uint8_t* dst, const uint8_t* src, size_t width, size_t height) SHZ_NOEXCEPT {
+    shz_twiddle_(dst, src, width, height, 4);
+}
+
+void shz_twiddle8(uint8_t* dst, const uint8_t* src, size_t width, size_t height) SHZ_NOEXCEPT {
+    shz_twiddle_(dst, src, width, height, 8);
+}
+
+void shz_twiddle16(uint16_t* dst, const uint16_t* src, size_t width, size_t height) SHZ_NOEXCEPT {
+    shz_twiddle_((uint8_t*)dst, (const uint8_t*)src, width, height, 16);
+}
+
+void shz_twiddle32(uint32_t* dst, const uint32_t* src, size_t width, size_t height) SHZ_NOEXCEPT {
+    shz_twiddle_((uint8_t*)dst, (const uint8_t*)src, width, height, 32);
+}
+
+void shz_untwiddle4(uint8_t* dst, const uint8_t* src, size_t width, size_t height) SHZ_NOEXCEPT {
+    shz_untwiddle_(dst, src, width, height, 4);
+}
+
+void shz_untwiddle8(uint8_t* dst, const uint8_t* src, size_t width, size_t height) SHZ_NOEXCEPT {
+    shz_untwiddle_(dst, src, width, height, 8);
+}
+
+void shz_untwiddle16(uint16_t* dst, const uint16_t* src, size_t width, size_t height) SHZ_NOEXCEPT {
+    shz_untwiddle_((uint8_t*)dst, (const uint8_t*)src, width, height, 16);
+}
+
+void shz_untwiddle32(uint32_t* dst, const uint32_t* src, size_t width, size_t height) SHZ_NOEXCEPT {
+    shz_untwiddle_((uint8_t*)dst, (const uint8_t*)src, width, height, 32);
+}
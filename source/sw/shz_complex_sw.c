@@ -5,6 +5,12 @@
  *  This file contains the generic software routines which back
  *  the complex number API and the FFT algorithm.
  *
+ *  Single and batched FFTs share one implementation, which applies
+ *  each stage to every channel before moving onto the next, within
+ *  groups of channels small enough to remain cached. Twiddle
+ *  factors are generated by recurrence into small blocks, then the
+ *  butterflies for each block run as contiguous inner loops.
+ *
  *  \author     2026 Falco Girgis
  *  \copyright  MIT License
  */
@@ -12,7 +18,19 @@
 #include "sh4zam/shz_complex.h"
 #include <assert.h>
 
-void shz_fft_sw(shz_complex_t* spectrum, size_t size) {
+// Number of twiddle factors generated at once, then applied across every channel.
+#define SHZ_FFT_TWIDDLE_BLOCK   64
+
+// Batches are split into groups of channels totalling about this many bytes, so each group stays cached between stages.
+#define SHZ_FFT_BATCH_BYTES     32768
+
+// Returns a channel of the batch, from either its pointer array or contiguous storage.
+SHZ_FORCE_INLINE shz_complex_t* shz_fft_channel_(shz_complex_t* const* channels, shz_complex_t* base,
+                                                 size_t channel, size_t size) {
+    return channels? channels[channel] : base + channel * size;
+}
+
+static void shz_fft_batch_chunk_(shz_complex_t* const* channels, shz_complex_t* base, size_t count, size_t size) {
     // Buffer must be nonzero power-of-two size.
     assert(size && !(size & (size - 1)));
 
@@ -28,36 +46,85 @@ void shz_fft_sw(shz_complex_t* spectrum, size_t size) {
 
         j += bit;
         if (i < j) {
-            shz_complex_t tmp = spectrum[i];
-            spectrum[i] = spectrum[j];
-            spectrum[j] = tmp;
+            for (size_t c = 0; c < count; c++) {
+                shz_complex_t* spectrum = shz_fft_channel_(channels, base, c, size);
+                shz_complex_t tmp = spectrum[i];
+                spectrum[i] = spectrum[j];
+                spectrum[j] = tmp;
+            }
         }
     }
 
     for (size_t len = 2; len <= size; len <<= 1) {
+        const size_t half = len / 2;
         float angle_rad = -2.0f * SHZ_F_PI / len;
         shz_sincos_t sincos = shz_sincosf(angle_rad);
         shz_complex_t twiddle_unit = { sincos.cos, sincos.sin };
+        shz_complex_t twiddle_cur = {1.0f, 0.0f};
 
-        for (size_t i = 0; i < size; i += len) {
-            shz_complex_t twiddle_cur = {1.0f, 0.0f};
+        for (size_t k0 = 0; k0 < half; k0 += SHZ_FFT_TWIDDLE_BLOCK) {
+            shz_complex_t twiddles[SHZ_FFT_TWIDDLE_BLOCK];
+            const size_t block = (half - k0 < SHZ_FFT_TWIDDLE_BLOCK)? half - k0 : SHZ_FFT_TWIDDLE_BLOCK;
 
-            for (size_t k = 0; k < len / 2; k++) {
-                shz_complex_t even = spectrum[i + k];
-                shz_complex_t odd = spectrum[i + k + len / 2];
-                shz_complex_t twiddled_odd = {
-                    odd.real * twiddle_cur.real - odd.imag * twiddle_cur.imag,
-                    odd.real * twiddle_cur.imag + odd.imag * twiddle_cur.real
-                };
+            for (size_t k = 0; k < block; k++) {
                 float twiddle_real_next = twiddle_cur.real * twiddle_unit.real - twiddle_cur.imag * twiddle_unit.imag;
 
-                spectrum[i + k].real = even.real + twiddled_odd.real;
-                spectrum[i + k].imag = even.imag + twiddled_odd.imag;
-                spectrum[i + k + len / 2].real = even.real - twiddled_odd.real;
-                spectrum[i + k + len / 2].imag = even.imag - twiddled_odd.imag;
+                twiddles[k] = twiddle_cur;
                 twiddle_cur.imag = twiddle_cur.real * twiddle_unit.imag + twiddle_cur.imag * twiddle_unit.real;
                 twiddle_cur.real = twiddle_real_next;
             }
+
+            for (size_t c = 0; c < count; c++) {
+                shz_complex_t* spectrum = shz_fft_channel_(channels, base, c, size);
+
+                for (size_t i = k0; i < size; i += len) {
+                    shz_complex_t* even = &spectrum[i];
+                    shz_complex_t* odd  = &spectrum[i + half];
+
+                    SHZ_IVDEP
+                    for (size_t k = 0; k < block; k++) {
+                        shz_complex_t e = even[k];
+                        shz_complex_t o = odd[k];
+                        shz_complex_t twiddled_odd = {
+                            o.real * twiddles[k].real - o.imag * twiddles[k].imag,
+                            o.real * twiddles[k].imag + o.imag * twiddles[k].real
+                        };
+
+                        even[k].real = e.real + twiddled_odd.real;
+                        even[k].imag = e.imag + twiddled_odd.imag;
+                        odd[k].real  = e.real - twiddled_odd.real;
+                        odd[k].imag  = e.imag - twiddled_odd.imag;
+                    }
+                }
+            }
         }
     }
-}
\ No newline at end of file
+}
+
+static void shz_fft_batch_sw_(shz_complex_t* const* channels, shz_complex_t* base, size_t count, size_t size) {
+    size_t chunk = SHZ_FFT_BATCH_BYTES / (size * sizeof(shz_complex_t));
+
+    if (!chunk)
+        chunk = 1;
+
+    for (size_t c = 0; c < count; c += chunk) {
+        const size_t n = (count - c < chunk)? count - c : chunk;
+
+        if (channels)
+            shz_fft_batch_chunk_(channels + c, NULL, n, size);
+        else
+            shz_fft_batch_chunk_(NULL, base + c * size, n, size);
+    }
+}
+
+void shz_fft_sw(shz_complex_t* spectrum, size_t size) {
+    shz_fft_batch_chunk_(&spectrum, NULL, 1, size);
+}
+
+void shz_fft_batch(shz_complex_t* const* channels, size_t count, size_t size) SHZ_NOEXCEPT {
+    shz_fft_batch_sw_(channels, NULL, count, size);
+}
+
+void shz_fft_batch_contiguous(shz_complex_t* s, size_t count, size_t size) SHZ_NOEXCEPT {
+    shz_fft_batch_sw_(NULL, s, count, size);
+}
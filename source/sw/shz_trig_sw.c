@@ -0,0 +1,77 @@
+/*! \file
+ *  \brief   Out-of-line SW implementation of trigonometry routines.
+ *  \ingroup trig
+ *
+ *  This file contains the generic software routines which back the
+ *  sin/cos array API.
+ *
+ *  Every angle is reduced to a quadrant index and a remainder within
+ *  [-PI/4, PI/4], where short minimax polynomials approximate sine and
+ *  cosine. The quadrant then swaps and negates the two results. Nothing
+ *  branches on the input and no libm routines are called, so compilers are
+ *  able to turn each loop into wide SIMD on host back-ends.
+ *
+ *  \author     2026 Falco Girgis
+ *  \copyright  MIT License
+ */
+
+#include "sh4zam/shz_trig.h"
+
+// Adding then subtracting 1.5 * 2^23 rounds a float to the nearest integer.
+#define SHZ_SINCOS_ROUND_MAGIC  12582912.0f
+
+// PI/2, split into three parts, so that k * PI/2 can be subtracted exactly.
+#define SHZ_SINCOS_PIO2_HI      1.5703125f
+#define SHZ_SINCOS_PIO2_MID     4.837512969970703125e-4f
+#define SHZ_SINCOS_PIO2_LO      7.54978995489188216e-8f
+
+SHZ_FORCE_INLINE void shz_sincosf_quadrant_(float* sin_out, float* cos_out,
+                                            float r, int32_t quadrant) SHZ_NOEXCEPT {
+    const float z = r * r;
+
+    // Minimax polynomials over [-PI/4, PI/4] (Cephes sinf() and cosf()).
+    const float s = r + r * z * (-1.6666654611e-1f + z * (8.3321608736e-3f + z * -1.9515295891e-4f));
+    const float c = 1.0f - 0.5f * z + z * z * (4.166664568298827e-2f + z * (-1.388731625493765e-3f + z * 2.443315711809948e-5f));
+
+    const float sin_val = (quadrant & 1)? c : s;
+    const float cos_val = (quadrant & 1)? s : c;
+
+    *sin_out = (quadrant & 2)?       -sin_val : sin_val;
+    *cos_out = ((quadrant + 1) & 2)? -cos_val : cos_val;
+}
+
+void shz_sincosu16_array(float* sins, float* coss, const uint16_t* radians16, size_t count) SHZ_NOEXCEPT {
+    SHZ_IVDEP
+    for(size_t i = 0; i < count; ++i) {
+        const int32_t angle    = radians16[i];
+        const int32_t quadrant = (angle + 0x2000) >> 14;
+        // Exact remainder within [-1/8, 1/8] revolution.
+        const float   r        = (float)(angle - (quadrant << 14)) * (2.0f * SHZ_F_PI / 65536.0f);
+
+        shz_sincosf_quadrant_(&sins[i], &coss[i], r, quadrant);
+    }
+}
+
+void shz_sincosf_array(float* sins, float* coss, const float* radians, size_t count) SHZ_NOEXCEPT {
+    SHZ_IVDEP
+    for(size_t i = 0; i < count; ++i) {
+        const float x = radians[i];
+        const float k = (x * (2.0f / SHZ_F_PI) + SHZ_SINCOS_ROUND_MAGIC) - SHZ_SINCOS_ROUND_MAGIC;
+        // Cody-Waite reduction: every partial product is exact for moderately sized k.
+        const float r = ((x - k * SHZ_SINCOS_PIO2_HI) - k * SHZ_SINCOS_PIO2_MID) - k * SHZ_SINCOS_PIO2_LO;
+
+        shz_sincosf_quadrant_(&sins[i], &coss[i], r, (int32_t)k);
+    }
+}
+
+void shz_sincosf_deg_array(float* sins, float* coss, const float* degrees, size_t count) SHZ_NOEXCEPT {
+    SHZ_IVDEP
+    for(size_t i = 0; i < count; ++i) {
+        const float d = degrees[i];
+        const float k = (d * (1.0f / 90.0f) + SHZ_SINCOS_ROUND_MAGIC) - SHZ_SINCOS_ROUND_MAGIC;
+        // Subtracting whole quadrants in degrees is exact, so only the remainder is scaled.
+        const float r = (d - k * 90.0f) * (SHZ_F_PI / 180.0f);
+
+        shz_sincosf_quadrant_(&sins[i], &coss[i], r, (int32_t)k);
+    }
+}
@@ -30,3 +30,97 @@ void shz_xmtrx_load_apply_store_3x3_sw(shz_mat3x3_t* out,
     shz_xmtrx_apply_3x3(matrix2);
     shz_xmtrx_store_3x3(out);
 }
+
+/* The batched transforms hoist XMTRX into locals once, then compute each
+   element with fixed-size inner loops, which compilers turn into SIMD. */
+void shz_xmtrx_transform_vec4_array_sw(shz_vec4_t* dst,
+                                       const shz_vec4_t* src,
+                                       size_t count,
+                                       size_t stride) {
+    const shz_xmtrx__t* xmtrx = shz_xmtrx_state_();
+    const shz_vec4_t    c0 = xmtrx->col[0], c1 = xmtrx->col[1],
+                        c2 = xmtrx->col[2], c3 = xmtrx->col[3];
+    const char*         in  = (const char*)src;
+    char*               out = (char*)dst;
+
+    for(size_t i = 0; i < count; ++i, in += stride, out += stride) {
+        const float* v = (const float*)in;
+        float*       r = (float*)out;
+        const float  x = v[0], y = v[1], z = v[2], w = v[3];
+
+        for(unsigned e = 0; e < 4; ++e)
+            r[e] = c0.e[e] * x + c1.e[e] * y + c2.e[e] * z + c3.e[e] * w;
+    }
+}
+
+static void shz_xmtrx_transform_vec3_array_(shz_vec3_t* dst,
+                                            const shz_vec3_t* src,
+                                            size_t count,
+                                            size_t stride,
+                                            float w) {
+    const shz_xmtrx__t* xmtrx = shz_xmtrx_state_();
+    const shz_vec4_t    c0 = xmtrx->col[0], c1 = xmtrx->col[1], c2 = xmtrx->col[2];
+    const shz_vec4_t    c3 = shz_vec4_scale(xmtrx->col[3], w);
+    const char*         in  = (const char*)src;
+    char*               out = (char*)dst;
+
+    for(size_t i = 0; i < count; ++i, in += stride, out += stride) {
+        const float* v = (const float*)in;
+        float*       r = (float*)out;
+        const float  x = v[0], y = v[1], z = v[2];
+
+        for(unsigned e = 0; e < 3; ++e)
+            r[e] = c0.e[e] * x + c1.e[e] * y + c2.e[e] * z + c3.e[e];
+    }
+}
+
+void shz_xmtrx_transform_vec3_array_sw(shz_vec3_t* dst,
+                                       const shz_vec3_t* src,
+                                       size_t count,
+                                       size_t stride) {
+    shz_xmtrx_transform_vec3_array_(dst, src, count, stride, 0.0f);
+}
+
+void shz_xmtrx_transform_point3_array_sw(shz_vec3_t* dst,
+                                         const shz_vec3_t* src,
+                                         size_t count,
+                                         size_t stride) {
+    shz_xmtrx_transform_vec3_array_(dst, src, count, stride, 1.0f);
+}
+
+/* The viewport is folded into the hoisted rows producing X and Y, since
+   (x * scale + w * offset) / w == x / w * scale + offset. */
+void shz_xmtrx_project_point3_array_sw(shz_vec3_t* dst,
+                                       const shz_vec3_t* src,
+                                       size_t count,
+                                       size_t stride,
+                                       const shz_viewport_t* viewport) {
+    const shz_xmtrx__t* xmtrx = shz_xmtrx_state_();
+    const float         sx = viewport->scale.x,  sy = viewport->scale.y;
+    const float         ox = viewport->offset.x, oy = viewport->offset.y;
+    shz_vec4_t          c[4];
+    const char*         in  = (const char*)src;
+    char*               out = (char*)dst;
+
+    for(unsigned e = 0; e < 4; ++e)
+        c[e] = shz_vec4_init(xmtrx->col[e].x * sx + xmtrx->col[e].w * ox,
+                             xmtrx->col[e].y * sy + xmtrx->col[e].w * oy,
+                             xmtrx->col[e].w,
+                             0.0f);
+
+    for(size_t i = 0; i < count; ++i, in += stride, out += stride) {
+        const float* v = (const float*)in;
+        float*       r = (float*)out;
+        const float  x = v[0], y = v[1], z = v[2];
+        float        p[3];
+
+        for(unsigned e = 0; e < 3; ++e)
+            p[e] = c[0].e[e] * x + c[1].e[e] * y + c[2].e[e] * z + c[3].e[e];
+
+        const float inv_w = 1.0f / p[2];
+
+        r[0] = p[0] * inv_w;
+        r[1] = p[1] * inv_w;
+        r[2] = inv_w;
+    }
+}
@@ -0,0 +1,258 @@
+#include "shz_test.h"
+#include "shz_test.hpp"
+#include "sh4zam/shz_anim.hpp"
+
+#include <print>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#define GBL_SELF_TYPE   shz_anim_test_suite
+
+GBL_TEST_FIXTURE_NONE
+GBL_TEST_INIT_NONE
+GBL_TEST_FINAL_NONE
+
+namespace {
+    constexpr float ANIM_ERROR = 1e-3f;
+
+    // Owns the keys of a randomly generated clip, with a rotation, translation, and scalar track per bone.
+    struct test_clip {
+        std::vector<std::vector<float>> times;
+        std::vector<std::vector<float>> values;
+        std::vector<shz::anim_track>    tracks;
+        shz::anim_clip                  clip;
+        size_t                          floats   = 0;
+        float                           duration = 0.0f;
+
+        void add(shz_anim_type_t type, shz_anim_interp_t interp, uint32_t keys) {
+            const unsigned comps    = type;
+            const unsigned key_size = (interp == SHZ_ANIM_CUBIC)? 3 * comps : comps;
+            auto&          t        = times.emplace_back();
+            auto&          v        = values.emplace_back();
+            float          time     = gblRandUniform(0.0f, 0.1f);
+
+            for(uint32_t k = 0; k < keys; ++k) {
+                t.push_back(time);
+                time += gblRandUniform(0.02f, 0.2f);
+
+                if(type == SHZ_ANIM_QUAT) {
+                    const shz::quat q = shz::quat::from_angles_xyz(gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                                                   gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                                                   gblRandUniform(-SHZ_F_PI, SHZ_F_PI));
+                    for(unsigned c = 0; c < key_size; ++c)
+                        v.push_back((interp == SHZ_ANIM_CUBIC && (c < 4 || c >= 8))? gblRandUniform(-1.0f, 1.0f)
+                                                                                     : (&q.w)[c % 4]);
+                } else {
+                    for(unsigned c = 0; c < key_size; ++c)
+                        v.push_back(gblRandUniform(-10.0f, 10.0f));
+                }
+            }
+
+            duration = std::max(duration, t.back());
+            tracks.push_back({ type, interp, keys, static_cast<uint32_t>(floats), nullptr, nullptr });
+            floats += comps;
+        }
+
+        test_clip(size_t bones) {
+            for(size_t b = 0; b < bones; ++b) {
+                const auto interp = static_cast<shz_anim_interp_t>(b % 3);
+
+                add(SHZ_ANIM_QUAT,   interp,          2 + b % 5 * 13);
+                add(SHZ_ANIM_VEC3,   interp,          (b == 1)? 1 : 3 + b % 4 * 11);
+                add(SHZ_ANIM_SCALAR, SHZ_ANIM_STEP,   4 + b % 3 * 7);
+            }
+
+            for(size_t t = 0; t < tracks.size(); ++t) {
+                tracks[t].times  = times[t].data();
+                tracks[t].values = values[t].data();
+            }
+
+            clip = { tracks.data(), tracks.size() };
+        }
+    };
+
+    // Samples a track by binary searching its keys for every sample.
+    void reference_sample(const shz::anim_track& track, float time, float* dst) {
+        const unsigned comps    = track.type;
+        const unsigned key_size = (track.interp == SHZ_ANIM_CUBIC)? 3 * comps : comps;
+        const unsigned value    = (track.interp == SHZ_ANIM_CUBIC)? comps : 0;
+
+        if(time <= track.times[0] || track.keys == 1) {
+            std::copy_n(&track.values[value], comps, dst);
+            return;
+        }
+
+        if(time >= track.times[track.keys - 1]) {
+            std::copy_n(&track.values[(track.keys - 1) * key_size + value], comps, dst);
+            return;
+        }
+
+        const uint32_t k  = std::upper_bound(track.times, track.times + track.keys, time) - track.times - 1;
+        const float    dt = track.times[k + 1] - track.times[k];
+        const float    u  = (time - track.times[k]) / dt;
+        const float*   k0 = &track.values[k * key_size];
+        const float*   k1 = k0 + key_size;
+
+        switch(track.interp) {
+        case SHZ_ANIM_STEP:
+            std::copy_n(k0, comps, dst);
+            return;
+        case SHZ_ANIM_LINEAR: {
+            float sign = 1.0f;
+            if(comps == 4 && k0[0] * k1[0] + k0[1] * k1[1] + k0[2] * k1[2] + k0[3] * k1[3] < 0.0f)
+                sign = -1.0f;
+            for(unsigned c = 0; c < comps; ++c)
+                dst[c] = k0[c] * (1.0f - u) + sign * k1[c] * u;
+            break;
+        }
+        case SHZ_ANIM_CUBIC:
+            for(unsigned c = 0; c < comps; ++c)
+                dst[c] = (2.0f * u * u * u - 3.0f * u * u + 1.0f) * k0[comps + c] +
+                         (u * u * u - 2.0f * u * u + u) * dt * k0[2 * comps + c] +
+                         (-2.0f * u * u * u + 3.0f * u * u) * k1[comps + c] +
+                         (u * u * u - u * u) * dt * k1[c];
+            break;
+        }
+
+        if(comps == 4) {
+            const float mag = std::sqrt(dst[0] * dst[0] + dst[1] * dst[1] + dst[2] * dst[2] + dst[3] * dst[3]);
+            for(unsigned c = 0; c < 4; ++c)
+                dst[c] /= mag;
+        }
+    }
+
+    bool verify_sample(const test_clip& clip, float time, const float* sample) {
+        float expected[4];
+
+        for(const auto& track: clip.tracks) {
+            const float* value = &sample[track.offset];
+            float        sign  = 1.0f;
+
+            reference_sample(track, time, expected);
+
+            // Either hemisphere represents the same rotation.
+            if(track.type == SHZ_ANIM_QUAT &&
+               expected[0] * value[0] + expected[1] * value[1] + expected[2] * value[2] + expected[3] * value[3] < 0.0f)
+                sign = -1.0f;
+
+            for(unsigned c = 0; c < static_cast<unsigned>(track.type); ++c)
+                if(std::abs(sign * expected[c] - value[c]) > ANIM_ERROR * std::max(1.0f, std::abs(expected[c])))
+                    return false;
+        }
+
+        return true;
+    }
+}
+
+GBL_TEST_CASE(sample_sequential)
+    const test_clip       clip(12);
+    std::vector<uint32_t> cursors(clip.tracks.size(), 0);
+    std::vector<float>    sample(clip.floats);
+
+    // Plays forwards past the end, then loops back around for a second pass.
+    for(unsigned pass = 0; pass < 2; ++pass)
+        for(float time = -0.1f; time < clip.duration + 0.1f; time += 1.0f / 60.0f) {
+            shz::sample(clip.clip, time, cursors.data(), sample.data());
+            GBL_TEST_VERIFY(verify_sample(clip, time, sample.data()));
+        }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(sample_seek)
+    const test_clip       clip(12);
+    std::vector<uint32_t> cursors(clip.tracks.size(), 0);
+    std::vector<float>    sample(clip.floats);
+
+    for(unsigned i = 0; i < 512; ++i) {
+        const float time = gblRandUniform(-0.1f, clip.duration + 0.1f);
+
+        shz::sample(clip.clip, time, cursors.data(), sample.data());
+        GBL_TEST_VERIFY(verify_sample(clip, time, sample.data()));
+    }
+
+    // Landing exactly upon keys yields their values.
+    for(const auto& track: clip.tracks) {
+        const unsigned value = (track.interp == SHZ_ANIM_CUBIC)? track.type : 0;
+        const unsigned size  = (track.interp == SHZ_ANIM_CUBIC)? 3 * track.type : track.type;
+
+        for(uint32_t k = 0; k < track.keys; ++k) {
+            const float* key    = &track.values[k * size + value];
+            const float* result = &sample[track.offset];
+            float        sign   = 1.0f;
+
+            shz::sample(clip.clip, track.times[k], cursors.data(), sample.data());
+
+            // Keyed rotations may come back from either hemisphere.
+            if(track.type == SHZ_ANIM_QUAT &&
+               key[0] * result[0] + key[1] * result[1] + key[2] * result[2] + key[3] * result[3] < 0.0f)
+                sign = -1.0f;
+
+            for(unsigned c = 0; c < static_cast<unsigned>(track.type); ++c)
+                GBL_TEST_ERROR(result[c], sign * key[c], ANIM_ERROR, GBL_TEST_ERROR_FUZZY);
+        }
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(sample_instances)
+    constexpr size_t instances = 256;
+
+    const test_clip       clip(24);
+    std::vector<uint32_t> cursors(instances * clip.tracks.size(), 0);
+    std::vector<float>    samples(instances * clip.floats);
+    std::vector<float*>   dsts(instances);
+    std::vector<float>    times(instances);
+
+    for(size_t i = 0; i < instances; ++i) {
+        dsts[i]  = &samples[i * clip.floats];
+        times[i] = gblRandUniform(0.0f, clip.duration);
+    }
+
+    // Advances every instance by a frame, wrapping around at the end of the clip.
+    auto advance = [&] {
+        for(auto& time: times)
+            if((time += 1.0f / 60.0f) > clip.duration)
+                time -= clip.duration;
+    };
+
+    for(unsigned frame = 0; frame < 64; ++frame) {
+        shz::sample(clip.clip, times.data(), cursors.data(), dsts.data(), instances);
+
+        for(size_t i = 0; i < instances; ++i)
+            GBL_TEST_VERIFY(verify_sample(clip, times[i], dsts[i]));
+
+        advance();
+    }
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz::sample", [&] {
+                shz::sample(clip.clip, times.data(), cursors.data(), dsts.data(), instances);
+                advance();
+            },
+            "binary search", [&] {
+                for(size_t i = 0; i < instances; ++i)
+                    for(const auto& track: clip.tracks)
+                        reference_sample(track, times[i], dsts[i] + track.offset);
+                advance();
+            }
+        )
+    );
+
+#ifndef SHZ_DISABLE_BENCHMARKS
+    const auto [uncached, cached] = (benchmark)(nullptr, "shz::sample", [&] {
+        shz::sample(clip.clip, times.data(), cursors.data(), dsts.data(), instances);
+        advance();
+    });
+#   if SHZ_BACKEND == SHZ_SH4
+    const double ns = static_cast<double>(cached) * NS_PER_CYCLE;
+#   else
+    const double ns = static_cast<double>(cached);
+#   endif
+    std::println("\t{} instances x {} tracks: {:.0f} track samples/s",
+                 instances, clip.tracks.size(), (instances * clip.tracks.size()) / ns * 1e9);
+#endif
+GBL_TEST_CASE_END
+
+GBL_TEST_REGISTER(sample_sequential,
+                  sample_seek,
+                  sample_instances)
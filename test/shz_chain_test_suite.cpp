@@ -0,0 +1,258 @@
+#include "shz_test.h"
+#include "shz_test.hpp"
+#include "sh4zam/shz_chain.hpp"
+#include "sh4zam/shz_xmtrx.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#define GBL_SELF_TYPE   shz_chain_test_suite
+
+GBL_TEST_FIXTURE_NONE
+GBL_TEST_INIT_NONE
+GBL_TEST_FINAL_NONE
+
+namespace {
+    constexpr float CHAIN_ERROR = 1e-3f;
+
+    // Issues every recorded operation directly against XMTRX, one multiplication at a time.
+    void reference(const shz::chain& chain) {
+        shz_xmtrx_init_identity();
+
+        for(size_t o = 0; o < chain.count; ++o) {
+            const shz::chain_op& op = chain.ops[o];
+
+            switch(op.type) {
+            case SHZ_CHAIN_TRANSLATE:
+                shz_xmtrx_translate(op.args[0], op.args[1], op.args[2]);
+                break;
+            case SHZ_CHAIN_SCALE:
+                shz_xmtrx_scale(op.args[0], op.args[1], op.args[2]);
+                break;
+            case SHZ_CHAIN_ROTATE_X:
+                shz_xmtrx_rotate_x(op.args[0]);
+                break;
+            case SHZ_CHAIN_ROTATE_Y:
+                shz_xmtrx_rotate_y(op.args[0]);
+                break;
+            case SHZ_CHAIN_ROTATE_Z:
+                shz_xmtrx_rotate_z(op.args[0]);
+                break;
+            case SHZ_CHAIN_ROTATE_QUAT: {
+                shz::mat4x4 rot;
+                shz_mat4x4_init_rotation_quat(&rot, shz_quat_init(op.args[0], op.args[1], op.args[2], op.args[3]));
+                shz_xmtrx_apply_4x4(&rot);
+                break;
+            }
+            case SHZ_CHAIN_SCREEN:
+                shz_xmtrx_apply_screen(op.args[0], op.args[1]);
+                break;
+            case SHZ_CHAIN_PERSPECTIVE:
+                shz_xmtrx_apply_perspective(op.args[0], op.args[1], op.args[2]);
+                break;
+            case SHZ_CHAIN_MATRIX:
+                shz_xmtrx_apply_4x4(op.matrix);
+                break;
+            }
+        }
+    }
+
+    bool compare(const shz_mat4x4_t& expected, const shz_mat4x4_t& actual) {
+        for(unsigned e = 0; e < 16; ++e)
+            if(std::abs(expected.elem[e] - actual.elem[e]) > CHAIN_ERROR * std::max(1.0f, std::abs(expected.elem[e])))
+                return false;
+
+        return true;
+    }
+
+    bool verify(shz::chain& chain) {
+        shz::mat4x4 expected;
+
+        reference(chain);
+        shz_xmtrx_store_4x4(&expected);
+
+        return compare(expected, chain.compile());
+    }
+
+    // Records a random affine operation onto the chain.
+    void record_affine(shz::chain& chain) {
+        switch(gblRandRange(0, 6)) {
+        case 0: chain.translate(gblRandUniform(-10.0f, 10.0f), gblRandUniform(-10.0f, 10.0f), gblRandUniform(-10.0f, 10.0f)); break;
+        case 1: chain.scale(gblRandUniform(0.5f, 2.0f), gblRandUniform(0.5f, 2.0f), gblRandUniform(0.5f, 2.0f)); break;
+        case 2: chain.rotate_x(gblRandUniform(-SHZ_F_PI, SHZ_F_PI)); break;
+        case 3: chain.rotate_y(gblRandUniform(-SHZ_F_PI, SHZ_F_PI)); break;
+        case 4: chain.rotate_z(gblRandUniform(-SHZ_F_PI, SHZ_F_PI)); break;
+        case 5: chain.rotate(shz::quat::from_angles_xyz(gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                                        gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                                        gblRandUniform(-SHZ_F_PI, SHZ_F_PI))); break;
+        default: chain.apply_screen(gblRandUniform(320.0f, 1280.0f), gblRandUniform(240.0f, 960.0f)); break;
+        }
+    }
+
+    // Records the camera of a typical scene: a viewport and projection, followed by its orientation and position.
+    void record_camera(shz::chain& chain, float yaw, float pitch, shz::vec3 pos) {
+        chain.begin();
+        chain.apply_screen(640.0f, 480.0f);
+        chain.apply_perspective(SHZ_DEG_TO_RAD(70.0f), 1.33333f, 0.1f);
+        chain.rotate_y(yaw);
+        chain.rotate_x(pitch);
+        chain.translate(-pos.x, pos.y, -pos.z);
+    }
+
+    // Issues the same camera operations directly against XMTRX.
+    void setup_camera(float yaw, float pitch, shz::vec3 pos) {
+        shz_xmtrx_init_identity();
+        shz_xmtrx_apply_screen(640.0f, 480.0f);
+        shz_xmtrx_apply_perspective(SHZ_DEG_TO_RAD(70.0f), 1.33333f, 0.1f);
+        shz_xmtrx_rotate_y(yaw);
+        shz_xmtrx_rotate_x(pitch);
+        shz_xmtrx_translate(-pos.x, pos.y, -pos.z);
+    }
+}
+
+GBL_TEST_CASE(compile_affine)
+    std::vector<shz::chain_op> ops(16);
+    shz::chain                 chain(ops.data(), ops.size());
+
+    GBL_TEST_VERIFY(verify(chain));
+
+    for(unsigned i = 0; i < 256; ++i) {
+        chain.begin();
+
+        for(size_t o = 0, count = gblRandRange(1, 16); o < count; ++o)
+            record_affine(chain);
+
+        GBL_TEST_VERIFY(verify(chain));
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(compile_projective)
+    std::vector<shz::chain_op> ops(16);
+    shz::chain                 chain(ops.data(), ops.size());
+    shz::mat4x4                matrix;
+
+    for(unsigned e = 0; e < 16; ++e)
+        matrix.elem[e] = gblRandUniform(-2.0f, 2.0f);
+
+    record_camera(chain, 0.5f, -0.25f, { 3.0f, 1.0f, -7.0f });
+    GBL_TEST_VERIFY(verify(chain));
+
+    // Projective operations may appear anywhere, including first or last.
+    for(unsigned i = 0; i < 256; ++i) {
+        chain.begin();
+
+        for(size_t o = 0, count = gblRandRange(1, 16); o < count; ++o)
+            switch(gblRandRange(0, 4)) {
+            case 0:  chain.apply_perspective(gblRandUniform(0.5f, 2.0f), gblRandUniform(0.75f, 2.0f), gblRandUniform(0.1f, 1.0f)); break;
+            case 1:  chain.apply(matrix); break;
+            default: record_affine(chain); break;
+            }
+
+        GBL_TEST_VERIFY(verify(chain));
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(cache)
+    std::vector<shz::chain_op> ops(8);
+    shz::chain                 chain(ops.data(), ops.size());
+    shz::mat4x4                matrix;
+
+    matrix.init_identity();
+
+    record_camera(chain, 0.5f, -0.25f, { 3.0f, 1.0f, -7.0f });
+    chain.apply(matrix);
+    chain.compile();
+    GBL_TEST_VERIFY(!chain.dirty);
+
+    // Re-recording the same inputs keeps the compiled matrix.
+    record_camera(chain, 0.5f, -0.25f, { 3.0f, 1.0f, -7.0f });
+    chain.apply(matrix);
+    GBL_TEST_VERIFY(!chain.dirty);
+    GBL_TEST_COMPARE(chain.count, chain.compiled);
+
+    // Any differing argument, operation, or length recompiles it.
+    record_camera(chain, 0.5f, -0.25f, { 3.0f, 1.5f, -7.0f });
+    chain.apply(matrix);
+    GBL_TEST_VERIFY(chain.dirty);
+    GBL_TEST_VERIFY(verify(chain));
+
+    record_camera(chain, 0.5f, -0.25f, { 3.0f, 1.5f, -7.0f });
+    chain.scale(1.0f, 2.0f, 3.0f);
+    GBL_TEST_VERIFY(chain.dirty);
+    GBL_TEST_VERIFY(verify(chain));
+
+    record_camera(chain, 0.5f, -0.25f, { 3.0f, 1.5f, -7.0f });
+    GBL_TEST_VERIFY(!chain.dirty);
+    GBL_TEST_VERIFY(chain.count != chain.compiled);
+    GBL_TEST_VERIFY(verify(chain));
+
+    // Referenced matrices modified in place require invalidation.
+    chain.apply(matrix);
+    chain.compile();
+    matrix.elem[3] = 2.0f;
+    chain.invalidate();
+    GBL_TEST_VERIFY(verify(chain));
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(load_apply)
+    std::vector<shz::chain_op> ops(8);
+    shz::chain                 chain(ops.data(), ops.size());
+    shz::mat4x4                base, expected, actual;
+
+    shz_mat4x4_init_rotation_xyz(&base, 0.25f, -1.0f, 2.0f);
+    record_camera(chain, 1.0f, 0.5f, { -2.0f, 4.0f, 1.0f });
+
+    // XMTRX is preserved while compiling for an application.
+    shz_xmtrx_load_4x4(&base);
+    chain.apply();
+    shz_xmtrx_store_4x4(&actual);
+
+    shz_mat4x4_mult(&expected, &base, &chain.compile());
+    GBL_TEST_VERIFY(compare(expected, actual));
+
+    shz_xmtrx_load_4x4(&base);
+    chain.apply();
+    shz_xmtrx_store_4x4(&actual);
+    GBL_TEST_VERIFY(compare(expected, actual));
+
+    chain.load();
+    shz_xmtrx_store_4x4(&actual);
+    GBL_TEST_VERIFY(compare(chain.compile(), actual));
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(camera_benchmark)
+    std::vector<shz::chain_op> ops(8);
+    shz::chain                 chain(ops.data(), ops.size());
+    float                      yaw = 0.0f;
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz::chain", [&] {
+                record_camera(chain, yaw += 0.01f, -0.25f, { 3.0f, 1.0f, -7.0f });
+                chain.load();
+            },
+            "shz_xmtrx", [&] {
+                setup_camera(yaw += 0.01f, -0.25f, { 3.0f, 1.0f, -7.0f });
+            }
+        )
+    );
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz::chain (cached)", [&] {
+                record_camera(chain, 0.5f, -0.25f, { 3.0f, 1.0f, -7.0f });
+                chain.load();
+            },
+            "shz_xmtrx", [&] {
+                setup_camera(0.5f, -0.25f, { 3.0f, 1.0f, -7.0f });
+            }
+        )
+    );
+GBL_TEST_CASE_END
+
+GBL_TEST_REGISTER(compile_affine,
+                  compile_projective,
+                  cache,
+                  load_apply,
+                  camera_benchmark)
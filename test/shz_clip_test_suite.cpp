@@ -0,0 +1,316 @@
+#include "shz_test.h"
+#include "shz_test.hpp"
+#include "sh4zam/shz_clip.hpp"
+
+#include <vector>
+#include <cstring>
+#include <cmath>
+
+#define GBL_SELF_TYPE   shz_clip_test_suite
+
+GBL_TEST_FIXTURE_NONE
+GBL_TEST_INIT_NONE
+GBL_TEST_FINAL_NONE
+
+namespace {
+    // Vertex carrying the barycentric coordinates of the input triangle it was clipped from.
+    struct vertex {
+        shz_vec4_t pos;
+        float      uv[2];
+        uint32_t   argb;
+        float      bary[3];
+    };
+
+    constexpr shz::clip_attrib attribs[] = {
+        { offsetof(vertex, uv),   SHZ_CLIP_ATTRIB_FLOAT,    2 },
+        { offsetof(vertex, argb), SHZ_CLIP_ATTRIB_ARGB8888, 1 },
+        { offsetof(vertex, bary), SHZ_CLIP_ATTRIB_FLOAT,    3 }
+    };
+
+    const shz::clip_layout layout(sizeof(vertex), offsetof(vertex, pos), attribs, std::size(attribs));
+
+    // Returns a random clip-space position, roughly 1 in 4 of which lie outside of any given plane.
+    shz_vec4_t random_position(float range = 2.0f) {
+        const float w = gblRandUniform(0.5f, 4.0f);
+
+        return shz_vec4_init(gblRandUniform(-range, range) * w,
+                             gblRandUniform(-range, range) * w,
+                             gblRandUniform(-range, range) * w,
+                             w);
+    }
+
+    vertex random_vertex(float range = 2.0f) {
+        uint32_t argb = 0;
+
+        for(unsigned shift = 0; shift < 32; shift += 8)
+            argb |= (uint32_t)gblRandRange(0, 255) << shift;
+
+        return { random_position(range),
+                 { gblRandUniform(0.0f, 1.0f), gblRandUniform(0.0f, 1.0f) },
+                 argb,
+                 { 0.0f, 0.0f, 0.0f } };
+    }
+
+    // Returns whether the position lies within the given planes, allowing for some slack around their boundaries.
+    bool inside(shz_vec4_t pos, uint8_t planes, float slack) {
+        const float w = pos.w + std::abs(pos.w) * slack;
+
+        return !((planes & SHZ_CLIP_LEFT)   && pos.x < -w) && !((planes & SHZ_CLIP_RIGHT) && pos.x > w) &&
+               !((planes & SHZ_CLIP_BOTTOM) && pos.y < -w) && !((planes & SHZ_CLIP_TOP)   && pos.y > w) &&
+               !((planes & SHZ_CLIP_NEAR)   && pos.z < -w) && !((planes & SHZ_CLIP_FAR)   && pos.z > w);
+    }
+
+    // Returns the position at the given barycentric coordinates within a triangle.
+    shz_vec4_t barycentric(const vertex* tri, const float* bary) {
+        return shz_vec4_add(shz_vec4_add(shz_vec4_scale(tri[0].pos, bary[0]),
+                                         shz_vec4_scale(tri[1].pos, bary[1])),
+                            shz_vec4_scale(tri[2].pos, bary[2]));
+    }
+
+    // Returns whether the 2D point \p p lies within the triangle \p a, \p b, \p c of either winding.
+    bool covers(shz_vec2_t a, shz_vec2_t b, shz_vec2_t c, shz_vec2_t p) {
+        auto edge = [](shz_vec2_t a, shz_vec2_t b, shz_vec2_t p) {
+            return (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+        };
+
+        const float e0 = edge(a, b, p), e1 = edge(b, c, p), e2 = edge(c, a, p);
+        constexpr float eps = 1e-5f;
+
+        return (e0 >= -eps && e1 >= -eps && e2 >= -eps) || (e0 <= eps && e1 <= eps && e2 <= eps);
+    }
+}
+
+GBL_TEST_CASE(outcodes)
+    std::vector<vertex>  vertices(1000);
+    std::vector<uint8_t> codes(vertices.size());
+    uint8_t              combined = 0;
+
+    for(auto& v : vertices)
+        v = random_vertex();
+
+    GBL_TEST_COMPARE(layout.outcodes(vertices.data(), vertices.size(), codes.data()), SHZ_CLIP_ALL);
+
+    for(size_t v = 0; v < vertices.size(); ++v) {
+        const shz_vec4_t pos  = vertices[v].pos;
+        uint8_t          code = 0;
+
+        for(unsigned a = 0; a < 3; ++a) {
+            if(pos.e[a] < -pos.w) code |= 1u << (a * 2);
+            if(pos.e[a] >  pos.w) code |= 1u << (a * 2 + 1);
+        }
+
+        GBL_TEST_COMPARE(codes[v], code);
+        GBL_TEST_COMPARE(shz::clip_outcode(pos), code);
+        combined |= code;
+    }
+
+    GBL_TEST_COMPARE(combined, SHZ_CLIP_ALL);
+
+    // A buffer lying within the clip volume needs no further work.
+    for(auto& v : vertices)
+        v = random_vertex(1.0f);
+
+    GBL_TEST_COMPARE(layout.outcodes(vertices.data(), vertices.size(), codes.data()), 0);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(triangles)
+    const uint8_t planeSets[] = { SHZ_CLIP_NEAR, SHZ_CLIP_NEAR | SHZ_CLIP_FAR, SHZ_CLIP_ALL };
+
+    for(uint8_t planes : planeSets) {
+        std::vector<vertex> out(shz_clip_vertices_max(1, planes));
+
+        for(unsigned i = 0; i < 1000; ++i) {
+            vertex  tri[3] = { random_vertex(), random_vertex(), random_vertex() };
+            uint8_t codes[3];
+
+            for(unsigned v = 0; v < 3; ++v)
+                tri[v].bary[v] = 1.0f;
+
+            layout.outcodes(tri, 3, codes);
+
+            const size_t count = layout.triangles(tri, codes, 3, planes, out.data());
+
+            GBL_TEST_VERIFY(count % 3 == 0 && count <= out.size());
+
+            if(codes[0] & codes[1] & codes[2]) {
+                GBL_TEST_COMPARE(count, 0);
+                continue;
+            }
+
+            // Triangles not crossing the planes are passed through untouched.
+            if(!((codes[0] | codes[1] | codes[2]) & planes)) {
+                GBL_TEST_COMPARE(count, 3);
+                GBL_TEST_VERIFY(!std::memcmp(out.data(), tri, sizeof(tri)));
+                continue;
+            }
+
+            for(size_t v = 0; v < count; ++v) {
+                const vertex&    o   = out[v];
+                const shz_vec4_t pos = barycentric(tri, o.bary);
+
+                // Clipped vertices lie within the planes, with every attribute interpolated alongside the position.
+                GBL_TEST_VERIFY(inside(o.pos, planes, 1e-3f));
+                GBL_TEST_VERIFY(shz_equalf(shz_vec4_distance(o.pos, pos) / (1.0f + shz_vec4_magnitude(pos)), 0.0f));
+                GBL_TEST_VERIFY(shz_equalf(o.bary[0] + o.bary[1] + o.bary[2], 1.0f));
+
+                for(unsigned c = 0; c < 2; ++c) {
+                    const float uv = o.bary[0] * tri[0].uv[c] + o.bary[1] * tri[1].uv[c] + o.bary[2] * tri[2].uv[c];
+                    GBL_TEST_VERIFY(std::abs(o.uv[c] - uv) < 1e-3f);
+                }
+
+                for(unsigned shift = 0; shift < 32; shift += 8) {
+                    float channel = 0.0f;
+
+                    for(unsigned t = 0; t < 3; ++t)
+                        channel += o.bary[t] * (float)((tri[t].argb >> shift) & 0xff);
+
+                    // Each clipped edge may round its colors once more.
+                    GBL_TEST_VERIFY(std::abs((float)((o.argb >> shift) & 0xff) - channel) <= 6.0f);
+                }
+            }
+
+            // Every point of the triangle within the planes is covered by what's left of it.
+            for(unsigned s = 0; s < 64; ++s) {
+                float bary[3] = { gblRandUniform(0.0f, 1.0f), gblRandUniform(0.0f, 1.0f), 0.0f };
+
+                if(bary[0] + bary[1] > 1.0f) {
+                    bary[0] = 1.0f - bary[0];
+                    bary[1] = 1.0f - bary[1];
+                }
+
+                bary[2] = 1.0f - bary[0] - bary[1];
+
+                if(!inside(barycentric(tri, bary), planes, -1e-3f))
+                    continue;
+
+                bool covered = false;
+
+                for(size_t t = 0; t < count && !covered; t += 3)
+                    covered = covers(shz_vec2_init(out[t].bary[0],     out[t].bary[1]),
+                                     shz_vec2_init(out[t + 1].bary[0], out[t + 1].bary[1]),
+                                     shz_vec2_init(out[t + 2].bary[0], out[t + 2].bary[1]),
+                                     shz_vec2_init(bary[0], bary[1]));
+
+                GBL_TEST_VERIFY(covered);
+            }
+        }
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(strip)
+    constexpr size_t    count = 256;
+    std::vector<vertex> strip(count), list;
+
+    for(auto& v : strip)
+        v = random_vertex();
+
+    // Unrolls the strip into a list of triangles, swapping every odd triangle's first two vertices.
+    for(size_t t = 0; t + 2 < count; ++t) {
+        list.push_back(strip[t + (t & 1)]);
+        list.push_back(strip[t + !(t & 1)]);
+        list.push_back(strip[t + 2]);
+    }
+
+    std::vector<uint8_t> stripCodes(strip.size()), listCodes(list.size());
+    std::vector<vertex>  stripOut(shz_clip_vertices_max(count - 2, SHZ_CLIP_ALL));
+    std::vector<vertex>  listOut(stripOut.size());
+
+    layout.outcodes(strip.data(), strip.size(), stripCodes.data());
+    layout.outcodes(list.data(), list.size(), listCodes.data());
+
+    for(uint8_t planes : { (uint8_t)SHZ_CLIP_NEAR, (uint8_t)SHZ_CLIP_ALL }) {
+        const size_t stripCount = layout.strip(strip.data(), stripCodes.data(), strip.size(), planes, stripOut.data());
+        const size_t listCount  = layout.triangles(list.data(), listCodes.data(), list.size(), planes, listOut.data());
+
+        GBL_TEST_VERIFY(stripCount > 0);
+        GBL_TEST_COMPARE(stripCount, listCount);
+        GBL_TEST_VERIFY(!std::memcmp(stripOut.data(), listOut.data(), stripCount * sizeof(vertex)));
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(clip_benchmark)
+    constexpr size_t     count = 999;
+    std::vector<vertex>  vertices(count), out(shz_clip_vertices_max(count / 3, SHZ_CLIP_NEAR));
+    std::vector<uint8_t> codes(count);
+
+    // Clips each triangle against the near plane by hand, as would be done without the clipping API.
+    auto by_hand = [&] {
+        vertex* dst = out.data();
+
+        for(size_t t = 0; t < count; t += 3) {
+            const vertex* tri = &vertices[t];
+            unsigned      vis = 0;
+
+            for(unsigned v = 0; v < 3; ++v)
+                vis |= (tri[v].pos.z >= -tri[v].pos.w) << v;
+
+            if(!vis)
+                continue;
+
+            if(vis == 7) {
+                dst[0] = tri[0]; dst[1] = tri[1]; dst[2] = tri[2];
+                dst += 3;
+                continue;
+            }
+
+            vertex   poly[4];
+            unsigned n = 0;
+
+            for(unsigned v = 0; v < 3; ++v) {
+                const vertex& a = tri[v];
+                const vertex& b = tri[(v + 1) % 3];
+                const float   da = a.pos.w + a.pos.z, db = b.pos.w + b.pos.z;
+
+                if(da >= 0.0f)
+                    poly[n++] = a;
+
+                if((da >= 0.0f) != (db >= 0.0f)) {
+                    const float t = da / (da - db);
+                    vertex&     o = poly[n++];
+
+                    o       = a;
+                    o.pos   = shz_vec4_lerp(a.pos, b.pos, t);
+                    o.uv[0] = shz_lerpf(a.uv[0], b.uv[0], t);
+                    o.uv[1] = shz_lerpf(a.uv[1], b.uv[1], t);
+                }
+            }
+
+            for(unsigned v = 1; v + 1 < n; ++v) {
+                dst[0] = poly[0]; dst[1] = poly[v]; dst[2] = poly[v + 1];
+                dst += 3;
+            }
+        }
+    };
+
+    auto with_shz = [&] {
+        if(layout.outcodes(vertices.data(), count, codes.data()) & SHZ_CLIP_NEAR)
+            layout.triangles(vertices.data(), codes.data(), count, SHZ_CLIP_NEAR, out.data());
+    };
+
+    // In the common case of every vertex being visible, only the outcodes are computed.
+    for(auto& v : vertices)
+        v = random_vertex(1.0f);
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz_clip_outcodes", with_shz,
+            "nearz_clip", by_hand
+        )
+    );
+
+    // Throughput in vertices processed per millisecond.
+    throughput_report("visible", "vertices/ms", count, 1000000, with_shz);
+    throughput_report("visible (by hand)", "vertices/ms", count, 1000000, by_hand);
+
+    // Some fraction of triangles straddle the near plane.
+    for(auto& v : vertices)
+        v = random_vertex(1.2f);
+
+    throughput_report("straddling", "vertices/ms", count, 1000000, with_shz);
+    throughput_report("straddling (by hand)", "vertices/ms", count, 1000000, by_hand);
+GBL_TEST_CASE_END
+
+GBL_TEST_REGISTER(outcodes,
+                  triangles,
+                  strip,
+                  clip_benchmark)
@@ -0,0 +1,276 @@
+#include "shz_test.h"
+#include "shz_test.hpp"
+#include "sh4zam/shz_color.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#define GBL_SELF_TYPE   shz_color_test_suite
+
+GBL_TEST_FIXTURE_NONE
+GBL_TEST_INIT_NONE
+GBL_TEST_FINAL_NONE
+
+namespace {
+    constexpr shz::color_format formats[] = { SHZ_COLOR_ARGB1555, SHZ_COLOR_RGB565, SHZ_COLOR_ARGB4444 };
+
+    uint32_t random_color() {
+        uint32_t argb = 0;
+
+        for(unsigned shift = 0; shift < 32; shift += 8)
+            argb |= (uint32_t)gblRandRange(0, 255) << shift;
+
+        return argb;
+    }
+
+    std::vector<uint32_t> random_colors(size_t count) {
+        std::vector<uint32_t> colors(count);
+
+        for(auto& c : colors)
+            c = random_color();
+
+        return colors;
+    }
+
+    unsigned channel(uint32_t argb, unsigned c) {
+        return (argb >> (c * 8)) & 0xff;
+    }
+
+    // Returns the largest difference between any two channels of the packed colors.
+    int channel_error(uint32_t a, uint32_t b) {
+        int error = 0;
+
+        for(unsigned c = 0; c < 4; ++c)
+            error = std::max(error, std::abs((int)channel(a, c) - (int)channel(b, c)));
+
+        return error;
+    }
+
+    // Applies \p op to each channel of two colors, as a reference for the packed routines.
+    template<typename F>
+    uint32_t per_channel(uint32_t a, uint32_t b, F&& op) {
+        uint32_t result = 0;
+
+        for(unsigned c = 0; c < 4; ++c)
+            result |= (uint32_t)op(channel(a, c), channel(b, c)) << (c * 8);
+
+        return result;
+    }
+}
+
+GBL_TEST_CASE(pack_unpack)
+    // Every byte survives a round trip through floats.
+    for(unsigned v = 0; v < 256; ++v) {
+        const uint32_t argb = v * 0x01010101u ^ 0x00ff00ffu;
+
+        GBL_TEST_COMPARE(shz::color_pack(shz::color_unpack(argb)), argb);
+    }
+
+    GBL_TEST_COMPARE(shz::color_pack(shz_vec4_init(1.0f, 0.5f, 0.0f, 1.0f)), 0xffff8000u);
+    GBL_TEST_COMPARE(shz::color_pack(shz_vec4_init(2.0f, -1.0f, 1.5f, -0.5f)), 0x00ff00ffu);
+    GBL_TEST_VERIFY(shz::color_unpack(0x80ff4000u) == shz::vec4(1.0f, 64.0f / 255.0f, 0.0f, 128.0f / 255.0f));
+
+    constexpr size_t        count = 67;
+    auto                    colors = random_colors(count);
+    std::vector<shz_vec4_t> floats(count);
+    std::vector<uint32_t>   packed(count);
+
+    shz::color_unpack(floats.data(), colors.data(), count);
+    shz::color_pack(packed.data(), floats.data(), count);
+
+    for(size_t i = 0; i < count; ++i) {
+        GBL_TEST_VERIFY(shz::vec4(floats[i]) == shz::color_unpack(colors[i]));
+        GBL_TEST_COMPARE(packed[i], colors[i]);
+    }
+
+    // Channels out of range saturate within arrays too.
+    for(auto& f : floats)
+        f = shz_vec4_init(gblRandUniform(-2.0f, 2.0f), gblRandUniform(-2.0f, 2.0f),
+                          gblRandUniform(-2.0f, 2.0f), gblRandUniform(-2.0f, 2.0f));
+
+    shz::color_pack(packed.data(), floats.data(), count);
+
+    for(size_t i = 0; i < count; ++i)
+        GBL_TEST_VERIFY(channel_error(packed[i], shz::color_pack(floats[i])) <= 1);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(convert16)
+    constexpr unsigned bits[][4] = {
+        { 5, 5, 5, 1 },    // ARGB1555, as <B, G, R, A>
+        { 5, 6, 5, 0 },    // RGB565
+        { 4, 4, 4, 4 }     // ARGB4444
+    };
+
+    for(unsigned f = 0; f < std::size(formats); ++f) {
+        std::vector<uint16_t> wide(65536), narrow(65536);
+        std::vector<uint32_t> expanded(65536);
+
+        for(uint32_t c = 0; c < 65536; ++c)
+            wide[c] = (uint16_t)c;
+
+        shz::color_from16(expanded.data(), wide.data(), wide.size(), formats[f]);
+        shz::color_to16(narrow.data(), expanded.data(), expanded.size(), formats[f]);
+
+        for(uint32_t c = 0; c < 65536; ++c) {
+            uint32_t shift = 0, expected = 0;
+
+            // Each channel widens by repeating its bits, with missing alpha being opaque.
+            for(unsigned ch = 0; ch < 4; ++ch) {
+                const unsigned n = bits[f][ch];
+                uint32_t       v = 255;
+
+                if(n) {
+                    const uint32_t field = (c >> shift) & ((1u << n) - 1);
+
+                    v = 0;
+                    for(int pos = 8 - (int)n; pos > -(int)n; pos -= n)
+                        v |= (pos >= 0)? field << pos : field >> -pos;
+                }
+
+                expected |= v << (ch * 8);
+                shift    += n;
+            }
+
+            GBL_TEST_COMPARE(expanded[c], expected);
+            GBL_TEST_COMPARE(shz::color_from16((uint16_t)c, formats[f]), expected);
+
+            // Narrowing a widened color recovers it exactly.
+            GBL_TEST_COMPARE(narrow[c], (uint16_t)c);
+        }
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(blend)
+    constexpr size_t count = 131;
+    auto             a     = random_colors(count);
+    auto             b     = random_colors(count);
+    std::vector<uint32_t> out(count);
+
+    for(float t : { 0.0f, 0.25f, 0.6f, 1.0f, -1.0f, 2.0f }) {
+        const double w = std::clamp((double)t, 0.0, 1.0);
+
+        shz::color_lerp(out.data(), a.data(), b.data(), count, t);
+
+        for(size_t i = 0; i < count; ++i) {
+            const uint32_t expected = per_channel(a[i], b[i], [&](unsigned x, unsigned y) {
+                return (unsigned)std::lround(x + (y - (double)x) * w);
+            });
+
+            GBL_TEST_VERIFY(channel_error(shz::color_lerp(a[i], b[i], t), expected) <= 1);
+            GBL_TEST_COMPARE(out[i], shz::color_lerp(a[i], b[i], t));
+        }
+    }
+
+    GBL_TEST_COMPARE(shz::color_lerp(0x00000000u, 0xffffffffu, 1.0f), 0xffffffffu);
+    GBL_TEST_COMPARE(shz::color_lerp(0xffffffffu, 0x00000000u, 0.0f), 0xffffffffu);
+
+    shz::color_modulate(out.data(), a.data(), b.data(), count);
+
+    for(size_t i = 0; i < count; ++i) {
+        const uint32_t expected = per_channel(a[i], b[i], [](unsigned x, unsigned y) {
+            return (unsigned)std::lround(x * y / 255.0);
+        });
+
+        GBL_TEST_COMPARE(shz::color_modulate(a[i], b[i]), expected);
+        GBL_TEST_COMPARE(out[i], expected);
+    }
+
+    // Blending in-place, with the destination being one of the sources.
+    auto sum = a;
+
+    shz::color_add(sum.data(), sum.data(), b.data(), count);
+
+    for(size_t i = 0; i < count; ++i) {
+        const uint32_t expected = per_channel(a[i], b[i], [](unsigned x, unsigned y) {
+            return std::min(x + y, 255u);
+        });
+
+        GBL_TEST_COMPARE(shz::color_add(a[i], b[i]), expected);
+        GBL_TEST_COMPARE(sum[i], expected);
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(dither)
+    constexpr size_t      width = 16, height = 8;
+    std::vector<uint32_t> image(width * height), decoded(width * height);
+    std::vector<uint16_t> dithered(width * height);
+
+    for(auto format : formats) {
+        // Averaged over each 4x4 tile, a flat color dithers out to within a fraction of a step of itself.
+        for(unsigned v = 0; v < 256; ++v) {
+            std::fill(image.begin(), image.end(), v * 0x00010101u | 0xff000000u);
+
+            shz::color_dither16(dithered.data(), image.data(), width, height, format);
+            shz::color_from16(decoded.data(), dithered.data(), decoded.size(), format);
+
+            double mean = 0.0;
+
+            for(size_t y = 0; y < 4; ++y)
+                for(size_t x = 0; x < 4; ++x)
+                    mean += channel(decoded[y * width + x], 2) / 16.0;
+
+            GBL_TEST_VERIFY(std::abs(mean - v) <= 1.5);
+        }
+
+        // Every 4x4 tile is dithered identically.
+        for(auto& c : image)
+            c = 0xff808080u;
+
+        shz::color_dither16(dithered.data(), image.data(), width, height, format);
+
+        for(size_t y = 0; y < height; ++y)
+            for(size_t x = 0; x < width; ++x)
+                GBL_TEST_COMPARE(dithered[y * width + x], dithered[(y & 3) * width + (x & 3)]);
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(color_benchmark)
+    constexpr size_t        count = 1024;
+    auto                    a     = random_colors(count);
+    auto                    b     = random_colors(count);
+    std::vector<uint32_t>   out(count);
+    std::vector<shz_vec4_t> floats(count);
+    std::vector<uint16_t>   narrow(count);
+
+    // Lerps each channel with floats, one at a time, as would be done without the color API.
+    auto by_hand = [&] {
+        for(size_t i = 0; i < count; ++i) {
+            uint32_t result = 0;
+
+            for(unsigned c = 0; c < 4; ++c)
+                result |= (uint32_t)shz_lerpf((float)channel(a[i], c), (float)channel(b[i], c), 0.3f) << (c * 8);
+
+            out[i] = result;
+        }
+    };
+
+    auto with_shz = [&] {
+        shz::color_lerp(out.data(), a.data(), b.data(), count, 0.3f);
+    };
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz::color_lerp", with_shz,
+            "color_lerp by hand", by_hand
+        )
+    );
+
+    // Throughput in pixels per second.
+    throughput_report("lerp", "pixels/s", count, 1000000000, with_shz);
+    throughput_report("lerp (by hand)", "pixels/s", count, 1000000000, by_hand);
+    throughput_report("modulate", "pixels/s", count, 1000000000, [&] { shz::color_modulate(out.data(), a.data(), b.data(), count); });
+    throughput_report("add", "pixels/s", count, 1000000000, [&] { shz::color_add(out.data(), a.data(), b.data(), count); });
+    throughput_report("pack", "pixels/s", count, 1000000000, [&] { shz::color_pack(out.data(), floats.data(), count); });
+    throughput_report("unpack", "pixels/s", count, 1000000000, [&] { shz::color_unpack(floats.data(), a.data(), count); });
+    throughput_report("to16 (RGB565)", "pixels/s", count, 1000000000, [&] { shz::color_to16(narrow.data(), a.data(), count, SHZ_COLOR_RGB565); });
+    throughput_report("from16 (RGB565)", "pixels/s", count, 1000000000, [&] { shz::color_from16(out.data(), narrow.data(), count, SHZ_COLOR_RGB565); });
+    throughput_report("dither16 (RGB565)", "pixels/s", count, 1000000000, [&] { shz::color_dither16(narrow.data(), a.data(), 32, count / 32, SHZ_COLOR_RGB565); });
+GBL_TEST_CASE_END
+
+GBL_TEST_REGISTER(pack_unpack,
+                  convert16,
+                  blend,
+                  dither,
+                  color_benchmark)
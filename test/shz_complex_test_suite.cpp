@@ -1214,13 +1214,457 @@ GBL_TEST_CASE(fft)
 
     GBL_TEST_VERIFY(
         (benchmark_cmp<std::nullptr_t>(
-            "shz::fft",         shz::fft,
+            "shz::fft",         [](shz_complex_t* s, size_t size) { shz::fft(s, size); },
             "cooley_tukey_fft", cooley_tukey_fft,
             samples[0], 1024
         ))
     );
 GBL_TEST_CASE_END
 
+GBL_TEST_CASE(fft_fixed)
+    constexpr float FFT_ERROR_MAX = 1e-3f;
+    alignas(8) static shz::complex samples[4][1024];
+
+    auto verify = [&]<size_t N>() {
+        for(unsigned s = 0; s < N; ++s) {
+            samples[0][s] = samples[1][s] = samples[2][s] = samples[3][s] =
+                shz_cinitf(gblRandUniform(-1.0f, 1.0f), gblRandUniform(-1.0f, 1.0f));
+        }
+
+        // Both the in-place and the out-of-place forms must match the reference.
+        shz::fft<N>(samples[0]);
+        shz::fft<N>(samples[2], samples[1]);
+        cooley_tukey_fft(samples[3], N);
+
+        for(unsigned s = 0; s < N; ++s) {
+            GBL_TEST_ERROR(samples[3][s].real, samples[0][s].real, FFT_ERROR_MAX, GBL_TEST_ERROR_FUZZY);
+            GBL_TEST_ERROR(samples[3][s].imag, samples[0][s].imag, FFT_ERROR_MAX, GBL_TEST_ERROR_FUZZY);
+            GBL_TEST_ERROR(samples[3][s].real, samples[2][s].real, FFT_ERROR_MAX, GBL_TEST_ERROR_FUZZY);
+            GBL_TEST_ERROR(samples[3][s].imag, samples[2][s].imag, FFT_ERROR_MAX, GBL_TEST_ERROR_FUZZY);
+        }
+
+        std::print("Fixed-size FFT, {} points:\n", N);
+        GBL_TEST_VERIFY(
+            (benchmark_cmp<std::nullptr_t>(
+                "shz::fft<N>", [](shz_complex_t* s) { shz::fft<N>(s); },
+                "shz::fft",    [](shz_complex_t* s) { shz::fft(s, N); },
+                samples[0]
+            ))
+        );
+    };
+
+    // Fully unrolled sizes, followed by those built from radix-4 passes.
+    verify.template operator()<2>();
+    verify.template operator()<4>();
+    verify.template operator()<8>();
+    verify.template operator()<16>();
+    verify.template operator()<32>();
+    verify.template operator()<64>();
+    verify.template operator()<128>();
+    verify.template operator()<256>();
+    verify.template operator()<1024>();
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(fft_batch)
+    constexpr size_t channels = 8;
+    constexpr size_t size     = 256;
+    alignas(8) static shz::complex samples[3][channels][size];
+    shz_complex_t* pointers[channels];
+
+    for(unsigned c = 0; c < channels; ++c) {
+        pointers[c] = samples[1][c];
+
+        for(unsigned s = 0; s < size; ++s) {
+            samples[0][c][s].real = samples[1][c][s].real = samples[2][c][s].real = gblRandUniform(0.0f, 1.0f);
+            samples[0][c][s].imag = samples[1][c][s].imag = samples[2][c][s].imag = gblRandUniform(0.0f, 1.0f);
+        }
+
+        shz::fft(samples[0][c], size);
+    }
+
+    // Both batched forms must match transforming each channel individually.
+    shz::fft_batch(pointers, channels, size);
+    shz::fft_batch_contiguous(&samples[2][0][0], channels, size);
+
+    for(unsigned c = 0; c < channels; ++c) {
+        for(unsigned s = 0; s < size; ++s) {
+            GBL_TEST_ERROR(samples[0][c][s].real, samples[1][c][s].real, SHZ_COMPLEX_ERROR_EXACT, GBL_TEST_ERROR_ABSOLUTE);
+            GBL_TEST_ERROR(samples[0][c][s].imag, samples[1][c][s].imag, SHZ_COMPLEX_ERROR_EXACT, GBL_TEST_ERROR_ABSOLUTE);
+            GBL_TEST_ERROR(samples[0][c][s].real, samples[2][c][s].real, SHZ_COMPLEX_ERROR_EXACT, GBL_TEST_ERROR_ABSOLUTE);
+            GBL_TEST_ERROR(samples[0][c][s].imag, samples[2][c][s].imag, SHZ_COMPLEX_ERROR_EXACT, GBL_TEST_ERROR_ABSOLUTE);
+        }
+    }
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<std::nullptr_t>(
+            "shz::fft_batch", [&](shz_complex_t** p) { shz::fft_batch(p, channels, size); },
+            "shz::fft",       [&](shz_complex_t** p) {
+                for(unsigned c = 0; c < channels; ++c)
+                    shz::fft(p[c], size);
+            },
+            pointers
+        ))
+    );
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(fft_plan)
+    constexpr float FFT_ERROR_MAX  = 1.0f;
+    constexpr float IFFT_ERROR_MAX = 1e-4f;
+    alignas(8) static shz::complex samples[3][1024];
+    alignas(8) static shz::complex spectrum[513];
+    alignas(8) static float        reals[2][1024];
+    alignas(8) static char         storage[SHZ_FFT_PLAN_STORAGE_SIZE(1024)];
+
+    shz::fft_plan plan(1024, storage);
+
+    for(unsigned s = 0; s < 1024; ++s) {
+        samples[0][s].real = samples[1][s].real = reals[0][s] = gblRandUniform(0.0f, 1.0f);
+        samples[0][s].imag = samples[1][s].imag = 0.0f;
+    }
+
+    // Out-of-place forward transform against the reference.
+    plan.forward(samples[2], samples[0]);
+    cooley_tukey_fft(samples[1], 1024);
+
+    for(unsigned s = 0; s < 1024; ++s) {
+        GBL_TEST_ERROR(samples[1][s].real, samples[2][s].real, FFT_ERROR_MAX, GBL_TEST_ERROR_FUZZY);
+        GBL_TEST_ERROR(samples[1][s].imag, samples[2][s].imag, FFT_ERROR_MAX, GBL_TEST_ERROR_FUZZY);
+    }
+
+    // Real transform must produce the non-redundant half of the same spectrum.
+    plan.real_forward(spectrum, reals[0]);
+
+    for(unsigned s = 0; s <= 512; ++s) {
+        GBL_TEST_ERROR(samples[1][s].real, spectrum[s].real, FFT_ERROR_MAX, GBL_TEST_ERROR_FUZZY);
+        GBL_TEST_ERROR(samples[1][s].imag, spectrum[s].imag, FFT_ERROR_MAX, GBL_TEST_ERROR_FUZZY);
+    }
+
+    // In-place inverse transforms must round-trip back to the original samples.
+    plan.inverse(samples[2]);
+    plan.real_inverse(reals[1], spectrum);
+
+    for(unsigned s = 0; s < 1024; ++s) {
+        GBL_TEST_ERROR(samples[0][s].real, samples[2][s].real, IFFT_ERROR_MAX, GBL_TEST_ERROR_ABSOLUTE);
+        GBL_TEST_ERROR(samples[0][s].imag, samples[2][s].imag, IFFT_ERROR_MAX, GBL_TEST_ERROR_ABSOLUTE);
+        GBL_TEST_ERROR(reals[0][s], reals[1][s], IFFT_ERROR_MAX, GBL_TEST_ERROR_ABSOLUTE);
+    }
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<std::nullptr_t>(
+            "shz::fft_plan::forward", [&](shz::complex* s) { plan.forward(s); },
+            "shz::fft",               [](shz::complex* s) { shz::fft(s, 1024); },
+            samples[0]
+        ))
+    );
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<std::nullptr_t>(
+            "shz::fft_plan::real_forward", [&](float* s) { plan.real_forward(spectrum, s); },
+            "shz::fft_plan::forward",      [&](float*)   { plan.forward(samples[0]); },
+            reals[0]
+        ))
+    );
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(dct)
+    constexpr size_t size      = 256;
+    constexpr float  DCT_ERROR = 2e-3f;
+    alignas(8) static float input[3 * size], output[2 * size], expected[2 * size], window[2 * size];
+    alignas(8) static float frames[2][2 * size];
+    alignas(8) static char  storage[SHZ_DCT_PLAN_STORAGE_SIZE(size)];
+
+    shz::dct_plan plan(size, storage);
+
+    // Naive O(N^2) references, as used by codecs without fast transforms.
+    auto dct2_ref = [](float* dst, const float* src) {
+        for(size_t k = 0; k < size; ++k) {
+            double sum = 0.0;
+            for(size_t n = 0; n < size; ++n)
+                sum += src[n] * cos(SHZ_F_PI / size * (n + 0.5) * k);
+            dst[k] = (float)sum;
+        }
+    };
+
+    auto dct4_ref = [](float* dst, const float* src) {
+        for(size_t k = 0; k < size; ++k) {
+            double sum = 0.0;
+            for(size_t n = 0; n < size; ++n)
+                sum += src[n] * cos(SHZ_F_PI / size * (n + 0.5) * (k + 0.5));
+            dst[k] = (float)sum;
+        }
+    };
+
+    for(size_t n = 0; n < 3 * size; ++n)
+        input[n] = gblRandUniform(-1.0f, 1.0f);
+
+    // DCT-II against the reference, then DCT-III back to the input.
+    plan.dct2(output, input);
+    dct2_ref(expected, input);
+    for(size_t k = 0; k < size; ++k)
+        GBL_TEST_ERROR(expected[k], output[k], DCT_ERROR, GBL_TEST_ERROR_ABSOLUTE);
+
+    plan.dct3(output, output);
+    for(size_t n = 0; n < size; ++n)
+        GBL_TEST_ERROR(input[n], output[n], SHZ_COMPLEX_ERROR_EXACT, GBL_TEST_ERROR_ABSOLUTE);
+
+    // DCT-IV against the reference, then DCT-IV back to the input.
+    plan.dct4(output, input);
+    dct4_ref(expected, input);
+    for(size_t k = 0; k < size; ++k)
+        GBL_TEST_ERROR(expected[k], output[k], DCT_ERROR, GBL_TEST_ERROR_ABSOLUTE);
+
+    plan.dct4(output, output);
+    for(size_t n = 0; n < size; ++n)
+        GBL_TEST_ERROR(input[n], output[n] * 2.0f / size, SHZ_COMPLEX_ERROR_EXACT, GBL_TEST_ERROR_ABSOLUTE);
+
+    // MDCT against the reference, then an IMDCT, which undoes everything but time-domain aliasing.
+    plan.mdct(output, input);
+    for(size_t k = 0; k < size; ++k) {
+        double sum = 0.0;
+        for(size_t n = 0; n < 2 * size; ++n)
+            sum += input[n] * cos(SHZ_F_PI / size * (n + 0.5 + size / 2) * (k + 0.5));
+        GBL_TEST_ERROR((float)sum, output[k], DCT_ERROR, GBL_TEST_ERROR_ABSOLUTE);
+    }
+
+    // With a sine window, overlap-adding consecutive frames cancels their time-domain aliasing.
+    for(size_t n = 0; n < 2 * size; ++n)
+        window[n] = sinf(SHZ_F_PI / (2 * size) * (n + 0.5f));
+
+    for(size_t f = 0; f < 2; ++f) {
+        for(size_t n = 0; n < 2 * size; ++n)
+            expected[n] = input[f * size + n] * window[n];
+
+        plan.mdct(output, expected);
+        plan.imdct(frames[f], output);
+    }
+
+    for(size_t n = 0; n < size; ++n)
+        GBL_TEST_ERROR(input[size + n],
+                       frames[0][size + n] * window[size + n] + frames[1][n] * window[n],
+                       SHZ_COMPLEX_ERROR_EXACT, GBL_TEST_ERROR_ABSOLUTE);
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<std::nullptr_t>(
+            "shz::dct_plan::dct2", [&](float* s) { plan.dct2(output, s); },
+            "dct2_ref",            [&](float* s) { dct2_ref(output, s); },
+            input
+        ))
+    );
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(fir)
+    constexpr size_t samples = 1024;
+    constexpr size_t block   = 64;
+    alignas(8) static float input[samples], output[samples], expected[samples];
+    alignas(8) static float coeffs[512];
+    alignas(8) static char  storage[65536];
+
+    for(size_t i = 0; i < samples; ++i)
+        input[i] = gblRandUniform(-1.0f, 1.0f);
+
+    for(size_t t = 0; t < 512; ++t)
+        coeffs[t] = gblRandUniform(-1.0f, 1.0f) / 16.0f;
+
+    for(auto method: { SHZ_FIR_METHOD_DIRECT, SHZ_FIR_METHOD_FFT }) {
+        for(size_t taps: { 1, 7, 64, 200 }) {
+            GBL_TEST_VERIFY(shz::fir::storage_size(taps, block, method) <= sizeof(storage));
+            shz::fir filter(coeffs, taps, block, method, storage);
+            const size_t latency = filter.latency();
+
+            for(size_t n = 0; n < samples; ++n) {
+                expected[n] = 0.0f;
+
+                for(size_t t = 0; t < taps && t + latency <= n; ++t)
+                    expected[n] += coeffs[t] * input[n - latency - t];
+            }
+
+            // Stream through unevenly sized chunks, with one of them filtered in-place.
+            for(size_t n = 0; n < 37; ++n)
+                output[n] = input[n];
+
+            filter.process(output, output, 37);
+            filter.process(&output[37], &input[37], 300);
+            filter.process(&output[337], &input[337], samples - 337);
+
+            for(size_t n = 0; n < samples; ++n)
+                GBL_TEST_ERROR(expected[n], output[n], SHZ_COMPLEX_ERROR_EXACT, GBL_TEST_ERROR_ABSOLUTE);
+
+            // Resetting must produce the same output again.
+            filter.reset();
+            filter.process(output, input, samples);
+            GBL_TEST_ERROR(expected[samples - 1], output[samples - 1], SHZ_COMPLEX_ERROR_EXACT, GBL_TEST_ERROR_ABSOLUTE);
+        }
+    }
+
+    GBL_TEST_VERIFY(shz::fir(coeffs, 7, block, SHZ_FIR_METHOD_FFT, storage).latency() == block);
+
+    // Find the crossover point between direct-form and FFT convolution.
+    for(size_t taps = 8; taps <= 512; taps <<= 1) {
+        alignas(8) static char fft_storage[65536];
+        shz::fir direct(coeffs, taps, block, SHZ_FIR_METHOD_DIRECT, storage);
+        shz::fir fft(coeffs, taps, block, SHZ_FIR_METHOD_FFT, fft_storage);
+
+        std::print("FIR crossover, {} taps:\n", taps);
+        GBL_TEST_VERIFY(
+            (benchmark_cmp<std::nullptr_t>(
+                "shz::fir[FFT]",    [&](float* s) { fft.process(output, s, samples); },
+                "shz::fir[DIRECT]", [&](float* s) { direct.process(output, s, samples); },
+                input
+            ))
+        );
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(stft)
+    constexpr size_t size    = 64;
+    constexpr size_t hop     = 24;
+    constexpr size_t bins    = size / 2 + 1;
+    constexpr size_t samples = 500;
+    alignas(8) static float input[samples], window[size], frames[samples / hop + 1][bins];
+    alignas(8) static char  storage[SHZ_STFT_STORAGE_SIZE(size)];
+
+    for(size_t i = 0; i < samples; ++i)
+        input[i] = gblRandUniform(-1.0f, 1.0f);
+
+    // Windows are periodic, so they tile evenly when overlapped.
+    const struct { shz_window_t type; double a0, a1, a2; } windows[] = {
+        { SHZ_WINDOW_RECTANGULAR, 1.0,  0.0,  0.0  },
+        { SHZ_WINDOW_HANN,        0.5,  0.5,  0.0  },
+        { SHZ_WINDOW_HAMMING,     0.54, 0.46, 0.0  },
+        { SHZ_WINDOW_BLACKMAN,    0.42, 0.5,  0.08 }
+    };
+
+    for(const auto& w: windows) {
+        shz::window_init(window, size, w.type);
+
+        for(size_t n = 0; n < size; ++n) {
+            const double x = 2.0 * SHZ_F_PI * n / size;
+            GBL_TEST_ERROR(w.a0 - w.a1 * cos(x) + w.a2 * cos(2.0 * x), window[n],
+                           SHZ_COMPLEX_ERROR_EXACT, GBL_TEST_ERROR_ABSOLUTE);
+        }
+    }
+
+    // Naive DFT of the frame of samples ending just before sample end.
+    auto frame_ref = [&](size_t end, size_t k) {
+        double real = 0.0, imag = 0.0;
+        for(size_t n = 0; n < size; ++n) {
+            const double x = input[end - size + n] * window[n];
+            real += x * cos(2.0 * SHZ_F_PI * n * k / size);
+            imag -= x * sin(2.0 * SHZ_F_PI * n * k / size);
+        }
+        return real * real + imag * imag;
+    };
+
+    shz::window_init(window, size, SHZ_WINDOW_HANN);
+
+    for(auto scale: { SHZ_STFT_SCALE_MAGNITUDE, SHZ_STFT_SCALE_POWER, SHZ_STFT_SCALE_DECIBELS }) {
+        shz::stft stft(size, hop, SHZ_WINDOW_HANN, scale, storage);
+        size_t    count = 0;
+
+        GBL_TEST_VERIFY(stft.bins() == bins);
+        GBL_TEST_VERIFY(stft.frames_pending(size - 1) == 0);
+        GBL_TEST_VERIFY(stft.frames_pending(samples) == 1 + (samples - size) / hop);
+
+        // Stream through unevenly sized chunks, which straddle frame boundaries.
+        for(size_t i = 0, chunk = 1; i < samples; i += chunk, chunk = chunk * 3 % 71 + 1) {
+            const size_t n       = (chunk < samples - i)? chunk : samples - i;
+            const size_t pending = stft.frames_pending(n);
+
+            GBL_TEST_VERIFY(stft.process(frames[count], &input[i], n) == pending);
+            count += pending;
+        }
+
+        GBL_TEST_VERIFY(count == 1 + (samples - size) / hop);
+
+        for(size_t f = 0; f < count; ++f) {
+            for(size_t k = 0; k < bins; ++k) {
+                const double power = frame_ref(size + f * hop, k);
+
+                switch(scale) {
+                case SHZ_STFT_SCALE_MAGNITUDE:
+                    GBL_TEST_ERROR(sqrt(power), frames[f][k], 1e-3f, GBL_TEST_ERROR_ABSOLUTE);
+                    break;
+                case SHZ_STFT_SCALE_POWER:
+                    GBL_TEST_ERROR(power, frames[f][k], 1e-3f, GBL_TEST_ERROR_FUZZY);
+                    break;
+                default:
+                    GBL_TEST_ERROR(10.0 * log10(std::max(power, 1e-20)), frames[f][k], 1e-2f, GBL_TEST_ERROR_ABSOLUTE);
+                    break;
+                }
+            }
+        }
+
+        // Silence must stay finite in decibels, and resetting must produce the first frame again.
+        shz_complex_t zero = shz_cinitf(0.0f, 0.0f);
+        float         db;
+        shz::cdbf_array(&db, &zero, 1);
+        GBL_TEST_ERROR(-200.0f, db, 1e-2f, GBL_TEST_ERROR_ABSOLUTE);
+
+        stft.reset();
+        GBL_TEST_VERIFY(stft.process(frames[1], input, size) == 1);
+        GBL_TEST_ERROR(frames[0][1], frames[1][1], SHZ_COMPLEX_ERROR_EXACT, GBL_TEST_ERROR_ABSOLUTE);
+    }
+
+    // Spectrogram of 100ms of 48kHz stereo in decibels, streamed in 10ms chunks.
+    {
+        constexpr size_t length   = 4800;
+        constexpr size_t chunk    = 480;
+        constexpr size_t big      = 1024;
+        constexpr size_t big_hop  = 256;
+        constexpr size_t big_bins = big / 2 + 1;
+        alignas(8) static float         audio[2][length];
+        alignas(8) static float         spectrogram[2][length / big_hop + 1][big_bins];
+        alignas(8) static float         history[2][big], hann[big];
+        alignas(8) static shz_complex_t buffer[big];
+        alignas(8) static char          channel_storage[2][SHZ_STFT_STORAGE_SIZE(big)];
+
+        shz::stft channels[2] = {
+            { big, big_hop, SHZ_WINDOW_HANN, SHZ_STFT_SCALE_DECIBELS, channel_storage[0] },
+            { big, big_hop, SHZ_WINDOW_HANN, SHZ_STFT_SCALE_DECIBELS, channel_storage[1] }
+        };
+
+        shz::window_init(hann, big, SHZ_WINDOW_HANN);
+
+        for(size_t c = 0; c < 2; ++c)
+            for(size_t i = 0; i < length; ++i)
+                audio[c][i] = gblRandUniform(-1.0f, 1.0f);
+
+        GBL_TEST_VERIFY(
+            (benchmark_cmp<std::nullptr_t>(
+                "shz::stft", [&](float (*a)[length]) {
+                    for(size_t c = 0; c < 2; ++c) {
+                        size_t count = 0;
+                        channels[c].reset();
+                        for(size_t i = 0; i < length; i += chunk)
+                            count += channels[c].process(spectrogram[c][count], &a[c][i], chunk);
+                    }
+                },
+                "shz_fft", [&](float (*a)[length]) {
+                    // Slides a linear history along by each hop, then windows, transforms, and converts bin by bin.
+                    for(size_t c = 0; c < 2; ++c) {
+                        size_t count = 0;
+                        for(size_t i = 0; i + big_hop <= length; i += big_hop) {
+                            for(size_t n = 0; n < big - big_hop; ++n)
+                                history[c][n] = history[c][n + big_hop];
+                            for(size_t n = 0; n < big_hop; ++n)
+                                history[c][big - big_hop + n] = a[c][i + n];
+                            if(i + big_hop < big)
+                                continue;
+                            for(size_t n = 0; n < big; ++n)
+                                buffer[n] = shz_cinitf(history[c][n] * hann[n], 0.0f);
+                            shz_fft(buffer, big);
+                            for(size_t k = 0; k < big_bins; ++k)
+                                spectrogram[c][count][k] = 20.0f * log10f(shz_cabsf(buffer[k]));
+                            ++count;
+                        }
+                    }
+                },
+                audio
+            ))
+        );
+    }
+GBL_TEST_CASE_END
+
 GBL_TEST_REGISTER(ctor_default,
                   ctor_value,
                   ctor_c_type,
@@ -1283,4 +1727,10 @@ GBL_TEST_REGISTER(ctor_default,
                   cacschf,
                   casechf,
                   cacothf,
-                  fft)
+                  fft,
+                  fft_fixed,
+                  fft_batch,
+                  fft_plan,
+                  dct,
+                  fir,
+                  stft)
@@ -0,0 +1,237 @@
+#include "shz_test.h"
+#include "shz_test.hpp"
+#include "sh4zam/shz_cull.hpp"
+#include "sh4zam/shz_xmtrx.hpp"
+
+#include <vector>
+#include <bit>
+#include <cmath>
+
+#define GBL_SELF_TYPE   shz_cull_test_suite
+
+GBL_TEST_FIXTURE_NONE
+GBL_TEST_INIT_NONE
+GBL_TEST_FINAL_NONE
+
+namespace {
+    constexpr size_t OBJECT_COUNT = 1000;
+
+    shz::vec3 random_vec3(float range) {
+        return { gblRandUniform(-range, range), gblRandUniform(-range, range), gblRandUniform(-range, range) };
+    }
+
+    // Builds the clip-space transform of a camera at \p pos, looking down -Z after a yaw and pitch.
+    shz::mat4x4 camera(float yaw, float pitch, shz::vec3 pos) {
+        shz::mat4x4 proj, view, out;
+
+        shz_mat4x4_init_perspective(&proj, SHZ_DEG_TO_RAD(70.0f), 1.33333f, 1.0f);
+        shz_mat4x4_init_rotation_xyz(&view, pitch, yaw, 0.0f);
+        view.pos = shz_vec3_vec4(shz_mat4x4_transform_vec3(&view, shz_vec3_neg(pos)), 1.0f);
+        shz_mat4x4_mult(&out, &proj, &view);
+
+        return out;
+    }
+
+    // Returns whether the point lies within the clip volume, given some slack around its boundary.
+    bool inside(const shz::mat4x4& mat, shz::vec3 point, float slack = 0.0f) {
+        const shz_vec4_t clip = shz_mat4x4_transform_vec4(&mat, shz_vec3_vec4(point, 1.0f));
+        const float      w    = clip.w * (1.0f + slack);
+
+        return clip.w > 0.0f && std::abs(clip.x) <= w && std::abs(clip.y) <= w && std::abs(clip.z) <= w;
+    }
+
+    // Returns whether the object at index \p i is marked visible within the bitmask.
+    bool visible(const std::vector<uint32_t>& bits, size_t i) {
+        return (bits[i / 32] >> (i % 32)) & 1;
+    }
+
+    // Returns the number of bits set within the bitmask.
+    size_t popcount(const std::vector<uint32_t>& bits) {
+        size_t total = 0;
+
+        for(uint32_t word : bits)
+            total += std::popcount(word);
+
+        return total;
+    }
+
+    std::vector<shz::sphere> random_spheres() {
+        std::vector<shz::sphere> spheres(OBJECT_COUNT);
+
+        for(auto& s : spheres)
+            s = { random_vec3(100.0f), gblRandUniform(0.5f, 5.0f) };
+
+        return spheres;
+    }
+
+    std::vector<shz::aabb> random_aabbs() {
+        std::vector<shz::aabb> aabbs(OBJECT_COUNT);
+
+        for(auto& box : aabbs) {
+            const shz::vec3 min = random_vec3(100.0f);
+            box = shz_aabb_init_min_max(min, min + shz::vec3(gblRandUniform(0.5f, 10.0f),
+                                                             gblRandUniform(0.5f, 10.0f),
+                                                             gblRandUniform(0.5f, 10.0f)));
+        }
+
+        return aabbs;
+    }
+}
+
+GBL_TEST_CASE(init)
+    const shz::mat4x4 mat = camera(0.5f, -0.25f, { 3.0f, 1.0f, -7.0f });
+    shz::frustum      frustum(mat), xfrustum;
+
+    shz_xmtrx_load_4x4(&mat);
+    xfrustum.init_xmtrx();
+
+    for(unsigned p = 0; p < SHZ_FRUSTUM_PLANE_COUNT; ++p) {
+        GBL_TEST_VERIFY(shz_equalf(shz_vec3_magnitude(frustum.planes[p].xyz), 1.0f));
+
+        for(unsigned e = 0; e < 4; ++e)
+            GBL_TEST_COMPARE(frustum.planes[p].e[e], xfrustum.planes[p].e[e]);
+    }
+
+    // Points are inside every plane exactly when they're within the clip volume.
+    for(unsigned i = 0; i < 4096; ++i) {
+        const shz::vec3 point = random_vec3(100.0f);
+
+        if(inside(mat, point, -1e-3f))
+            GBL_TEST_VERIFY(frustum.test(shz::sphere { point, 0.0f }));
+        else if(!inside(mat, point, 1e-3f))
+            GBL_TEST_VERIFY(!frustum.test(shz::sphere { point, 0.0f }));
+    }
+
+    // The same holds for GL frustums, whose near and far planes are finite.
+    shz::mat4x4 gl;
+    shz_mat4x4_init_frustum(&gl, -2.0f, 1.0f, -1.0f, 1.5f, 1.0f, 50.0f);
+    frustum.init(gl);
+
+    for(unsigned i = 0; i < 4096; ++i) {
+        const shz::vec3 point = random_vec3(100.0f);
+
+        if(inside(gl, point, -1e-3f))
+            GBL_TEST_VERIFY(frustum.test(shz::sphere { point, 0.0f }));
+        else if(!inside(gl, point, 1e-3f))
+            GBL_TEST_VERIFY(!frustum.test(shz::sphere { point, 0.0f }));
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(spheres)
+    const std::vector<shz::sphere> spheres = random_spheres();
+    std::vector<uint32_t>          bits((OBJECT_COUNT + 31) / 32), cachedBits(bits.size());
+    std::vector<uint8_t>           cache(OBJECT_COUNT, 0);
+
+    for(unsigned frame = 0; frame < 16; ++frame) {
+        const shz::mat4x4  mat = camera(frame * 0.4f, -0.25f, { 3.0f, 1.0f, -7.0f });
+        const shz::frustum frustum(mat);
+
+        const size_t count       = frustum.cull(spheres.data(), spheres.size(), bits.data());
+        const size_t cachedCount = frustum.cull(spheres.data(), spheres.size(), cachedBits.data(), cache.data());
+
+        GBL_TEST_COMPARE(count, popcount(bits));
+        GBL_TEST_COMPARE(count, cachedCount);
+        GBL_TEST_VERIFY(bits == cachedBits);
+
+        for(size_t i = 0; i < spheres.size(); ++i) {
+            const shz::sphere& s = spheres[i];
+
+            GBL_TEST_COMPARE(visible(bits, i), frustum.test(s));
+            GBL_TEST_VERIFY(cache[i] < SHZ_FRUSTUM_PLANE_COUNT);
+
+            // Spheres whose centers are visible are never culled, while culled ones have no visible surface points.
+            if(inside(mat, s.center, -1e-3f))
+                GBL_TEST_VERIFY(visible(bits, i));
+            else if(!visible(bits, i))
+                for(unsigned p = 0; p < 16; ++p)
+                    GBL_TEST_VERIFY(!inside(mat, shz::vec3(s.center) + random_vec3(1.0f).direction() * s.radius, -1e-3f));
+        }
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(aabbs)
+    const std::vector<shz::aabb> aabbs = random_aabbs();
+    std::vector<uint32_t>        bits((OBJECT_COUNT + 31) / 32), cachedBits(bits.size());
+    std::vector<uint8_t>         cache(OBJECT_COUNT, 0);
+
+    for(unsigned frame = 0; frame < 16; ++frame) {
+        const shz::mat4x4  mat = camera(frame * 0.4f, 0.25f, { -5.0f, 2.0f, 4.0f });
+        const shz::frustum frustum(mat);
+
+        const size_t count       = frustum.cull(aabbs.data(), aabbs.size(), bits.data());
+        const size_t cachedCount = frustum.cull(aabbs.data(), aabbs.size(), cachedBits.data(), cache.data());
+
+        GBL_TEST_COMPARE(count, popcount(bits));
+        GBL_TEST_COMPARE(count, cachedCount);
+        GBL_TEST_VERIFY(bits == cachedBits);
+
+        for(size_t i = 0; i < aabbs.size(); ++i) {
+            const shz::aabb& box = aabbs[i];
+
+            GBL_TEST_COMPARE(visible(bits, i), frustum.test(box));
+
+            // Boxes whose centers are visible are never culled, while culled ones have no visible corners.
+            if(inside(mat, box.center, -1e-3f))
+                GBL_TEST_VERIFY(visible(bits, i));
+            else if(!visible(bits, i))
+                for(unsigned c = 0; c < 8; ++c) {
+                    const shz::vec3 sign = { (c & 1)? 1.0f : -1.0f, (c & 2)? 1.0f : -1.0f, (c & 4)? 1.0f : -1.0f };
+                    GBL_TEST_VERIFY(!inside(mat, shz::vec3(box.center) + sign * shz::vec3(box.extents), -1e-3f));
+                }
+        }
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(cull_benchmark)
+    const std::vector<shz::sphere> spheres = random_spheres();
+    const std::vector<shz::aabb>   aabbs   = random_aabbs();
+    std::vector<uint32_t>          bits((OBJECT_COUNT + 31) / 32);
+    std::vector<uint8_t>           cache(OBJECT_COUNT, 0);
+    const shz::frustum             frustum(camera(0.5f, -0.25f, { 3.0f, 1.0f, -7.0f }));
+
+    // Tests every plane of each sphere by hand, as would be done without the culling API.
+    auto by_hand = [&] {
+        for(size_t base = 0; base < spheres.size(); base += 32) {
+            uint32_t word = 0;
+
+            for(size_t i = base; i < std::min(base + 32, spheres.size()); ++i) {
+                const shz_vec4_t center = shz_vec3_vec4(spheres[i].center, 1.0f);
+                bool             in     = true;
+
+                for(unsigned p = 0; p < SHZ_FRUSTUM_PLANE_COUNT; ++p)
+                    in &= shz_vec4_dot(frustum.planes[p], center) >= -spheres[i].radius;
+
+                word |= (uint32_t)in << (i - base);
+            }
+
+            bits[base / 32] = word;
+        }
+    };
+
+    frustum.cull(spheres.data(), spheres.size(), bits.data(), cache.data());
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz_frustum_cull_spheres", [&] {
+                frustum.cull(spheres.data(), spheres.size(), bits.data(), cache.data());
+            },
+            "shz_vec4_dot", by_hand
+        )
+    );
+
+    // Throughput in objects culled per millisecond.
+    throughput_report("spheres", "objects/ms", OBJECT_COUNT, 1000000, [&] { frustum.cull(spheres.data(), spheres.size(), bits.data()); });
+    throughput_report("spheres (cached)", "objects/ms", OBJECT_COUNT, 1000000, [&] { frustum.cull(spheres.data(), spheres.size(), bits.data(), cache.data()); });
+    throughput_report("spheres (by hand)", "objects/ms", OBJECT_COUNT, 1000000, by_hand);
+
+    std::fill(cache.begin(), cache.end(), 0);
+    frustum.cull(aabbs.data(), aabbs.size(), bits.data(), cache.data());
+
+    throughput_report("aabbs", "objects/ms", OBJECT_COUNT, 1000000, [&] { frustum.cull(aabbs.data(), aabbs.size(), bits.data()); });
+    throughput_report("aabbs (cached)", "objects/ms", OBJECT_COUNT, 1000000, [&] { frustum.cull(aabbs.data(), aabbs.size(), bits.data(), cache.data()); });
+GBL_TEST_CASE_END
+
+GBL_TEST_REGISTER(init,
+                  spheres,
+                  aabbs,
+                  cull_benchmark)
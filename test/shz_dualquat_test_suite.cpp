@@ -0,0 +1,244 @@
+#include "shz_test.h"
+#include "shz_test.hpp"
+#include "sh4zam/shz_dualquat.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#define GBL_SELF_TYPE   shz_dualquat_test_suite
+
+GBL_TEST_FIXTURE_NONE
+GBL_TEST_INIT_NONE
+GBL_TEST_FINAL_NONE
+
+namespace {
+    constexpr float DQ_ERROR = 1e-3f;
+
+    shz::dualquat random_dualquat() {
+        return shz::dualquat::from_rotation_translation(
+                    shz::quat::from_angles_xyz(gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                               gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                               gblRandUniform(-SHZ_F_PI, SHZ_F_PI)),
+                    shz::vec3(gblRandUniform(-10.0f, 10.0f),
+                              gblRandUniform(-10.0f, 10.0f),
+                              gblRandUniform(-10.0f, 10.0f)));
+    }
+
+    shz::vec3 random_point() {
+        return shz::vec3(gblRandUniform(-5.0f, 5.0f), gblRandUniform(-5.0f, 5.0f), gblRandUniform(-5.0f, 5.0f));
+    }
+}
+
+#define VERIFY_VEC3(a, b) do { \
+        GBL_TEST_ERROR((a).x, (b).x, DQ_ERROR, GBL_TEST_ERROR_FUZZY); \
+        GBL_TEST_ERROR((a).y, (b).y, DQ_ERROR, GBL_TEST_ERROR_FUZZY); \
+        GBL_TEST_ERROR((a).z, (b).z, DQ_ERROR, GBL_TEST_ERROR_FUZZY); \
+    } while(0)
+
+GBL_TEST_CASE(identity)
+    const auto id = shz::dualquat::identity();
+    const shz::vec3 p = { 1.0f, -2.0f, 3.0f };
+
+    GBL_TEST_VERIFY(id.transform_point(p) == p);
+    GBL_TEST_VERIFY(id.translation() == shz::vec3(0.0f));
+    GBL_TEST_VERIFY(id.rotation() == shz::quat::identity());
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(from_rotation_translation)
+    for(unsigned i = 0; i < 64; ++i) {
+        const auto q = shz::quat::from_angles_xyz(gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                                  gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                                  gblRandUniform(-SHZ_F_PI, SHZ_F_PI));
+        const auto t  = random_point();
+        const auto p  = random_point();
+        const auto dq = shz::dualquat::from_rotation_translation(q, t);
+
+        VERIFY_VEC3(dq.translation(), t);
+        VERIFY_VEC3(dq.transform_point(p), q.transform(p) + t);
+        VERIFY_VEC3(dq.transform(p), q.transform(p));
+        VERIFY_VEC3(shz::dualquat::from_quat(q).transform_point(p), q.transform(p));
+        VERIFY_VEC3(shz::dualquat::from_translation(t).transform_point(p), p + t);
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(mult)
+    for(unsigned i = 0; i < 64; ++i) {
+        const auto a = random_dualquat();
+        const auto b = random_dualquat();
+        const auto p = random_point();
+
+        // Applies b first, then a.
+        VERIFY_VEC3((a * b).transform_point(p), a.transform_point(b.transform_point(p)));
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(inverse)
+    for(unsigned i = 0; i < 64; ++i) {
+        const auto dq = random_dualquat();
+        const auto p  = random_point();
+
+        VERIFY_VEC3(dq.inverse().transform_point(dq.transform_point(p)), p);
+        VERIFY_VEC3(dq.conjugated().transform_point(dq.transform_point(p)), p);
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(normalize)
+    for(unsigned i = 0; i < 64; ++i) {
+        const auto dq = random_dualquat();
+        const auto p  = random_point();
+
+        // Perturb the dual part along the real part, which normalization must remove.
+        const shz::dualquat skewed(dq.real, shz_quat_add(dq.dual, shz_quat_scale(dq.real, 0.25f)));
+        const auto          n = (skewed * gblRandUniform(0.5f, 4.0f)).normalized();
+
+        GBL_TEST_ERROR(shz_quat_magnitude(n.real), 1.0f, DQ_ERROR, GBL_TEST_ERROR_ABSOLUTE);
+        GBL_TEST_ERROR(shz_quat_dot(n.real, n.dual), 0.0f, DQ_ERROR, GBL_TEST_ERROR_ABSOLUTE);
+        VERIFY_VEC3(n.transform_point(p), dq.transform_point(p));
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(mat4x4)
+    for(unsigned i = 0; i < 64; ++i) {
+        const auto   dq = random_dualquat();
+        const auto   p  = random_point();
+        const auto   m  = dq.to_mat4x4();
+        shz_mat3x4_t compact;
+
+        dq.to_mat3x4(&compact);
+
+        VERIFY_VEC3(shz_mat4x4_transform_point3(&m, p), dq.transform_point(p));
+        for(size_t c = 0; c < 4; ++c)
+            VERIFY_VEC3(compact.col[c], m.col(c).xyz());
+        VERIFY_VEC3(shz::dualquat::from_mat4x4(m).transform_point(p), dq.transform_point(p));
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(sclerp)
+    const shz::vec3 p = { 1.0f, 2.0f, 3.0f };
+
+    for(unsigned i = 0; i < 64; ++i) {
+        const auto a = random_dualquat();
+        const auto b = random_dualquat();
+
+        VERIFY_VEC3(shz::dualquat::sclerp(a, b, 0.0f).transform_point(p), a.transform_point(p));
+        VERIFY_VEC3(shz::dualquat::sclerp(a, b, 1.0f).transform_point(p), b.transform_point(p));
+
+        // Halfway along the screw from a to b, twice, arrives at b.
+        const auto mid   = shz::dualquat::sclerp(a, b, 0.5f);
+        const auto delta = mid * a.conjugated();
+        VERIFY_VEC3((delta * mid).transform_point(p), b.transform_point(p));
+    }
+
+    {   // Pure translations move in a straight line.
+        const auto a = shz::dualquat::from_translation({ 0.0f, 0.0f, 0.0f });
+        const auto b = shz::dualquat::from_translation({ 4.0f, -2.0f, 8.0f });
+        VERIFY_VEC3(shz::dualquat::sclerp(a, b, 0.25f).translation(), shz::vec3(1.0f, -0.5f, 2.0f));
+    }{
+        // A quarter turn about a Z axis passing through (1, 0, 0) sweeps (2, 0, 0) along its arc.
+        const auto q = shz::quat::from_axis_angle({ 0.0f, 0.0f, 1.0f }, SHZ_F_PI_2);
+        const auto b = shz::dualquat::from_rotation_translation(q, shz::vec3(1.0f, 0.0f, 0.0f) - q.transform({ 1.0f, 0.0f, 0.0f }));
+        const auto m = shz::dualquat::sclerp(shz::dualquat::identity(), b, 0.5f);
+        VERIFY_VEC3(m.transform_point({ 2.0f, 0.0f, 0.0f }), shz::vec3(1.0f + 0.70710678f, 0.70710678f, 0.0f));
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(sclerp_endpoints)
+    // The endpoints are returned exactly, rather than being approximated along the screw.
+    for(unsigned i = 0; i < 64; ++i) {
+        const auto a     = random_dualquat();
+        const auto b     = random_dualquat();
+        const auto start = shz::dualquat::sclerp(a, b, 0.0f);
+        const auto end   = shz::dualquat::sclerp(a, b, 1.0f);
+
+        GBL_TEST_VERIFY(!std::memcmp(&start, &a, sizeof(a)));
+        GBL_TEST_VERIFY(!std::memcmp(&end, &b, sizeof(b)));
+
+        // Just short of the end, the screw has already converged on b.
+        const auto p = random_point();
+        VERIFY_VEC3(shz::dualquat::sclerp(a, b, 0.99999f).transform_point(p), b.transform_point(p));
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(skin)
+    constexpr size_t bones    = 16;
+    constexpr size_t vertices = 512;
+
+    static shz::dualquat            palette[bones];
+    static shz_skin_influence_t     influences[vertices];
+    static shz_vec3_t               positions[vertices], normals[vertices];
+    static shz_vec3_t               skinned[2][vertices], expected[2][vertices];
+
+    for(size_t b = 0; b < bones; ++b)
+        palette[b] = random_dualquat();
+
+    // Mostly runs of single-bone vertices, sorted by bone, mixed with blended vertices.
+    for(size_t v = 0; v < vertices; ++v) {
+        shz_skin_influence_t& inf = influences[v];
+        const size_t influenceCount = (v % 8 < 5)? 1 : 1 + v % 4;
+        float total = 0.0f;
+
+        for(size_t i = 0; i < SHZ_SKIN_MAX_INFLUENCES; ++i) {
+            inf.bones[i]   = (i == 0)? (v / 32) % bones : gblRandUniform(0.0f, bones - 1.0f);
+            inf.weights[i] = (i < influenceCount)? gblRandUniform(0.1f, 1.0f) : 0.0f;
+            total         += inf.weights[i];
+        }
+
+        for(size_t i = 0; i < SHZ_SKIN_MAX_INFLUENCES; ++i)
+            inf.weights[i] /= total;
+
+        positions[v] = random_point();
+        normals[v]   = shz_vec3_normalize(shz_vec3_init(gblRandUniform(-1.0f, 1.0f), gblRandUniform(-1.0f, 1.0f), 1.0f));
+    }
+
+    // Blends and normalizes each vertex's bones, then transforms it by the resulting dual quaternion.
+    auto reference = [&](shz_vec3_t* dstPos, shz_vec3_t* dstNorm) {
+        for(size_t v = 0; v < vertices; ++v) {
+            const shz::dualquat& first = palette[influences[v].bones[0]];
+            shz::dualquat        blend = first * influences[v].weights[0];
+
+            for(size_t i = 1; i < SHZ_SKIN_MAX_INFLUENCES && influences[v].weights[i] != 0.0f; ++i) {
+                const shz::dualquat& dq = palette[influences[v].bones[i]];
+                blend = blend + dq * ((first.dot(dq) < 0.0f)? -influences[v].weights[i] : influences[v].weights[i]);
+            }
+
+            blend.normalize();
+            dstPos[v]  = blend.transform_point(positions[v]);
+            dstNorm[v] = blend.transform(normals[v]);
+        }
+    };
+
+    reference(expected[0], expected[1]);
+
+    shz::skin(palette, influences, skinned[0], positions, skinned[1], normals, vertices);
+    for(size_t v = 0; v < vertices; ++v) {
+        VERIFY_VEC3(expected[0][v], skinned[0][v]);
+        VERIFY_VEC3(expected[1][v], skinned[1][v]);
+    }
+
+    // Positions only, in-place.
+    std::copy(std::begin(positions), std::end(positions), skinned[0]);
+    shz::skin(palette, influences, skinned[0], skinned[0], nullptr, nullptr, vertices);
+    for(size_t v = 0; v < vertices; ++v)
+        VERIFY_VEC3(expected[0][v], skinned[0][v]);
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz::skin", [&] {
+                shz::skin(palette, influences, skinned[0], positions, skinned[1], normals, vertices);
+            },
+            "shz::dualquat::transform_point", [&] {
+                reference(expected[0], expected[1]);
+            }
+        )
+    );
+GBL_TEST_CASE_END
+
+GBL_TEST_REGISTER(identity,
+                  from_rotation_translation,
+                  mult,
+                  inverse,
+                  normalize,
+                  mat4x4,
+                  sclerp,
+                  sclerp_endpoints,
+                  skin)
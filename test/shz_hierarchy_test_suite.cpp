@@ -0,0 +1,172 @@
+#include "shz_test.h"
+#include "shz_test.hpp"
+#include "sh4zam/shz_hierarchy.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#define GBL_SELF_TYPE   shz_hierarchy_test_suite
+
+GBL_TEST_FIXTURE_NONE
+GBL_TEST_INIT_NONE
+GBL_TEST_FINAL_NONE
+
+namespace {
+    constexpr float HIERARCHY_ERROR = 1e-3f;
+
+    /* Owns a forest of trees, each stored contiguously in breadth-first order,
+       with every node having up to "branching" children. */
+    struct test_forest {
+        std::vector<uint32_t>   parents;
+        std::vector<shz::mat4x4> locals;
+        std::vector<shz::mat4x4> worlds;
+        std::vector<uint8_t>    dirty;
+        shz::hierarchy          nodes;
+
+        test_forest(size_t trees, size_t treeSize) {
+            for(size_t t = 0; t < trees; ++t) {
+                const size_t   base      = parents.size();
+                const uint32_t branching = 2 + t % 4;
+
+                for(size_t n = 0; n < treeSize; ++n)
+                    parents.push_back(n? static_cast<uint32_t>(base + (n - 1) / branching) : SHZ_HIERARCHY_ROOT);
+            }
+
+            locals.resize(parents.size());
+            worlds.resize(parents.size());
+            dirty.assign(parents.size(), 1);
+
+            for(auto& local: locals)
+                randomize(local);
+
+            nodes = { parents.data(), locals.data(), worlds.data(), dirty.data(), parents.size() };
+        }
+
+        static void randomize(shz::mat4x4& local) {
+            shz_mat4x4_init_rotation_xyz(&local, gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                                 gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                                 gblRandUniform(-SHZ_F_PI, SHZ_F_PI));
+            local.pos = shz_vec4_init(gblRandUniform(-1.0f, 1.0f), gblRandUniform(-1.0f, 1.0f), gblRandUniform(-1.0f, 1.0f), 1.0f);
+        }
+
+        // Number of nodes within the subtree rooted at the given node, which follow it within its tree.
+        size_t subtree_size(size_t root) const {
+            std::vector<bool> within(parents.size(), false);
+            size_t            size = 1;
+
+            within[root] = true;
+            for(size_t n = root + 1; n < parents.size(); ++n)
+                if(parents[n] != SHZ_HIERARCHY_ROOT && within[parents[n]])
+                    within[n] = true, ++size;
+
+            return size;
+        }
+
+        // Recomputes every world transform, one matrix multiplication per node.
+        void reference(shz_mat4x4_t* dst) const {
+            for(size_t n = 0; n < parents.size(); ++n)
+                if(parents[n] == SHZ_HIERARCHY_ROOT)
+                    dst[n] = locals[n];
+                else
+                    shz_mat4x4_mult(&dst[n], &dst[parents[n]], &locals[n]);
+        }
+
+        bool verify() const {
+            std::vector<shz::mat4x4> expected(parents.size());
+
+            reference(expected.data());
+
+            for(size_t n = 0; n < parents.size(); ++n)
+                for(size_t e = 0; e < 16; ++e)
+                    if(std::abs(expected[n].elem[e] - worlds[n].elem[e]) > HIERARCHY_ERROR)
+                        return false;
+
+            return std::all_of(dirty.begin(), dirty.end(), [](uint8_t flag) { return !flag; });
+        }
+    };
+}
+
+GBL_TEST_CASE(update)
+    test_forest forest(8, 200);
+
+    GBL_TEST_COMPARE(shz::update(forest.nodes), forest.parents.size());
+    GBL_TEST_VERIFY(forest.verify());
+
+    // Nothing has changed since.
+    GBL_TEST_COMPARE(shz::update(forest.nodes), 0u);
+    GBL_TEST_VERIFY(forest.verify());
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(update_dirty)
+    test_forest forest(8, 200);
+
+    shz::update(forest.nodes);
+
+    // Changing nodes only updates their own subtrees, and overlapping subtrees only once.
+    for(size_t n: { size_t(3), size_t(250), size_t(1000), size_t(1400) }) {
+        test_forest::randomize(forest.locals[n]);
+        forest.dirty[n] = 1;
+
+        GBL_TEST_COMPARE(shz::update(forest.nodes), forest.subtree_size(n));
+        GBL_TEST_VERIFY(forest.verify());
+    }
+
+    forest.dirty[0] = forest.dirty[1] = 1;
+    GBL_TEST_COMPARE(shz::update(forest.nodes), forest.subtree_size(0));
+    GBL_TEST_VERIFY(forest.verify());
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(update_parallel)
+    {   // Many independent trees are split across threads.
+        test_forest forest(64, 256);
+
+        GBL_TEST_COMPARE(shz::update_parallel(forest.nodes, 4), forest.parents.size());
+        GBL_TEST_VERIFY(forest.verify());
+
+        forest.dirty[5000] = 1;
+        GBL_TEST_COMPARE(shz::update_parallel(forest.nodes, 4), forest.subtree_size(5000));
+        GBL_TEST_VERIFY(forest.verify());
+    }{
+        // A single tree cannot be split, but is still updated.
+        test_forest forest(1, 8192);
+
+        GBL_TEST_COMPARE(shz::update_parallel(forest.nodes, 4), forest.parents.size());
+        GBL_TEST_VERIFY(forest.verify());
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(update_benchmark)
+    test_forest              forest(64, 256);
+    std::vector<shz::mat4x4> expected(forest.parents.size());
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz::update", [&] {
+                std::fill(forest.dirty.begin(), forest.dirty.end(), 1);
+                shz::update(forest.nodes);
+            },
+            "shz_mat4x4_mult", [&] {
+                forest.reference(expected.data());
+            }
+        )
+    );
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz::update_parallel", [&] {
+                std::fill(forest.dirty.begin(), forest.dirty.end(), 1);
+                shz::update_parallel(forest.nodes, 4);
+            },
+            "shz::update", [&] {
+                std::fill(forest.dirty.begin(), forest.dirty.end(), 1);
+                shz::update(forest.nodes);
+            }
+        )
+    );
+GBL_TEST_CASE_END
+
+GBL_TEST_REGISTER(update,
+                  update_dirty,
+                  update_parallel,
+                  update_benchmark)
@@ -0,0 +1,263 @@
+#include "shz_test.h"
+#include "shz_test.hpp"
+#include "sh4zam/shz_light.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#define GBL_SELF_TYPE   shz_light_test_suite
+
+GBL_TEST_FIXTURE_NONE
+GBL_TEST_INIT_NONE
+GBL_TEST_FINAL_NONE
+
+namespace {
+    // Interleaved vertex, lit in-place.
+    struct vertex {
+        shz_vec3_t pos;
+        shz_vec3_t normal;
+        uint32_t   argb;
+        float      pad;
+    };
+
+    shz_vec3_t random_direction() {
+        return shz_vec3_normalize(shz_vec3_init(gblRandUniform(-1.0f, 1.0f),
+                                                gblRandUniform(-1.0f, 1.0f),
+                                                gblRandUniform(-1.0f, 1.0f)));
+    }
+
+    shz_vec3_t random_color() {
+        return shz_vec3_init(gblRandUniform(0.0f, 1.0f),
+                             gblRandUniform(0.0f, 1.0f),
+                             gblRandUniform(0.0f, 1.0f));
+    }
+
+    std::vector<vertex> random_vertices(size_t count) {
+        std::vector<vertex> vertices(count);
+
+        for(auto& v : vertices)
+            v = { shz_vec3_init(gblRandUniform(-10.0f, 10.0f),
+                                gblRandUniform(-10.0f, 10.0f),
+                                gblRandUniform(-10.0f, 10.0f)),
+                  random_direction(), 0, 0.0f };
+
+        return vertices;
+    }
+
+    // Evaluates each light one at a time, in double-precision, as a reference.
+    uint32_t reference(const shz_lighting_t& env, shz_vec3_t p, shz_vec3_t n) {
+        double rgb[3] = { env.ambient.x, env.ambient.y, env.ambient.z };
+
+        for(size_t l = 0; l < env.light_count; ++l) {
+            const shz_light_t& light = env.lights[l];
+            double             intensity;
+
+            if(light.type == SHZ_LIGHT_DIRECTIONAL) {
+                intensity = std::max(0.0, -((double)n.x * light.direction.x +
+                                            (double)n.y * light.direction.y +
+                                            (double)n.z * light.direction.z));
+            } else {
+                const double d[3] = { (double)light.position.x - p.x,
+                                      (double)light.position.y - p.y,
+                                      (double)light.position.z - p.z };
+                const double dist = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+                const double ndl  = (n.x * d[0] + n.y * d[1] + n.z * d[2]) / dist;
+
+                if(ndl <= 0.0)
+                    continue;
+
+                intensity = ndl / (light.attenuation.x + light.attenuation.y * dist + light.attenuation.z * dist * dist);
+
+                if(light.type == SHZ_LIGHT_SPOT) {
+                    const double cos = -(d[0] * light.direction.x + d[1] * light.direction.y + d[2] * light.direction.z) / dist;
+
+                    intensity *= std::clamp((cos - light.cos_outer) / (light.cos_inner - light.cos_outer), 0.0, 1.0);
+                }
+            }
+
+            for(unsigned c = 0; c < 3; ++c)
+                rgb[c] += light.color.e[c] * intensity;
+        }
+
+        if(env.fog.mode != SHZ_FOG_NONE) {
+            const double depth  = (double)env.fog.plane.x * p.x + (double)env.fog.plane.y * p.y +
+                                  (double)env.fog.plane.z * p.z + env.fog.plane.w;
+            const double factor = (env.fog.mode == SHZ_FOG_LINEAR)?
+                                      std::clamp((env.fog.end - depth) / (env.fog.end - env.fog.start), 0.0, 1.0) :
+                                      std::exp(-env.fog.density * std::max(depth, 0.0));
+
+            for(unsigned c = 0; c < 3; ++c)
+                rgb[c] = env.fog.color.e[c] + (std::clamp(rgb[c], 0.0, 1.0) - env.fog.color.e[c]) * factor;
+        }
+
+        uint32_t argb = (uint32_t)std::lround(std::clamp((double)env.alpha, 0.0, 1.0) * 255.0) << 24;
+
+        for(unsigned c = 0; c < 3; ++c)
+            argb |= (uint32_t)std::lround(std::clamp(rgb[c], 0.0, 1.0) * 255.0) << (16 - c * 8);
+
+        return argb;
+    }
+
+    // Returns the largest difference between any two channels of the packed colors.
+    int channel_error(uint32_t a, uint32_t b) {
+        int error = 0;
+
+        for(unsigned shift = 0; shift < 32; shift += 8)
+            error = std::max(error, std::abs((int)((a >> shift) & 0xff) - (int)((b >> shift) & 0xff)));
+
+        return error;
+    }
+
+    // Returns the largest channel error of any vertex lit in-place versus the reference.
+    int light_error(const shz::lighting& env, std::vector<vertex>& vertices) {
+        int error = 0;
+
+        env.apply(&vertices[0].pos, &vertices[0].normal, vertices.size(),
+                  &vertices[0].argb, sizeof(vertex), sizeof(vertex));
+
+        for(const auto& v : vertices)
+            error = std::max(error, channel_error(v.argb, reference(env, v.pos, v.normal)));
+
+        return error;
+    }
+}
+
+GBL_TEST_CASE(fog_factor)
+    shz::fog fog = { SHZ_FOG_LINEAR, {}, shz_vec4_init(0.0f, 0.0f, 1.0f, 0.0f), 10.0f, 20.0f, 0.1f };
+
+    GBL_TEST_VERIFY(shz_equalf(shz::fog_factor(fog, 5.0f),  1.0f));
+    GBL_TEST_VERIFY(shz_equalf(shz::fog_factor(fog, 15.0f), 0.5f));
+    GBL_TEST_VERIFY(shz_equalf(shz::fog_factor(fog, 25.0f), 0.0f));
+
+    fog.mode = SHZ_FOG_EXP;
+
+    GBL_TEST_VERIFY(shz_equalf(shz::fog_factor(fog, 0.0f),  1.0f));
+    GBL_TEST_VERIFY(shz_equalf(shz::fog_factor(fog, 10.0f), expf(-1.0f)));
+
+    fog.mode = SHZ_FOG_NONE;
+
+    GBL_TEST_VERIFY(shz_equalf(shz::fog_factor(fog, 100.0f), 1.0f));
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(directional)
+    auto vertices = random_vertices(256);
+
+    // Every count from 0 to beyond a full group of three, to cover each partially-filled group.
+    for(size_t count = 0; count <= 5; ++count) {
+        std::vector<shz::light> lights;
+
+        for(size_t l = 0; l < count; ++l)
+            lights.push_back(shz::light_directional(random_direction(), shz_vec3_scale(random_color(), 0.5f)));
+
+        const shz::lighting env(shz_vec3_init(0.1f, 0.05f, 0.2f), lights.data(), lights.size(), 0.75f);
+
+        GBL_TEST_VERIFY(light_error(env, vertices) <= 2);
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(point_spot)
+    auto vertices = random_vertices(256);
+
+    const shz::light lights[] = {
+        shz::light_point(shz_vec3_init(0.0f, 12.0f, 0.0f), shz_vec3_init(1.0f, 0.8f, 0.6f), shz_vec3_init(1.0f, 0.05f, 0.01f)),
+        shz::light_spot(shz_vec3_init(-12.0f, 0.0f, 0.0f), shz_vec3_init(1.0f, 0.0f, 0.0f), shz_vec3_init(0.2f, 0.6f, 1.5f),
+                        shz_vec3_init(0.5f, 0.0f, 0.005f), SHZ_DEG_TO_RAD(20.0f), SHZ_DEG_TO_RAD(40.0f)),
+        shz::light_directional(shz_vec3_init(0.0f, -1.0f, 0.0f), shz_vec3_init(0.3f, 0.3f, 0.3f)),
+        shz::light_point(shz_vec3_init(5.0f, -5.0f, 8.0f), shz_vec3_init(2.0f, 0.0f, 0.5f), shz_vec3_init(0.0f, 0.0f, 0.05f))
+    };
+
+    const shz::lighting env(shz_vec3_init(0.05f, 0.05f, 0.05f), lights, std::size(lights));
+
+    GBL_TEST_VERIFY(light_error(env, vertices) <= 2);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(fog)
+    auto vertices = random_vertices(256);
+
+    const shz::light lights[] = {
+        shz::light_directional(random_direction(), shz_vec3_init(0.8f, 0.8f, 0.8f)),
+        shz::light_point(shz_vec3_init(0.0f, 0.0f, 0.0f), shz_vec3_init(1.0f, 1.0f, 1.0f), shz_vec3_init(0.0f, 0.2f, 0.0f))
+    };
+
+    shz::lighting env(shz_vec3_init(0.2f, 0.2f, 0.2f), lights, std::size(lights));
+
+    env.fog = { SHZ_FOG_LINEAR, shz_vec3_init(0.5f, 0.6f, 0.7f), shz_vec4_init(0.0f, 0.0f, 1.0f, 10.0f), 2.0f, 18.0f, 0.0f };
+
+    GBL_TEST_VERIFY(light_error(env, vertices) <= 2);
+
+    env.fog.mode    = SHZ_FOG_EXP;
+    env.fog.density = 0.15f;
+
+    GBL_TEST_VERIFY(light_error(env, vertices) <= 2);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(light_benchmark)
+    constexpr size_t count = 1024;
+    auto             vertices = random_vertices(count);
+
+    const shz::light lights[] = {
+        shz::light_directional(random_direction(), shz_vec3_init(0.5f, 0.4f, 0.3f)),
+        shz::light_directional(random_direction(), shz_vec3_init(0.2f, 0.3f, 0.4f)),
+        shz::light_directional(random_direction(), shz_vec3_init(0.1f, 0.1f, 0.1f)),
+        shz::light_point(shz_vec3_init(0.0f, 5.0f, 0.0f), shz_vec3_init(1.0f, 1.0f, 0.8f), shz_vec3_init(1.0f, 0.1f, 0.01f))
+    };
+
+    shz::lighting env(shz_vec3_init(0.1f, 0.1f, 0.1f), lights, std::size(lights));
+
+    env.fog = { SHZ_FOG_LINEAR, shz_vec3_init(0.5f, 0.5f, 0.5f), shz_vec4_init(0.0f, 0.0f, 1.0f, 10.0f), 5.0f, 20.0f, 0.0f };
+
+    // Evaluates every light one at a time for each vertex, as would be done without the lighting API.
+    auto by_hand = [&] {
+        for(auto& v : vertices) {
+            shz_vec3_t rgb = env.ambient;
+
+            for(const auto& light : lights) {
+                float intensity;
+
+                if(light.type == SHZ_LIGHT_DIRECTIONAL) {
+                    intensity = shz_fmaxf(-shz_vec3_dot(v.normal, light.direction), 0.0f);
+                } else {
+                    const shz_vec3_t d    = shz_vec3_sub(light.position, v.pos);
+                    const float      dist = shz_vec3_magnitude(d);
+
+                    intensity = shz_fmaxf(shz_vec3_dot(v.normal, d) / dist, 0.0f) /
+                                (light.attenuation.x + light.attenuation.y * dist + light.attenuation.z * dist * dist);
+                }
+
+                rgb = shz_vec3_add(rgb, shz_vec3_scale(light.color, intensity));
+            }
+
+            const float depth  = shz_vec3_dot(env.fog.plane.xyz, v.pos) + env.fog.plane.w;
+            const float factor = shz_saturatef((env.fog.end - depth) / (env.fog.end - env.fog.start));
+
+            rgb = shz_vec3_lerp(env.fog.color, shz_vec3_clamp(rgb, 0.0f, 1.0f), factor);
+
+            v.argb = 0xff000000 | ((uint32_t)(rgb.x * 255.0f) << 16) |
+                                  ((uint32_t)(rgb.y * 255.0f) <<  8) |
+                                  ((uint32_t)(rgb.z * 255.0f) <<  0);
+        }
+    };
+
+    auto with_shz = [&] {
+        env.apply(&vertices[0].pos, &vertices[0].normal, count, &vertices[0].argb, sizeof(vertex), sizeof(vertex));
+    };
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz_lighting_apply", with_shz,
+            "lighting by hand", by_hand
+        )
+    );
+
+    // Throughput in vertices lit per millisecond.
+    throughput_report("3 directional + 1 point", "vertices/ms", count, 1000000, with_shz);
+    throughput_report("by hand", "vertices/ms", count, 1000000, by_hand);
+GBL_TEST_CASE_END
+
+GBL_TEST_REGISTER(fog_factor,
+                  directional,
+                  point_spot,
+                  fog,
+                  light_benchmark)
@@ -157,8 +157,119 @@ GBL_TEST_CASE(to_quat)
     GBL_TEST_VERIFY(shzQuat == glmQuat);
 GBL_TEST_CASE_END
 
+GBL_TEST_CASE(skin)
+    constexpr size_t bones    = 16;
+    constexpr size_t vertices = 512;
+    constexpr float  SKIN_ERROR = 1e-3f;
+
+    struct vertex {
+        shz_vec3_t          pos;
+        shz_vec3_t          normal;
+        shz::skin_influence influence;
+    };
+
+    alignas(32) static shz::mat4x4  palette[bones];
+    alignas(32) static shz_mat3x4_t compact[bones];
+    static shz_skin_influence_t     influences[vertices];
+    static shz_vec3_t               positions[vertices], normals[vertices];
+    static shz_vec3_t               skinned[2][vertices], expected[2][vertices];
+    static vertex                   interleaved[vertices];
+
+    for(size_t b = 0; b < bones; ++b) {
+        palette[b].init_rotation_xyz(gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                     gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                     gblRandUniform(-SHZ_F_PI, SHZ_F_PI));
+        palette[b].apply_translation(gblRandUniform(-10.0f, 10.0f),
+                                     gblRandUniform(-10.0f, 10.0f),
+                                     gblRandUniform(-10.0f, 10.0f));
+
+        for(size_t c = 0; c < 4; ++c)
+            compact[b].col[c] = palette[b].col(c).xyz();
+    }
+
+    // Mostly runs of single-bone vertices, sorted by bone, mixed with blended vertices.
+    for(size_t v = 0; v < vertices; ++v) {
+        shz_skin_influence_t& inf = influences[v];
+        const size_t influenceCount = (v % 8 < 5)? 1 : 1 + v % 4;
+        float total = 0.0f;
+
+        for(size_t i = 0; i < SHZ_SKIN_MAX_INFLUENCES; ++i) {
+            inf.bones[i]   = (i == 0)? (v / 32) % bones : gblRandUniform(0.0f, bones - 1.0f);
+            inf.weights[i] = (i < influenceCount)? gblRandUniform(0.1f, 1.0f) : 0.0f;
+            total         += inf.weights[i];
+        }
+
+        for(size_t i = 0; i < SHZ_SKIN_MAX_INFLUENCES; ++i)
+            inf.weights[i] /= total;
+
+        positions[v] = shz_vec3_init(gblRandUniform(-1.0f, 1.0f), gblRandUniform(-1.0f, 1.0f), gblRandUniform(-1.0f, 1.0f));
+        normals[v]   = shz_vec3_normalize(shz_vec3_init(gblRandUniform(-1.0f, 1.0f), gblRandUniform(-1.0f, 1.0f), 1.0f));
+
+        interleaved[v] = { positions[v], normals[v], inf };
+    }
+
+    // Transforms by every influencing matrix individually, then blends the results.
+    auto reference = [&](shz_vec3_t* dstPos, shz_vec3_t* dstNorm) {
+        for(size_t v = 0; v < vertices; ++v) {
+            shz_vec3_t pos = shz_vec3_fill(0.0f), norm = shz_vec3_fill(0.0f);
+
+            for(size_t i = 0; i < SHZ_SKIN_MAX_INFLUENCES && influences[v].weights[i] != 0.0f; ++i) {
+                const shz::mat4x4& m = palette[influences[v].bones[i]];
+                const float        w = influences[v].weights[i];
+
+                pos  = shz_vec3_add(pos,  shz_vec3_scale(shz_mat4x4_transform_point3(&m, positions[v]), w));
+                norm = shz_vec3_add(norm, shz_vec3_scale(shz_mat4x4_transform_vec3(&m, normals[v]), w));
+            }
+
+            dstPos[v]  = pos;
+            dstNorm[v] = norm;
+        }
+    };
+
+    auto verify = [&](const shz_vec3_t& a, const shz_vec3_t& b) {
+        GBL_TEST_ERROR(a.x, b.x, SKIN_ERROR, GBL_TEST_ERROR_FUZZY);
+        GBL_TEST_ERROR(a.y, b.y, SKIN_ERROR, GBL_TEST_ERROR_FUZZY);
+        GBL_TEST_ERROR(a.z, b.z, SKIN_ERROR, GBL_TEST_ERROR_FUZZY);
+    };
+
+    reference(expected[0], expected[1]);
+
+    shz::skin(palette, influences, skinned[0], positions, skinned[1], normals, vertices);
+    for(size_t v = 0; v < vertices; ++v) {
+        verify(expected[0][v], skinned[0][v]);
+        verify(expected[1][v], skinned[1][v]);
+    }
+
+    // Positions only, against the compact palette.
+    shz::skin(compact, influences, skinned[0], positions, nullptr, nullptr, vertices);
+    for(size_t v = 0; v < vertices; ++v)
+        verify(expected[0][v], skinned[0][v]);
+
+    // In-place, within interleaved vertices.
+    shz::skin(palette, &interleaved[0].influence,
+              &interleaved[0].pos, &interleaved[0].pos,
+              &interleaved[0].normal, &interleaved[0].normal,
+              vertices, sizeof(vertex));
+    for(size_t v = 0; v < vertices; ++v) {
+        verify(expected[0][v], interleaved[v].pos);
+        verify(expected[1][v], interleaved[v].normal);
+    }
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz::skin", [&] {
+                shz::skin(palette, influences, skinned[0], positions, skinned[1], normals, vertices);
+            },
+            "shz_mat4x4_transform_point3", [&] {
+                reference(expected[0], expected[1]);
+            }
+        )
+    );
+GBL_TEST_CASE_END
+
 GBL_TEST_REGISTER(copy,
                   swap,
                   inverse,
                   transform_vec4,
-                  to_quat)
\ No newline at end of file
+                  to_quat,
+                  skin)
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "sh4zam/shz_quat.hpp"
 
 #include <print>
+#include <algorithm>
+#include <cmath>
 
 #define GBL_SELF_TYPE   shz_quat_test_suite
 
@@ -393,8 +395,110 @@ GBL_TEST_CASE(slerp)
     }
 GBL_TEST_CASE_END
 
+GBL_TEST_CASE(pose_blend)
+    constexpr size_t bones      = 64;
+    constexpr float  POSE_ERROR = 1e-4f;
+
+    static shz_quat_t rotations[3][bones], blended[bones];
+    static shz_vec3_t translations[3][bones], scales[3][bones], blendedTranslations[bones], blendedScales[bones];
+
+    for(size_t b = 0; b < bones; ++b) {
+        for(size_t p = 0; p < 3; ++p) {
+            rotations[p][b]    = shz::quat::from_angles_xyz(gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                                            gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                                            gblRandUniform(-SHZ_F_PI, SHZ_F_PI));
+            translations[p][b] = shz_vec3_init(gblRandUniform(-1.0f, 1.0f), gblRandUniform(-1.0f, 1.0f), gblRandUniform(-1.0f, 1.0f));
+            scales[p][b]       = shz_vec3_init(gblRandUniform(0.5f, 2.0f), gblRandUniform(0.5f, 2.0f), gblRandUniform(0.5f, 2.0f));
+        }
+
+        // Cover nearly identical rotations, and those in opposite hemispheres.
+        if(b % 8 == 0)
+            rotations[1][b] = shz::quat(rotations[0][b]).negated();
+        else if(b % 8 == 1)
+            rotations[1][b] = shz_quat_normalize(shz_quat_add(rotations[0][b], shz_quat_init(1e-4f, 0.0f, 0.0f, 0.0f)));
+    }
+
+    // Same orientation, regardless of sign.
+    auto verify = [&](shz_quat_t a, shz_quat_t b) {
+        const float sign = (shz_quat_dot(a, b) < 0.0f)? -1.0f : 1.0f;
+        for(size_t c = 0; c < 4; ++c)
+            GBL_TEST_ERROR(a.e[c], b.e[c] * sign, POSE_ERROR, GBL_TEST_ERROR_ABSOLUTE);
+    };
+
+    // Double-precision SLERP along the shorter arc.
+    auto slerp = [](shz_quat_t a, shz_quat_t b, double t) {
+        double c = shz_quat_dot(a, b), sign = 1.0;
+        if(c < 0.0) { c = -c; sign = -1.0; }
+        const double theta = std::acos(std::min(c, 1.0));
+        const double wa = (theta < 1e-6)? 1.0 - t : std::sin((1.0 - t) * theta) / std::sin(theta);
+        const double wb = (theta < 1e-6)? t       : std::sin(t * theta) / std::sin(theta);
+        return shz_quat_add(shz_quat_scale(a, wa), shz_quat_scale(b, wb * sign));
+    };
+
+    for(float t : { 0.0f, 0.1f, 0.5f, 0.77f, 1.0f }) {
+        shz::slerp_array(blended, rotations[0], rotations[1], t, bones);
+        for(size_t b = 0; b < bones; ++b)
+            verify(blended[b], slerp(rotations[0][b], rotations[1][b], t));
+
+        shz::nlerp_array(blended, rotations[0], rotations[1], t, bones);
+        for(size_t b = 0; b < bones; ++b)
+            verify(blended[b], shz_quat_nlerp(rotations[0][b], rotations[1][b], t));
+    }
+
+    const shz::pose poses[3] = {
+        { rotations[0], translations[0], scales[0] },
+        { rotations[1], translations[1], scales[1] },
+        { rotations[2], translations[2], scales[2] }
+    };
+    const shz::pose dst = { blended, blendedTranslations, blendedScales };
+
+    shz::slerp(dst, poses[0], poses[1], 0.3f, bones);
+    for(size_t b = 0; b < bones; ++b) {
+        verify(blended[b], slerp(rotations[0][b], rotations[1][b], 0.3f));
+        GBL_TEST_VERIFY(shz::vec3(blendedTranslations[b]) == shz_vec3_lerp(translations[0][b], translations[1][b], 0.3f));
+        GBL_TEST_VERIFY(shz::vec3(blendedScales[b]) == shz_vec3_lerp(scales[0][b], scales[1][b], 0.3f));
+    }
+
+    // Three-way blend, in-place over the first pose's translations.
+    const float       weights[3] = { 0.5f, 0.3f, 0.2f };
+    const shz_quat_t* srcs[3]    = { rotations[0], rotations[1], rotations[2] };
+    shz_vec3_t        expected[bones];
+
+    for(size_t b = 0; b < bones; ++b)
+        expected[b] = shz_vec3_add(shz_vec3_add(shz_vec3_scale(translations[0][b], 0.5f),
+                                                shz_vec3_scale(translations[1][b], 0.3f)),
+                                   shz_vec3_scale(translations[2][b], 0.2f));
+
+    shz::blend_array(blended, srcs, weights, 3, bones);
+    shz::blend({ blended, translations[0], nullptr }, poses, weights, 3, bones);
+    for(size_t b = 0; b < bones; ++b) {
+        shz_quat_t q = shz_quat_scale(rotations[0][b], 0.5f);
+        for(size_t p = 1; p < 3; ++p)
+            q = shz_quat_add(q, shz_quat_scale(rotations[p][b], (shz_quat_dot(rotations[0][b], rotations[p][b]) < 0.0f)? -weights[p] : weights[p]));
+
+        verify(blended[b], shz_quat_normalize(q));
+        GBL_TEST_VERIFY(shz::vec3(translations[0][b]) == expected[b]);
+    }
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz::slerp(pose)", [&] {
+                shz::slerp(dst, poses[1], poses[2], 0.35f, bones);
+            },
+            "shz_quat_slerp", [&] {
+                for(size_t b = 0; b < bones; ++b) {
+                    blended[b]             = shz_quat_slerp(rotations[1][b], rotations[2][b], 0.35f);
+                    blendedTranslations[b] = shz_vec3_lerp(translations[1][b], translations[2][b], 0.35f);
+                    blendedScales[b]       = shz_vec3_lerp(scales[1][b], scales[2][b], 0.35f);
+                }
+            }
+        )
+    );
+GBL_TEST_CASE_END
+
 GBL_TEST_REGISTER(identity,
                   from_axis_angle,
                   from_angles_xyz,
                   transform_vec3,
-                  slerp)
\ No newline at end of file
+                  slerp,
+                  pose_blend)
\ No newline at end of file
@@ -6,6 +6,7 @@
 
 #include <print>
 #include <array>
+#include <cmath>
 
 #define GBL_SELF_TYPE shz_scalar_test_suite
 
@@ -503,6 +504,66 @@ GBL_TEST_CASE(pow10f)
     );
 GBL_TEST_CASE_END
 
+GBL_TEST_CASE(precision_tiers)
+#define PRECISION_REPORT(func, lo, hi, ref, max_ulps) \
+    GBL_TEST_VERIFY(precision_report(#func, lo, hi, \
+                    []<shz::precision P>(float x) { return shz::approx::func<P>(x); }, \
+                    ref, max_ulps))
+
+    PRECISION_REPORT(log2f,  1e-3f,  1e3f,  [](double x) { return std::log2(x);       }, 4.0);
+    PRECISION_REPORT(logf,   1e-3f,  1e3f,  [](double x) { return std::log(x);        }, 4.0);
+    PRECISION_REPORT(log10f, 1e-3f,  1e3f,  [](double x) { return std::log10(x);      }, 4.0);
+    PRECISION_REPORT(pow2f,  -20.0f, 20.0f, [](double x) { return std::exp2(x);       }, 4.0);
+    PRECISION_REPORT(expf,   -10.0f, 10.0f, [](double x) { return std::exp(x);        }, 4.0);
+    PRECISION_REPORT(pow10f, -5.0f,  5.0f,  [](double x) { return std::pow(10.0, x);  }, 4.0);
+    PRECISION_REPORT(cbrtf,  -1e3f,  1e3f,  [](double x) { return std::cbrt(x);       }, 4.0);
+
+#undef PRECISION_REPORT
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(exp_extremes)
+    // Underflow flushes to at most the smallest normal float and overflow stays huge, rather than wrapping the exponent.
+    auto extremes = [&]<shz::precision P>() {
+        for(float x : { -90.0f, -100.0f, -200.0f }) {
+            GBL_TEST_VERIFY(shz::approx::expf<P>(x) >= 0.0f && shz::approx::expf<P>(x) <= 1.2e-38f);
+            GBL_TEST_VERIFY(shz::approx::pow2f<P>(x * 2.0f) >= 0.0f && shz::approx::pow2f<P>(x * 2.0f) <= 1.2e-38f);
+        }
+
+        for(float x : { -39.0f, -45.0f, -100.0f })
+            GBL_TEST_VERIFY(shz::approx::pow10f<P>(x) >= 0.0f && shz::approx::pow10f<P>(x) <= 1.2e-38f);
+
+        for(float x : { 89.0f, 100.0f, 200.0f }) {
+            GBL_TEST_VERIFY(!std::isnan(shz::approx::expf<P>(x)) && shz::approx::expf<P>(x) >= 1e38f);
+            GBL_TEST_VERIFY(!std::isnan(shz::approx::pow2f<P>(x * 2.0f)) && shz::approx::pow2f<P>(x * 2.0f) >= 1e38f);
+        }
+
+        for(float x : { 39.0f, 45.0f, 100.0f })
+            GBL_TEST_VERIFY(!std::isnan(shz::approx::pow10f<P>(x)) && shz::approx::pow10f<P>(x) >= 1e38f);
+    };
+
+    extremes.template operator()<shz::precision::fast>();
+    extremes.template operator()<shz::precision::balanced>();
+    extremes.template operator()<shz::precision::precise>();
+
+    // Just within range, PRECISE stays accurate.
+    GBL_TEST_VERIFY(std::abs(shz::approx::expf<shz::precision::precise>(88.0f) / 1.6516363e38f - 1.0f) < 1e-5f);
+    GBL_TEST_VERIFY(std::abs(shz::approx::expf<shz::precision::precise>(-87.0f) / 1.6458115e-38f - 1.0f) < 1e-5f);
+    GBL_TEST_VERIFY(std::abs(shz::approx::pow10f<shz::precision::precise>(38.0f) / 1e38f - 1.0f) < 1e-5f);
+
+    // All the way up to the largest float, where the exponent of 2^n reaches 128.
+    GBL_TEST_VERIFY(std::abs(shz::approx::expf<shz::precision::precise>(88.5f) / 2.7230878e38f - 1.0f) < 1e-5f);
+    GBL_TEST_VERIFY(std::abs(shz::approx::expf<shz::precision::precise>(88.7228317f) / 3.4027985e38f - 1.0f) < 1e-5f);
+    GBL_TEST_VERIFY(std::abs(shz::approx::pow10f<shz::precision::precise>(38.5f) / 3.1622777e38f - 1.0f) < 1e-5f);
+    GBL_TEST_VERIFY(std::abs(shz::approx::pow10f<shz::precision::precise>(38.5318375f) / 3.4028081e38f - 1.0f) < 1e-5f);
+
+    // Past which PRECISE overflows to infinity.
+    for(float x : { 88.7229f, 89.0f, 1000.0f })
+        GBL_TEST_VERIFY(std::isinf(shz::approx::expf<shz::precision::precise>(x)));
+
+    for(float x : { 38.5319f, 39.0f, 1000.0f })
+        GBL_TEST_VERIFY(std::isinf(shz::approx::pow10f<shz::precision::precise>(x)));
+GBL_TEST_CASE_END
+
 GBL_TEST_CASE(fmodf)
     // Sign of result always matches numerator across all four sign combinations
     GBL_TEST_VERIFY(shz::fmodf( 7.0f,  3.0f) ==  1.0f);
@@ -648,5 +709,7 @@ GBL_TEST_REGISTER(min,
                   logf,
                   log10f,
                   pow10f,
+                  precision_tiers,
+                  exp_extremes,
                   fmodf,
                   remainderf)
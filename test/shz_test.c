@@ -19,6 +19,26 @@ int main(int argc, const char* argv[]) {
                                  GblTestSuite_create(SHZ_VECTOR_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(scenario,
                                  GblTestSuite_create(SHZ_QUAT_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(scenario,
+                                 GblTestSuite_create(SHZ_DUALQUAT_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(scenario,
+                                 GblTestSuite_create(SHZ_ANIM_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(scenario,
+                                 GblTestSuite_create(SHZ_HIERARCHY_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(scenario,
+                                 GblTestSuite_create(SHZ_CHAIN_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(scenario,
+                                 GblTestSuite_create(SHZ_TRANSFORM_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(scenario,
+                                 GblTestSuite_create(SHZ_CULL_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(scenario,
+                                 GblTestSuite_create(SHZ_CLIP_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(scenario,
+                                 GblTestSuite_create(SHZ_LIGHT_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(scenario,
+                                 GblTestSuite_create(SHZ_COLOR_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(scenario,
+                                 GblTestSuite_create(SHZ_TWIDDLE_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(scenario,
                                  GblTestSuite_create(SHZ_XMTRX_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(scenario,
@@ -7,6 +7,16 @@
 #define SHZ_TRIG_TEST_SUITE_TYPE     (GBL_TYPEID(shz_trig_test_suite))
 #define SHZ_VECTOR_TEST_SUITE_TYPE   (GBL_TYPEID(shz_vector_test_suite))
 #define SHZ_QUAT_TEST_SUITE_TYPE     (GBL_TYPEID(shz_quat_test_suite))
+#define SHZ_DUALQUAT_TEST_SUITE_TYPE (GBL_TYPEID(shz_dualquat_test_suite))
+#define SHZ_ANIM_TEST_SUITE_TYPE     (GBL_TYPEID(shz_anim_test_suite))
+#define SHZ_HIERARCHY_TEST_SUITE_TYPE (GBL_TYPEID(shz_hierarchy_test_suite))
+#define SHZ_CHAIN_TEST_SUITE_TYPE    (GBL_TYPEID(shz_chain_test_suite))
+#define SHZ_TRANSFORM_TEST_SUITE_TYPE (GBL_TYPEID(shz_transform_test_suite))
+#define SHZ_CULL_TEST_SUITE_TYPE     (GBL_TYPEID(shz_cull_test_suite))
+#define SHZ_CLIP_TEST_SUITE_TYPE     (GBL_TYPEID(shz_clip_test_suite))
+#define SHZ_LIGHT_TEST_SUITE_TYPE    (GBL_TYPEID(shz_light_test_suite))
+#define SHZ_COLOR_TEST_SUITE_TYPE    (GBL_TYPEID(shz_color_test_suite))
+#define SHZ_TWIDDLE_TEST_SUITE_TYPE  (GBL_TYPEID(shz_twiddle_test_suite))
 #define SHZ_XMTRX_TEST_SUITE_TYPE    (GBL_TYPEID(shz_xmtrx_test_suite))
 #define SHZ_MATRIX_TEST_SUITE_TYPE   (GBL_TYPEID(shz_matrix_test_suite))
 #define SHZ_MEM_TEST_SUITE_TYPE      (GBL_TYPEID(shz_mem_test_suite))
@@ -18,6 +28,16 @@ GBL_DERIVE_EMPTY_TYPE(shz_scalar_test_suite,  GblTestSuite)
 GBL_DERIVE_EMPTY_TYPE(shz_trig_test_suite,    GblTestSuite)
 GBL_DERIVE_EMPTY_TYPE(shz_vector_test_suite,  GblTestSuite)
 GBL_DERIVE_EMPTY_TYPE(shz_quat_test_suite,    GblTestSuite)
+GBL_DERIVE_EMPTY_TYPE(shz_dualquat_test_suite, GblTestSuite)
+GBL_DERIVE_EMPTY_TYPE(shz_anim_test_suite,    GblTestSuite)
+GBL_DERIVE_EMPTY_TYPE(shz_hierarchy_test_suite, GblTestSuite)
+GBL_DERIVE_EMPTY_TYPE(shz_chain_test_suite,   GblTestSuite)
+GBL_DERIVE_EMPTY_TYPE(shz_transform_test_suite, GblTestSuite)
+GBL_DERIVE_EMPTY_TYPE(shz_cull_test_suite,    GblTestSuite)
+GBL_DERIVE_EMPTY_TYPE(shz_clip_test_suite,    GblTestSuite)
+GBL_DERIVE_EMPTY_TYPE(shz_light_test_suite,   GblTestSuite)
+GBL_DERIVE_EMPTY_TYPE(shz_color_test_suite,   GblTestSuite)
+GBL_DERIVE_EMPTY_TYPE(shz_twiddle_test_suite, GblTestSuite)
 GBL_DERIVE_EMPTY_TYPE(shz_xmtrx_test_suite,   GblTestSuite)
 GBL_DERIVE_EMPTY_TYPE(shz_matrix_test_suite,  GblTestSuite)
 GBL_DERIVE_EMPTY_TYPE(shz_mem_test_suite,     GblTestSuite)
@@ -5,6 +5,8 @@
 #include <concepts>
 #include <print>
 #include <chrono>
+#include <cfloat>
+#include <cmath>
 
 #include <sh4zam/shz_sh4zam.hpp>
 
@@ -212,4 +214,73 @@ bool benchmark_cmp(const char* shzName, ShzFn&& shzFn,
 
 #define benchmark_cmp(retType, shzFn, refFn, ...) (benchmark_cmp<retType>)(#shzFn, shzFn, #refFn, refFn __VA_OPT__(,) __VA_ARGS__)
 
+/* Prints a table row with the throughput of a function which processes the
+   given number of items per call, as items per period of nanoseconds (ie
+   1000000 for items per millisecond, or 1000 for bytes as MB/s). */
+template<typename Fn>
+SHZ_NO_INLINE
+void throughput_report(const char* name, const char* unit, uint64_t items, uint64_t period, Fn&& fn) noexcept {
+    const uint64_t start = ns_gettime64();
+
+    for(unsigned i = 0; i < BENCHMARK_ITERATION_COUNT; ++i)
+        fn();
+
+    const uint64_t elapsed = std::max<uint64_t>(ns_gettime64() - start, 1);
+
+#ifndef SHZ_DISABLE_BENCHMARKS
+    std::println("\t{:>25} : {:12} {}", name, items * BENCHMARK_ITERATION_COUNT * period / elapsed, unit);
+#else
+    (void)name; (void)unit; (void)items; (void)period; (void)elapsed;
+#endif
+}
+
+/* Prints a table row with the maximum error, in ULPs, of each precision tier
+   of a function over [lo, hi] along with its cost per call (cycles on SH4,
+   nanoseconds elsewhere), returning whether the PRECISE tier stays within
+   maxPreciseUlps of the double-precision reference. The function is given as
+   a generic lambda taking the tier as its template argument. */
+template<typename Fn, typename RefFn>
+SHZ_NO_INLINE
+bool precision_report(const char* name, float lo, float hi, Fn&& fn, RefFn&& refFn, double maxPreciseUlps) noexcept {
+    constexpr size_t samples  = 1024;
+    constexpr size_t batch    = 64;
+
+    double ulps[3] = { 0.0 }, costs[3] = { 0.0 };
+    float  inputs[batch];
+
+    for(size_t i = 0; i < batch; ++i)
+        inputs[i] = gblRandUniform(lo, hi);
+
+    auto tier = [&]<shz::precision P>(size_t t) {
+        for(size_t i = 0; i <= samples; ++i) {
+            const float  x     = lo + (hi - lo) * ((float)i / (float)samples);
+            const double ref   = refFn((double)x);
+            const float  ref_f = std::fabs((float)ref);
+            const double ulp   = (ref_f < FLT_MIN)? (double)std::nextafter(0.0f, 1.0f)
+                                                  : (double)std::nextafter(ref_f, INFINITY) - ref_f;
+
+            ulps[t] = std::max(ulps[t], std::fabs((double)fn.template operator()<P>(x) - ref) / ulp);
+        }
+
+        auto [uncached, cached] = (benchmark)(nullptr, name, [&] {
+            volatile float sum = 0.0f;
+            for(size_t i = 0; i < batch; ++i)
+                sum = sum + fn.template operator()<P>(inputs[i]);
+        });
+
+        costs[t] = (double)cached / (double)batch;
+    };
+
+    tier.template operator()<shz::precision::fast>(0);
+    tier.template operator()<shz::precision::balanced>(1);
+    tier.template operator()<shz::precision::precise>(2);
+
+#ifndef SHZ_DISABLE_BENCHMARKS
+    std::println("* {:>8} | FAST {:12.1f} ulp {:6.1f} | BALANCED {:10.1f} ulp {:6.1f} | PRECISE {:6.2f} ulp {:6.1f}",
+                 name, ulps[0], costs[0], ulps[1], costs[1], ulps[2], costs[2]);
+#endif
+
+    return ulps[2] <= maxPreciseUlps;
+}
+
 #endif
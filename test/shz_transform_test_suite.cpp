@@ -0,0 +1,369 @@
+#include "shz_test.h"
+#include "shz_test.hpp"
+#include "sh4zam/shz_transform.hpp"
+#include "sh4zam/shz_xmtrx.hpp"
+
+#include <array>
+#include <algorithm>
+#include <cmath>
+
+#define GBL_SELF_TYPE   shz_transform_test_suite
+
+GBL_TEST_FIXTURE_NONE
+GBL_TEST_INIT_NONE
+GBL_TEST_FINAL_NONE
+
+namespace {
+    constexpr float TRANSFORM_ERROR = 1e-3f;
+
+    constexpr shz::transform_kind kinds[] = {
+        SHZ_TRANSFORM_IDENTITY,
+        SHZ_TRANSFORM_TRANSLATION,
+        SHZ_TRANSFORM_DIAGONAL,
+        SHZ_TRANSFORM_RIGID,
+        SHZ_TRANSFORM_AFFINE,
+        SHZ_TRANSFORM_PROJECTIVE
+    };
+
+    bool compare(const shz_mat4x4_t& expected, const shz_mat4x4_t& actual) {
+        for(unsigned e = 0; e < 16; ++e)
+            if(std::abs(expected.elem[e] - actual.elem[e]) > TRANSFORM_ERROR * std::max(1.0f, std::abs(expected.elem[e])))
+                return false;
+
+        return true;
+    }
+
+    bool compare(shz_vec4_t expected, shz_vec4_t actual) {
+        for(unsigned e = 0; e < 4; ++e)
+            if(std::abs(expected.e[e] - actual.e[e]) > TRANSFORM_ERROR * std::max(1.0f, std::abs(expected.e[e])))
+                return false;
+
+        return true;
+    }
+
+    // Returns whether the matrix actually has the structure promised by its kind.
+    bool structured(const shz::transform& xf) {
+        const shz_mat4x4_t& m = xf.matrix;
+
+        if(xf.kind == SHZ_TRANSFORM_PROJECTIVE)
+            return true;
+
+        if(m.col[0].w != 0.0f || m.col[1].w != 0.0f || m.col[2].w != 0.0f || m.col[3].w != 1.0f)
+            return false;
+
+        const bool diagonal = !m.col[0].y && !m.col[0].z && !m.col[1].x && !m.col[1].z && !m.col[2].x && !m.col[2].y;
+        const bool unit     = m.col[0].x == 1.0f && m.col[1].y == 1.0f && m.col[2].z == 1.0f;
+        const bool origin   = !m.pos.x && !m.pos.y && !m.pos.z;
+
+        switch(xf.kind) {
+        case SHZ_TRANSFORM_IDENTITY:    return diagonal && unit && origin;
+        case SHZ_TRANSFORM_TRANSLATION: return diagonal && unit;
+        case SHZ_TRANSFORM_DIAGONAL:    return diagonal && origin;
+        case SHZ_TRANSFORM_RIGID:       return std::abs(shz_mat4x4_3x3_determinant(&m) - 1.0f) < TRANSFORM_ERROR;
+        default:                        return true;
+        }
+    }
+
+    shz::quat random_quat() {
+        return shz::quat::from_angles_xyz(gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                          gblRandUniform(-SHZ_F_PI, SHZ_F_PI),
+                                          gblRandUniform(-SHZ_F_PI, SHZ_F_PI));
+    }
+
+    shz::vec3 random_vec3(float range) {
+        return { gblRandUniform(-range, range), gblRandUniform(-range, range), gblRandUniform(-range, range) };
+    }
+
+    // Initializes a random, invertible transform of the given kind.
+    shz::transform random_transform(shz::transform_kind kind) {
+        shz::transform xf;
+
+        switch(kind) {
+        case SHZ_TRANSFORM_IDENTITY:
+            xf.init_identity();
+            break;
+        case SHZ_TRANSFORM_TRANSLATION: {
+            const shz::vec3 t = random_vec3(10.0f);
+            xf.init_translation(t.x, t.y, t.z);
+            break;
+        }
+        case SHZ_TRANSFORM_DIAGONAL:
+            xf.init_scale(gblRandUniform(0.5f, 2.0f), gblRandUniform(-2.0f, -0.5f), gblRandUniform(0.5f, 2.0f));
+            break;
+        case SHZ_TRANSFORM_RIGID:
+            xf.init_rigid(random_quat(), random_vec3(10.0f));
+            break;
+        case SHZ_TRANSFORM_AFFINE:
+            xf.init_rigid(random_quat(), random_vec3(10.0f));
+            xf.scale(gblRandUniform(0.5f, 2.0f), gblRandUniform(0.5f, 2.0f), gblRandUniform(0.5f, 2.0f));
+            break;
+        default:
+            xf.init_perspective(gblRandUniform(0.5f, 2.0f), gblRandUniform(0.75f, 2.0f), gblRandUniform(0.1f, 1.0f));
+            xf.rotate(random_quat());
+            break;
+        }
+
+        return xf;
+    }
+}
+
+GBL_TEST_CASE(init)
+    shz::transform xf;
+    shz::mat4x4    mat;
+
+    for(shz::transform_kind kind : kinds) {
+        xf = random_transform(kind);
+        GBL_TEST_COMPARE(xf.kind, kind);
+        GBL_TEST_VERIFY(structured(xf));
+    }
+
+    // Classifying untagged matrices recovers every kind but rigid.
+    for(shz::transform_kind kind : kinds) {
+        xf = random_transform(kind);
+        mat = xf.mat();
+
+        shz::transform classified(mat);
+        GBL_TEST_COMPARE(classified.kind, (kind == SHZ_TRANSFORM_RIGID)? SHZ_TRANSFORM_AFFINE : kind);
+        GBL_TEST_VERIFY(compare(mat, classified.matrix));
+    }
+
+    shz_mat4x4_init_translation(&mat, 0.0f, 0.0f, 0.0f);
+    xf.init(mat);
+    GBL_TEST_COMPARE(xf.kind, SHZ_TRANSFORM_IDENTITY);
+
+    shz_mat4x4_init_scale(&mat, 1.0f, 2.0f, 1.0f);
+    mat.pos.x = 3.0f;
+    xf.init(mat);
+    GBL_TEST_COMPARE(xf.kind, SHZ_TRANSFORM_AFFINE);
+
+    shz_mat4x4_init_perspective(&mat, 1.0f, 1.5f, 0.1f);
+    xf.init(mat);
+    GBL_TEST_COMPARE(xf.kind, SHZ_TRANSFORM_PROJECTIVE);
+
+    xf.init_perspective(1.0f, 1.5f, 0.1f);
+    GBL_TEST_VERIFY(compare(mat, xf.matrix));
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(apply)
+    for(unsigned i = 0; i < 256; ++i) {
+        shz::transform xf = random_transform(kinds[gblRandRange(0, 5)]);
+        shz::mat4x4    expected;
+
+        shz_xmtrx_load_4x4(&xf.matrix);
+
+        for(size_t o = 0, count = gblRandRange(1, 8); o < count; ++o) {
+            const shz::transform_kind prev = xf.kind;
+
+            switch(gblRandRange(0, 5)) {
+            case 0: {
+                const shz::vec3 t = random_vec3(10.0f);
+                xf.translate(t.x, t.y, t.z);
+                shz_xmtrx_translate(t.x, t.y, t.z);
+                GBL_TEST_COMPARE(xf.kind, shz_transform_kind_mult(prev, SHZ_TRANSFORM_TRANSLATION));
+                break;
+            }
+            case 1: {
+                const shz::vec3 s = { gblRandUniform(0.5f, 2.0f), gblRandUniform(0.5f, 2.0f), gblRandUniform(0.5f, 2.0f) };
+                xf.scale(s.x, s.y, s.z);
+                shz_xmtrx_scale(s.x, s.y, s.z);
+                GBL_TEST_COMPARE(xf.kind, shz_transform_kind_mult(prev, SHZ_TRANSFORM_DIAGONAL));
+                break;
+            }
+            case 2: {
+                const float angle = gblRandUniform(-SHZ_F_PI, SHZ_F_PI);
+                xf.rotate_x(angle);
+                shz_xmtrx_rotate_x(angle);
+                GBL_TEST_COMPARE(xf.kind, shz_transform_kind_mult(prev, SHZ_TRANSFORM_RIGID));
+                break;
+            }
+            case 3: {
+                const float angle = gblRandUniform(-SHZ_F_PI, SHZ_F_PI);
+                xf.rotate_y(angle);
+                shz_xmtrx_rotate_y(angle);
+                break;
+            }
+            case 4: {
+                const float angle = gblRandUniform(-SHZ_F_PI, SHZ_F_PI);
+                xf.rotate_z(angle);
+                shz_xmtrx_rotate_z(angle);
+                break;
+            }
+            default: {
+                const shz::quat q = random_quat();
+                shz::mat4x4     rot;
+
+                xf.rotate(q);
+                shz_mat4x4_init_rotation_quat(&rot, q);
+                shz_xmtrx_apply_4x4(&rot);
+                GBL_TEST_COMPARE(xf.kind, shz_transform_kind_mult(prev, SHZ_TRANSFORM_RIGID));
+                break;
+            }
+            }
+
+            GBL_TEST_VERIFY(structured(xf));
+        }
+
+        shz_xmtrx_store_4x4(&expected);
+        GBL_TEST_VERIFY(compare(expected, xf.matrix));
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(mult)
+    for(unsigned i = 0; i < 64; ++i)
+        for(shz::transform_kind lhsKind : kinds)
+            for(shz::transform_kind rhsKind : kinds) {
+                shz::transform lhs = random_transform(lhsKind);
+                shz::transform rhs = random_transform(rhsKind);
+                shz::mat4x4    expected;
+
+                shz_mat4x4_mult(&expected, &lhs.matrix, &rhs.matrix);
+
+                shz::transform product = lhs * rhs;
+                GBL_TEST_COMPARE(product.kind, shz_transform_kind_mult(lhsKind, rhsKind));
+                GBL_TEST_VERIFY(structured(product));
+                GBL_TEST_VERIFY(compare(expected, product.matrix));
+
+                // Either operand may alias the output.
+                const shz::transform rhsCopy = rhs;
+
+                shz_transform_mult(&rhs, &lhs, &rhs);
+                GBL_TEST_VERIFY(compare(expected, rhs.matrix));
+
+                lhs *= rhsCopy;
+                GBL_TEST_VERIFY(compare(expected, lhs.matrix));
+            }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(inverse)
+    shz::mat4x4 identity;
+
+    identity.init_identity();
+
+    for(unsigned i = 0; i < 64; ++i)
+        for(shz::transform_kind kind : kinds) {
+            shz::transform xf  = random_transform(kind);
+            shz::transform inv = xf.inverse();
+
+            GBL_TEST_COMPARE(inv.kind, kind);
+            GBL_TEST_VERIFY(structured(inv));
+            GBL_TEST_VERIFY(compare(identity, (xf * inv).matrix));
+            GBL_TEST_VERIFY(compare(identity, (inv * xf).matrix));
+
+            shz_transform_inverse(&xf, &xf);
+            GBL_TEST_VERIFY(compare(inv.matrix, xf.matrix));
+        }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(determinant_transform)
+    for(unsigned i = 0; i < 64; ++i)
+        for(shz::transform_kind kind : kinds) {
+            const shz::transform xf = random_transform(kind);
+            const shz::vec4      v  = { gblRandUniform(-10.0f, 10.0f), gblRandUniform(-10.0f, 10.0f),
+                                        gblRandUniform(-10.0f, 10.0f), gblRandUniform(-2.0f, 2.0f) };
+            const shz::vec3      p  = v.xyz();
+            const float          det = shz_mat4x4_determinant(&xf.matrix);
+
+            GBL_TEST_VERIFY(std::abs(xf.determinant() - det) <= TRANSFORM_ERROR * std::max(1.0f, std::abs(det)));
+            GBL_TEST_VERIFY(compare(shz_mat4x4_transform_vec4(&xf.matrix, v), xf * v));
+            GBL_TEST_VERIFY(compare(shz_vec3_vec4(shz_mat4x4_transform_point3(&xf.matrix, p), 0.0f),
+                                    shz_vec3_vec4(xf * p, 0.0f)));
+            GBL_TEST_VERIFY(compare(shz_vec3_vec4(shz_mat4x4_transform_vec3(&xf.matrix, p), 0.0f),
+                                    shz_vec3_vec4(xf.transform_vec(p), 0.0f)));
+        }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(rigid_benchmark)
+    constexpr size_t count = 32;
+
+    std::array<shz::transform, count> nodes, results;
+    std::array<shz_vec3_t, count>     points;
+    shz::transform                    parent = random_transform(SHZ_TRANSFORM_RIGID);
+
+    for(size_t n = 0; n < count; ++n) {
+        nodes[n]  = random_transform(SHZ_TRANSFORM_RIGID);
+        points[n] = random_vec3(10.0f);
+    }
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz_transform_mult", [&] {
+                for(size_t n = 0; n < count; ++n)
+                    shz_transform_mult(&results[n], &parent, &nodes[n]);
+            },
+            "shz_mat4x4_mult", [&] {
+                for(size_t n = 0; n < count; ++n)
+                    shz_mat4x4_mult(&results[n].matrix, &parent.matrix, &nodes[n].matrix);
+            }
+        )
+    );
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz_transform_inverse", [&] {
+                for(size_t n = 0; n < count; ++n)
+                    shz_transform_inverse(&results[n], &nodes[n]);
+            },
+            "shz_mat4x4_inverse", [&] {
+                for(size_t n = 0; n < count; ++n)
+                    shz_mat4x4_inverse(&nodes[n].matrix, &results[n].matrix);
+            }
+        )
+    );
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz_transform_point3", [&] {
+                for(size_t n = 0; n < count; ++n)
+                    points[n] = shz_transform_point3(&parent, points[n]);
+            },
+            "shz_mat4x4_transform_point3", [&] {
+                for(size_t n = 0; n < count; ++n)
+                    points[n] = shz_mat4x4_transform_point3(&parent.matrix, points[n]);
+            }
+        )
+    );
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(affine_benchmark)
+    constexpr size_t count = 32;
+
+    std::array<shz::transform, count> nodes, results;
+    shz::transform                    scale = random_transform(SHZ_TRANSFORM_DIAGONAL);
+
+    for(size_t n = 0; n < count; ++n)
+        nodes[n] = random_transform(SHZ_TRANSFORM_AFFINE);
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz_transform_mult", [&] {
+                for(size_t n = 0; n < count; ++n)
+                    shz_transform_mult(&results[n], &nodes[n], &scale);
+            },
+            "shz_mat4x4_mult", [&] {
+                for(size_t n = 0; n < count; ++n)
+                    shz_mat4x4_mult(&results[n].matrix, &nodes[n].matrix, &scale.matrix);
+            }
+        )
+    );
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz_transform_determinant", [&] {
+                for(size_t n = 0; n < count; ++n)
+                    results[n].matrix.elem[0] = shz_transform_determinant(&nodes[n]);
+            },
+            "shz_mat4x4_determinant", [&] {
+                for(size_t n = 0; n < count; ++n)
+                    results[n].matrix.elem[0] = shz_mat4x4_determinant(&nodes[n].matrix);
+            }
+        )
+    );
+GBL_TEST_CASE_END
+
+GBL_TEST_REGISTER(init,
+                  apply,
+                  mult,
+                  inverse,
+                  determinant_transform,
+                  rigid_benchmark,
+                  affine_benchmark)
@@ -72,6 +72,58 @@ GBL_TEST_CASE(sincos_from_degrees)
     GBL_TEST_CALL(test(-SHZ_F_PI * 3.41f / 45.656f));
 GBL_TEST_CASE_END
 
+GBL_TEST_CASE(sincos_array)
+    constexpr size_t count = 255;
+    static float    radians[count], degrees[count];
+    static uint16_t radians16[count];
+    static float    sins[count], coss[count];
+
+    for(size_t i = 0; i < count; ++i) {
+        radians[i]   = gblRandUniform(-8.0f * SHZ_F_PI, 8.0f * SHZ_F_PI);
+        degrees[i]   = shz::rad_to_deg(radians[i]);
+        radians16[i] = (uint16_t)(i * 257);
+    }
+
+    shz::sincosf_array(sins, coss, radians, count);
+    for(size_t i = 0; i < count; ++i) {
+        GBL_TEST_ERROR(sins[i], sinf(radians[i]), SHZ_FSCA_ERROR_APPROX, GBL_TEST_ERROR_ABSOLUTE);
+        GBL_TEST_ERROR(coss[i], cosf(radians[i]), SHZ_FSCA_ERROR_APPROX, GBL_TEST_ERROR_ABSOLUTE);
+    }
+
+    shz::sincosf_deg_array(sins, coss, degrees, count);
+    for(size_t i = 0; i < count; ++i) {
+        GBL_TEST_ERROR(sins[i], sinf(radians[i]), SHZ_FSCA_ERROR_APPROX, GBL_TEST_ERROR_ABSOLUTE);
+        GBL_TEST_ERROR(coss[i], cosf(radians[i]), SHZ_FSCA_ERROR_APPROX, GBL_TEST_ERROR_ABSOLUTE);
+    }
+
+    shz::sincosu16_array(sins, coss, radians16, count);
+    for(size_t i = 0; i < count; ++i) {
+        const float angle = (float)radians16[i] * (2.0f * SHZ_F_PI / 65536.0f);
+        GBL_TEST_ERROR(sins[i], sinf(angle), SHZ_FSCA_ERROR_APPROX, GBL_TEST_ERROR_ABSOLUTE);
+        GBL_TEST_ERROR(coss[i], cosf(angle), SHZ_FSCA_ERROR_APPROX, GBL_TEST_ERROR_ABSOLUTE);
+    }
+
+    // Outputs may alias the input array exactly.
+    shz::sincosf_array(radians, coss, radians, count);
+    for(size_t i = 0; i < count; ++i)
+        GBL_TEST_ERROR(radians[i], sinf(shz::deg_to_rad(degrees[i])), SHZ_FSCA_ERROR_APPROX, GBL_TEST_ERROR_ABSOLUTE);
+
+    // Throughput of the array kernel vs a loop over the scalar API.
+    GBL_TEST_VERIFY((benchmark_cmp<std::nullptr_t>(
+        "shz::sincosf_deg_array",
+        [&] {
+            shz::sincosf_deg_array(sins, coss, degrees, count);
+        },
+        "shz::sincosf_deg",
+        [&] {
+            for(size_t i = 0; i < count; ++i) {
+                const auto pair = shz::sincosf_deg(degrees[i]);
+                sins[i] = pair.sin;
+                coss[i] = pair.cos;
+            }
+        })));
+GBL_TEST_CASE_END
+
 GBL_FP_PRECISE
 GBL_TEST_CASE(atanf)
     GBL_TEST_ERROR(shz_atanf(0.0f), atanf(0.0f), SHZ_FSCA_ERROR_APPROX, GBL_TEST_ERROR_FUZZY);
@@ -314,6 +366,41 @@ GBL_TEST_CASE(acothf)
     GBL_TEST_VERIFY(test(1.0001f));
 GBL_TEST_CASE_END
 
+GBL_TEST_CASE(precision_tiers)
+#define PRECISION_REPORT(func, lo, hi, ref, max_ulps) \
+    GBL_TEST_VERIFY(precision_report(#func, lo, hi, \
+                    []<shz::precision P>(float x) { return shz::approx::func<P>(x); }, \
+                    ref, max_ulps))
+
+    PRECISION_REPORT(atanf,  -10.0f,  10.0f,  [](double x) { return std::atan(x);  }, 4.0);
+    PRECISION_REPORT(asinf,  -1.0f,   1.0f,   [](double x) { return std::asin(x);  }, 4.0);
+    PRECISION_REPORT(acosf,  -1.0f,   1.0f,   [](double x) { return std::acos(x);  }, 4.0);
+    PRECISION_REPORT(sinhf,  -5.0f,   5.0f,   [](double x) { return std::sinh(x);  }, 4.0);
+    PRECISION_REPORT(coshf,  -5.0f,   5.0f,   [](double x) { return std::cosh(x);  }, 4.0);
+    PRECISION_REPORT(tanhf,  -5.0f,   5.0f,   [](double x) { return std::tanh(x);  }, 4.0);
+    PRECISION_REPORT(asinhf, -100.0f, 100.0f, [](double x) { return std::asinh(x); }, 4.0);
+    PRECISION_REPORT(acoshf, 1.0f,    100.0f, [](double x) { return std::acosh(x); }, 4.0);
+    PRECISION_REPORT(atanhf, -0.99f,  0.99f,  [](double x) { return std::atanh(x); }, 4.0);
+
+#undef PRECISION_REPORT
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(hyperbolic_extremes)
+    // Far past where the exponentials saturate, the hyperbolics still keep their signs and limits.
+    for(float x : { 50.0f, 100.0f, 1000.0f }) {
+        GBL_TEST_COMPARE(shz::approx::tanhf<shz::precision::precise>( x),  1.0f);
+        GBL_TEST_COMPARE(shz::approx::tanhf<shz::precision::precise>(-x), -1.0f);
+        GBL_TEST_VERIFY(shz::approx::sinhf<shz::precision::precise>( x) >=  1e21f);
+        GBL_TEST_VERIFY(shz::approx::sinhf<shz::precision::precise>(-x) <= -1e21f);
+        GBL_TEST_VERIFY(shz::approx::coshf<shz::precision::precise>( x) >=  1e21f);
+        GBL_TEST_VERIFY(shz::approx::coshf<shz::precision::precise>(-x) >=  1e21f);
+    }
+
+    // Just short of overflowing, they stay accurate.
+    GBL_TEST_VERIFY(std::abs(shz::approx::coshf<shz::precision::precise>( 88.7f) /  1.6629884e38f - 1.0f) < 1e-5f);
+    GBL_TEST_VERIFY(std::abs(shz::approx::sinhf<shz::precision::precise>(-88.7f) / -1.6629884e38f - 1.0f) < 1e-5f);
+GBL_TEST_CASE_END
+
 
 GBL_TEST_CASE(benches)
     volatile float result;
@@ -333,6 +420,7 @@ GBL_TEST_CASE_END
 
 GBL_TEST_REGISTER(sincos_from_radians,
                   sincos_from_degrees,
+                  sincos_array,
                   atanf,
                   asinf,
                   acosf,
@@ -348,4 +436,6 @@ GBL_TEST_REGISTER(sincos_from_radians,
                   acschf,
                   asechf,
                   acothf,
+                  precision_tiers,
+                  hyperbolic_extremes,
                   benches)
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "shz_test.h"
+#include "shz_test.hpp"
+#include "sh4zam/shz_twiddle.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#define GBL_SELF_TYPE   shz_twiddle_test_suite
+
+GBL_TEST_FIXTURE_NONE
+GBL_TEST_INIT_NONE
+GBL_TEST_FINAL_NONE
+
+namespace {
+    constexpr std::pair<size_t, size_t> sizes[] = {
+        { 8, 8 }, { 16, 16 }, { 64, 64 }, { 32, 8 }, { 8, 64 }, { 128, 16 }, { 16, 256 }
+    };
+
+    // Twiddles one coordinate at a time, moving a single bit per iteration, as a reference.
+    uint32_t reference_index(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+        const uint32_t size  = std::min(width, height);
+        uint32_t       index = 0, bit = 0;
+
+        for(uint32_t mask = 1; mask < size; mask <<= 1, bit += 2)
+            index |= ((y & mask)? 1u << bit : 0) | ((x & mask)? 2u << bit : 0);
+
+        return index + (x / size + y / size) * size * size;
+    }
+
+    // Large enough for the biggest texture, and aligned for shz_memcpy32().
+    constexpr size_t    max_bytes = 256 * 256 * 2;
+    alignas(32) uint8_t linear[max_bytes], twiddled[max_bytes], restored[max_bytes];
+
+    unsigned get_texel(const uint8_t* data, size_t index, unsigned bpp) {
+        switch(bpp) {
+        case 4:  return (data[index / 2] >> ((index & 1) * 4)) & 0xf;
+        case 8:  return data[index];
+        case 16: return reinterpret_cast<const uint16_t*>(data)[index];
+        default: return reinterpret_cast<const uint32_t*>(data)[index];
+        }
+    }
+
+    void twiddle(uint8_t* dst, const uint8_t* src, size_t width, size_t height, unsigned bpp) {
+        switch(bpp) {
+        case 4:  shz::twiddle4(dst, src, width, height); break;
+        case 8:  shz::twiddle(dst, src, width, height); break;
+        case 16: shz::twiddle(reinterpret_cast<uint16_t*>(dst), reinterpret_cast<const uint16_t*>(src), width, height); break;
+        default: shz::twiddle(reinterpret_cast<uint32_t*>(dst), reinterpret_cast<const uint32_t*>(src), width, height); break;
+        }
+    }
+
+    void untwiddle(uint8_t* dst, const uint8_t* src, size_t width, size_t height, unsigned bpp) {
+        switch(bpp) {
+        case 4:  shz::untwiddle4(dst, src, width, height); break;
+        case 8:  shz::untwiddle(dst, src, width, height); break;
+        case 16: shz::untwiddle(reinterpret_cast<uint16_t*>(dst), reinterpret_cast<const uint16_t*>(src), width, height); break;
+        default: shz::untwiddle(reinterpret_cast<uint32_t*>(dst), reinterpret_cast<const uint32_t*>(src), width, height); break;
+        }
+    }
+}
+
+GBL_TEST_CASE(morton)
+    GBL_TEST_COMPARE(shz::morton_encode(0, 0), 0u);
+    GBL_TEST_COMPARE(shz::morton_encode(0, 1), 1u);
+    GBL_TEST_COMPARE(shz::morton_encode(1, 0), 2u);
+    GBL_TEST_COMPARE(shz::morton_encode(3, 5), 0x1bu);
+    GBL_TEST_COMPARE(shz::morton_encode(0xffff, 0xffff), 0xffffffffu);
+    GBL_TEST_COMPARE(shz::morton_encode(0xffff, 0), 0xaaaaaaaau);
+
+    for(unsigned i = 0; i < 4096; ++i) {
+        const uint32_t x    = gblRandRange(0, 65535);
+        const uint32_t y    = gblRandRange(0, 65535);
+        const uint32_t code = shz::morton_encode(x, y);
+
+        GBL_TEST_COMPARE(code, reference_index(x, y, 65536, 65536));
+        GBL_TEST_COMPARE(shz::morton_decode_x(code), x);
+        GBL_TEST_COMPARE(shz::morton_decode_y(code), y);
+        GBL_TEST_COMPARE(shz::morton_compact(shz::morton_spread(x)), x);
+    }
+
+    // Rectangular textures are made of whole square blocks.
+    for(auto [width, height] : sizes)
+        for(uint32_t y = 0; y < height; ++y)
+            for(uint32_t x = 0; x < width; ++x)
+                GBL_TEST_COMPARE(shz::twiddle_index(x, y, width, height), reference_index(x, y, width, height));
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(twiddle)
+    for(unsigned bpp : { 4u, 8u, 16u, 32u }) {
+        for(auto [width, height] : sizes) {
+            const size_t bytes = width * height * bpp / 8;
+
+            for(size_t b = 0; b < bytes; ++b)
+                linear[b] = (uint8_t)gblRandRange(0, 255);
+
+            twiddle(twiddled, linear, width, height, bpp);
+
+            for(uint32_t y = 0; y < height; ++y)
+                for(uint32_t x = 0; x < width; ++x)
+                    GBL_TEST_COMPARE(get_texel(twiddled, reference_index(x, y, width, height), bpp),
+                                     get_texel(linear, y * width + x, bpp));
+
+            untwiddle(restored, twiddled, width, height, bpp);
+
+            GBL_TEST_VERIFY(!std::memcmp(restored, linear, bytes));
+        }
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(twiddle_benchmark)
+    constexpr size_t width = 256, height = 256;
+    auto*            texels = reinterpret_cast<uint16_t*>(linear);
+    auto*            output = reinterpret_cast<uint16_t*>(twiddled);
+
+    for(size_t b = 0; b < max_bytes; ++b)
+        linear[b] = (uint8_t)gblRandRange(0, 255);
+
+    // Twiddles one texel at a time, interleaving bits with a loop, as in a typical texture loader.
+    auto by_hand = [&] {
+        for(uint32_t y = 0; y < height; ++y)
+            for(uint32_t x = 0; x < width; ++x)
+                output[reference_index(x, y, width, height)] = texels[y * width + x];
+    };
+
+    auto with_shz = [&] {
+        shz::twiddle(output, texels, width, height);
+    };
+
+    GBL_TEST_VERIFY(
+        (benchmark_cmp<void>)(
+            "shz::twiddle", with_shz,
+            "twiddle by hand", by_hand
+        )
+    );
+
+    // Throughput in megabytes per second, against a plain copy of the same size.
+    throughput_report("shz_memcpy32", "MB/s", max_bytes, 1000, [&] { shz_memcpy32(restored, linear, max_bytes); });
+    throughput_report("twiddle16", "MB/s", max_bytes, 1000, with_shz);
+    throughput_report("twiddle16 (by hand)", "MB/s", max_bytes, 1000, by_hand);
+    throughput_report("untwiddle16", "MB/s", max_bytes, 1000, [&] { shz::untwiddle(reinterpret_cast<uint16_t*>(restored), output, width, height); });
+    throughput_report("twiddle4", "MB/s", max_bytes, 1000, [&] { shz::twiddle4(restored, linear, width * 2, height * 2); });
+    throughput_report("twiddle8", "MB/s", max_bytes, 1000, [&] { shz::twiddle(restored, linear, width * 2, height); });
+    throughput_report("twiddle32", "MB/s", max_bytes, 1000, [&] { shz::twiddle(reinterpret_cast<uint32_t*>(restored), reinterpret_cast<const uint32_t*>(linear), width, height / 2); });
+GBL_TEST_CASE_END
+
+GBL_TEST_REGISTER(morton,
+                  twiddle,
+                  twiddle_benchmark)
@@ -742,6 +742,80 @@ GBL_TEST_CASE(vec4Smoothstep)
     GBL_TEST_VERIFY(shz::vec4::smoothstep_safe(0.5f, 0.0f, 1.0f) == shz::vec4(0.5f, 0.5f, 0.5f, 0.5f));
 GBL_TEST_CASE_END
 
+GBL_TEST_CASE(vec3Soa)
+    constexpr size_t count = 1024;
+    static shz::vec3 aos[2][count];
+    static float     xs[3][count], ys[3][count], zs[3][count];
+    static float     scalars[count];
+
+    for(size_t i = 0; i < count; ++i) {
+        aos[0][i] = { gblRandUniform(-10.0f, 10.0f), gblRandUniform(-10.0f, 10.0f), gblRandUniform(-10.0f, 10.0f) };
+        aos[1][i] = { gblRandUniform(-10.0f, 10.0f), gblRandUniform(-10.0f, 10.0f), gblRandUniform(-10.0f, 10.0f) };
+    }
+
+    shz::vec3_soa a(xs[0], ys[0], zs[0], count);
+    shz::vec3_soa b(xs[1], ys[1], zs[1], count);
+    shz::vec3_soa out(xs[2], ys[2], zs[2], count);
+
+    // AoS -> SoA -> AoS must round-trip exactly.
+    a.from_aos(aos[0]);
+    b.from_aos(aos[1]);
+    a.to_aos(aos[1]);
+    for(size_t i = 0; i < count; ++i) {
+        GBL_TEST_VERIFY(a.x[i] == aos[0][i].x && a.y[i] == aos[0][i].y && a.z[i] == aos[0][i].z);
+        GBL_TEST_VERIFY(aos[1][i].x == aos[0][i].x && aos[1][i].y == aos[0][i].y && aos[1][i].z == aos[0][i].z);
+    }
+
+    // Bulk kernels must match their single-vector counterparts.
+    out.add(a, b);
+    for(size_t i = 0; i < count; ++i)
+        GBL_TEST_VERIFY(out[i] == a[i] + b[i]);
+
+    out.sub(a, b);
+    for(size_t i = 0; i < count; ++i)
+        GBL_TEST_VERIFY(out[i] == a[i] - b[i]);
+
+    out.scale(a, 0.5f);
+    for(size_t i = 0; i < count; ++i)
+        GBL_TEST_VERIFY(out[i] == a[i] * 0.5f);
+
+    a.dot(scalars, b);
+    for(size_t i = 0; i < count; ++i)
+        GBL_TEST_VERIFY(shz::equalf(scalars[i], a[i].dot(b[i])));
+
+    out.cross(a, b);
+    for(size_t i = 0; i < count; ++i)
+        GBL_TEST_VERIFY(out[i] == a[i].cross(b[i]));
+
+    out.lerp(a, b, 0.25f);
+    for(size_t i = 0; i < count; ++i)
+        GBL_TEST_VERIFY(out[i] == shz::vec3::lerp(a[i], b[i], 0.25f));
+
+    a.distance(scalars, b);
+    for(size_t i = 0; i < count; ++i)
+        GBL_TEST_VERIFY(shz::equalf(scalars[i], a[i].distance(b[i])));
+
+    out.normalize(a);
+    for(size_t i = 0; i < count; ++i)
+        GBL_TEST_VERIFY(out[i] == a[i].direction());
+
+    // In-place operation, with the destination aliasing a source.
+    out.cross(out, b);
+    for(size_t i = 0; i < count; ++i)
+        GBL_TEST_VERIFY(out[i] == a[i].direction().cross(b[i]));
+
+    GBL_TEST_VERIFY((benchmark_cmp<std::nullptr_t>(
+        "shz::vec3_soa::normalize",
+        [&] {
+            out.normalize(a);
+        },
+        "shz::vec3::direction",
+        [&] {
+            for(auto& vec : aos[1])
+                vec = vec.direction();
+        })));
+GBL_TEST_CASE_END
+
 GBL_TEST_REGISTER(vec2Construct,
                   vec2Set,
                   vec2Lerp,
@@ -777,4 +851,5 @@ GBL_TEST_REGISTER(vec2Construct,
                   vec4Step,
                   vec2Smoothstep,
                   vec3Smoothstep,
-                  vec4Smoothstep)
\ No newline at end of file
+                  vec4Smoothstep,
+                  vec3Soa)
\ No newline at end of file
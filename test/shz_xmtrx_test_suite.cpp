@@ -1814,6 +1814,233 @@ GBL_TEST_CASE(transform_point2)
 
 GBL_TEST_CASE_END
 
+GBL_TEST_CASE(ctx_transform)
+    alignas(8) shz::mat4x4 mat;
+    alignas(8) shz::mat4x4 out;
+    shz::xmtrx_ctx         ctx;
+
+    shz::xmtrx::init_rotation(shz::deg_to_rad(42.0f), 1.0f, 1.0f, 1.0f);
+    shz::xmtrx::apply_scale(2.0f, 2.0f, 2.0f);
+    shz::xmtrx::apply_translation(10.0f, 20.0f, 30.0f);
+    shz::xmtrx::store(&mat);
+
+    // Context-passing and implicit API must operate on the same XMTRX.
+    shz::vec4 v = { 3.0f, 2.0f, 1.0f, 1.0f };
+    GBL_TEST_VERIFY(ctx.transform(v) == shz::xmtrx::transform(v));
+    GBL_TEST_VERIFY(ctx.transform(v.xyz()) == shz::xmtrx::transform(v.xyz()));
+    GBL_TEST_VERIFY(ctx.transform_point(v.xyz()) == shz::xmtrx::transform_point(v.xyz()));
+
+    shz::xmtrx::init_identity();
+    ctx.load(mat);
+    ctx.store(&out);
+    GBL_TEST_VERIFY(out == mat);
+
+    ctx.load_apply(mat, mat);
+    ctx.store(&out);
+    shz::xmtrx::load_apply(mat, mat);
+    shz::xmtrx::store(&mat);
+    GBL_TEST_VERIFY(out == mat);
+
+    // Batched transform: TLS lookup per vertex vs once per batch.
+    static shz::vec4 verts[256];
+
+    for(auto& vert : verts)
+        vert = { gblRandf(), gblRandf(), gblRandf(), 1.0f };
+
+    GBL_TEST_VERIFY((benchmark_cmp<std::nullptr_t>(
+        "shz::xmtrx_ctx::transform",
+        [&] {
+            shz::xmtrx_ctx batch;
+            for(auto& vert : verts)
+                vert = batch.transform(vert);
+        },
+        "shz::xmtrx::transform",
+        [&] {
+            for(auto& vert : verts)
+                vert = shz::xmtrx::transform(vert);
+        })));
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(transform_array)
+    // PVR-style 32-byte interleaved vertex, with its position at a 4-byte offset.
+    struct vertex {
+        uint32_t   flags;
+        shz_vec3_t pos;
+        float      u, v;
+        uint32_t   argb, oargb;
+    };
+
+    static_assert(sizeof(vertex) == 32);
+
+    constexpr size_t count = 256;
+    static vertex    verts[count];
+    static shz::vec3 points[count];
+    static shz::vec4 vecs[count];
+    static shz::vec4 out[count];
+
+    shz::xmtrx::init_rotation(shz::deg_to_rad(42.0f), 1.0f, 1.0f, 1.0f);
+    shz::xmtrx::apply_scale(2.0f, 2.0f, 2.0f);
+    shz::xmtrx::apply_translation(10.0f, 20.0f, 30.0f);
+
+    for(size_t i = 0; i < count; ++i) {
+        verts[i].flags = 0xe0000000;
+        verts[i].pos   = shz_vec3_init(gblRandf(), gblRandf(), gblRandf());
+        verts[i].u     = 0.5f;
+        verts[i].v     = 0.25f;
+        verts[i].argb  = 0xffffffff;
+        verts[i].oargb = 0;
+        points[i]      = verts[i].pos;
+        vecs[i]        = { gblRandf(), gblRandf(), gblRandf(), gblRandf() };
+    }
+
+    // Packed, out-of-place transforms must match the per-element API.
+    shz::xmtrx::transform(out, vecs, count);
+    for(size_t i = 0; i < count; ++i)
+        GBL_TEST_VERIFY(out[i] == shz::xmtrx::transform(vecs[i]));
+
+    shz::xmtrx::transform(out, vecs, 0);
+    shz::xmtrx::transform(out, vecs, 1);
+    GBL_TEST_VERIFY(out[0] == shz::xmtrx::transform(vecs[0]));
+    GBL_TEST_VERIFY(out[1] == shz::xmtrx::transform(vecs[1]));
+
+    // Strided, in-place transforms must leave the rest of the vertex untouched.
+    shz::xmtrx::transform_point(&verts[0].pos, &verts[0].pos, count, sizeof(vertex));
+    for(size_t i = 0; i < count; ++i) {
+        GBL_TEST_VERIFY(shz::vec3(verts[i].pos) == shz::xmtrx::transform_point(points[i]));
+        GBL_TEST_VERIFY(verts[i].flags == 0xe0000000 && verts[i].u == 0.5f && verts[i].v == 0.25f);
+        GBL_TEST_VERIFY(verts[i].argb == 0xffffffff && verts[i].oargb == 0);
+    }
+
+    for(size_t i = 0; i < count; ++i)
+        verts[i].pos = points[i];
+
+    shz::xmtrx::transform(&verts[0].pos, &verts[0].pos, count, sizeof(vertex));
+    for(size_t i = 0; i < count; ++i)
+        GBL_TEST_VERIFY(shz::vec3(verts[i].pos) == shz::xmtrx::transform(points[i]));
+
+    // Throughput of the batched transform vs a loop over the per-element API.
+    auto transform_point3_array = [](shz_vec3_t* dst, const shz_vec3_t* src, size_t n, size_t stride) {
+        shz::xmtrx::transform_point(dst, src, n, stride);
+    };
+
+    auto [uncached, cached] = benchmark(nullptr, transform_point3_array,
+                                        &verts[0].pos, &verts[0].pos, count, sizeof(vertex));
+
+    [[maybe_unused]] auto verts_per_sec = [&](uint64_t cnt) {
+#if SHZ_BACKEND == SHZ_SH4
+        cnt *= NS_PER_CYCLE;
+#endif
+        return cnt? (count * 1000000000ull) / cnt : 0ull;
+    };
+
+#ifndef SHZ_DISABLE_BENCHMARKS
+    std::println("\t{:>25} : {} verts/s [CACHED], {} verts/s [UNCACHED]",
+                 "transform_point3_array", verts_per_sec(cached), verts_per_sec(uncached));
+#endif
+
+    GBL_TEST_VERIFY((benchmark_cmp<std::nullptr_t>(
+        "shz::xmtrx::transform_point(array)",
+        [&] {
+            shz::xmtrx::transform_point(&verts[0].pos, &verts[0].pos, count, sizeof(vertex));
+        },
+        "shz::xmtrx::transform_point",
+        [&] {
+            for(auto& vert : verts)
+                vert.pos = shz::xmtrx::transform_point(vert.pos);
+        })));
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(project_array)
+    // PVR-style 32-byte interleaved vertex, with its position at a 4-byte offset.
+    struct vertex {
+        uint32_t   flags;
+        shz_vec3_t pos;
+        float      u, v;
+        uint32_t   argb, oargb;
+    };
+
+    constexpr size_t       count    = 256;
+    static vertex          verts[count], sources[count];
+    static shz::vec3       points[count];
+    const  shz_viewport_t  viewport = shz_viewport_init(0.0f, 0.0f, 640.0f, 480.0f);
+
+    shz::xmtrx::init_perspective(shz::deg_to_rad(70.0f), 640.0f / 480.0f, 1.0f);
+    shz::xmtrx::apply_translation(0.0f, 0.0f, -20.0f);
+    shz::xmtrx::apply_rotation_xyz(0.5f, 0.25f, -0.75f);
+
+    for(size_t i = 0; i < count; ++i) {
+        verts[i].flags = 0xe0000000;
+        verts[i].pos   = shz_vec3_init(gblRandUniform(-10.0f, 10.0f), gblRandUniform(-10.0f, 10.0f), gblRandUniform(-10.0f, 10.0f));
+        verts[i].u     = 0.5f;
+        verts[i].v     = 0.25f;
+        verts[i].argb  = 0xffffffff;
+        verts[i].oargb = 0;
+        points[i]      = verts[i].pos;
+        sources[i]     = verts[i];
+    }
+
+    // Projects a single point by hand, as with a separate divide and viewport mapping.
+    auto project = [&](shz_vec3_t pt) {
+        const shz_vec4_t clip  = shz::xmtrx::transform(shz_vec3_vec4(pt, 1.0f));
+        const float      inv_w = shz_invf_fsrra(clip.w);
+
+        return shz_vec3_init(clip.x * inv_w * viewport.scale.x + viewport.offset.x,
+                             clip.y * inv_w * viewport.scale.y + viewport.offset.y,
+                             inv_w);
+    };
+
+    // Strided, in-place projections must match projecting each point by hand, leaving the rest of the vertex untouched.
+    shz::xmtrx::project_point(&verts[0].pos, &verts[0].pos, count, viewport, sizeof(vertex));
+    for(size_t i = 0; i < count; ++i) {
+        const shz_vec3_t expected = project(points[i]);
+
+        GBL_TEST_VERIFY(shz::xmtrx::transform(shz_vec3_vec4(points[i], 1.0f)).w > 0.0f);
+        GBL_TEST_VERIFY(shz_equalf(verts[i].pos.x, expected.x) && shz_equalf(verts[i].pos.y, expected.y));
+        GBL_TEST_VERIFY(shz_equalf_rel(verts[i].pos.z, expected.z));
+        GBL_TEST_VERIFY(verts[i].flags == 0xe0000000 && verts[i].u == 0.5f && verts[i].v == 0.25f);
+        GBL_TEST_VERIFY(verts[i].argb == 0xffffffff && verts[i].oargb == 0);
+    }
+
+    // Packed, out-of-place projections of only a few points, or none at all.
+    shz::vec3 out[2];
+    shz::xmtrx::project_point(out, points, 0, viewport);
+    shz::xmtrx::project_point(out, points, 1, viewport);
+    GBL_TEST_VERIFY(shz_equalf(out[0].x, project(points[0]).x) && shz_equalf(out[0].y, project(points[0]).y));
+    shz::xmtrx::project_point(out, points, 2, viewport);
+    GBL_TEST_VERIFY(shz_equalf(out[1].x, project(points[1]).x) && shz_equalf(out[1].y, project(points[1]).y));
+
+    // Throughput of the fused projection vs transforming, dividing, and mapping each vertex by hand.
+    auto project_point3_array = [&](shz_vec3_t* dst, const shz_vec3_t* src, size_t n, size_t stride) {
+        shz::xmtrx::project_point(dst, src, n, viewport, stride);
+    };
+
+    auto [uncached, cached] = benchmark(nullptr, project_point3_array,
+                                        &verts[0].pos, &sources[0].pos, count, sizeof(vertex));
+
+    [[maybe_unused]] auto verts_per_sec = [&](uint64_t cnt) {
+#if SHZ_BACKEND == SHZ_SH4
+        cnt *= NS_PER_CYCLE;
+#endif
+        return cnt? (count * 1000000000ull) / cnt : 0ull;
+    };
+
+#ifndef SHZ_DISABLE_BENCHMARKS
+    std::println("\t{:>25} : {} verts/s [CACHED], {} verts/s [UNCACHED]",
+                 "project_point3_array", verts_per_sec(cached), verts_per_sec(uncached));
+#endif
+
+    GBL_TEST_VERIFY((benchmark_cmp<std::nullptr_t>(
+        "shz::xmtrx::project_point(array)",
+        [&] {
+            shz::xmtrx::project_point(&verts[0].pos, &sources[0].pos, count, viewport, sizeof(vertex));
+        },
+        "shz_invf_fsrra",
+        [&] {
+            for(size_t i = 0; i < count; ++i)
+                verts[i].pos = project(sources[i].pos);
+        })));
+GBL_TEST_CASE_END
+
 GBL_TEST_REGISTER(read_write_registers,
                   read_write_rows,
                   read_write_cols,
@@ -1898,4 +2125,7 @@ GBL_TEST_REGISTER(read_write_registers,
                   transform_vec3,
                   transform_vec2,
                   transform_point3,
-                  transform_point2)
\ No newline at end of file
+                  transform_point2,
+                  ctx_transform,
+                  transform_array,
+                  project_array)
\ No newline at end of file